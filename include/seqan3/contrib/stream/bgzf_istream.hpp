@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
 #include <condition_variable>
 #include <mutex>
@@ -433,6 +434,10 @@ public:
                 {
                     DecompressionJob &job = jobs[currentJobId];
 
+                    // the in-block offset must not exceed the uncompressed block
+                    if ((ofs & 0xffff) > job.size)
+                        return pos_type(off_type(-1));
+
                     // reset buffer pointers
                     this->setg(
                           this->eback(),                                        // beginning of putback area
@@ -500,11 +505,18 @@ public:
 
                     assert(job.fileOfs == (off_type)destFileOfs);
 
+                    // the in-block offset must not exceed the uncompressed block
+                    off_type const blockSize = std::max<off_type>(job.size, 0);
+                    off_type const blockOfs = std::min<off_type>(ofs & 0xffff, blockSize);
+
                     // reset buffer pointers
                     this->setg(
                           &job.buffer[0] + MAX_PUTBACK,                     // no putback area
-                          &job.buffer[0] + (MAX_PUTBACK + (ofs & 0xffff)),  // read position
-                          &job.buffer[0] + (MAX_PUTBACK + job.size));       // end of buffer
+                          &job.buffer[0] + (MAX_PUTBACK + blockOfs),        // read position
+                          &job.buffer[0] + (MAX_PUTBACK + blockSize));      // end of buffer
+
+                    if (blockOfs != (ofs & 0xffff))
+                        return pos_type(off_type(-1));
                     return ofs;
                 }
             }
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
 #include <seqan3/contrib/parallel/suspendable_queue.hpp>
 #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
@@ -117,6 +119,7 @@ public:
     Serializer<OutputBuffer, BufferWriter> serializer;
     size_t                                 currentJobId;
     bool                                   currentJobAvail;
+    std::atomic<int>                       compressionLevel{BGZF_DEFAULT_COMPRESSION_LEVEL};
 
     struct CompressionThread
     {
@@ -140,7 +143,8 @@ public:
 
                 CompressionJob &job = streamBuf->jobs[jobId];
 
-                // compress block with zlib
+                // compress block with zlib (or libdeflate)
+                compressionCtx.level = streamBuf->compressionLevel.load(std::memory_order_relaxed);
                 job.outputBuffer->size = _compressBlock(
                     job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
                     &job.buffer[0], job.size, compressionCtx);
@@ -284,6 +288,12 @@ public:
             overflow(EOF);
     }
 
+    // sets the compression level of the following blocks; clamped to [0, BGZF_MAX_COMPRESSION_LEVEL]
+    void set_compression_level(int level)
+    {
+        compressionLevel.store(std::clamp(level, 0, BGZF_MAX_COMPRESSION_LEVEL), std::memory_order_relaxed);
+    }
+
     // returns a reference to the output stream
     ostream_reference get_ostream() const    { return serializer.worker.ostream; };
 };
@@ -24,6 +24,11 @@
 #error "This file cannot be used when building without GZip-support."
 #endif  // SEQAN3_HAS_ZLIB
 
+#if SEQAN3_HAS_LIBDEFLATE
+// libdeflate compresses and decompresses whole BGZF blocks considerably faster than zlib.
+#include <libdeflate.h>
+#endif  // SEQAN3_HAS_LIBDEFLATE
+
 #include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/io/detail/magic_header.hpp>
@@ -57,6 +62,14 @@ static constexpr std::array<char, 28> BGZF_END_OF_FILE_MARKER {{'\x1f', '\x8b',
                                                                 '\x00', '\x00', '\x00', '\x00',
                                                                 '\x00', '\x00', '\x00', '\x00'}};
 
+// The compression levels of BGZF blocks; libdeflate offers levels above Z_BEST_COMPRESSION.
+static constexpr int BGZF_DEFAULT_COMPRESSION_LEVEL = Z_BEST_SPEED;
+#if SEQAN3_HAS_LIBDEFLATE
+static constexpr int BGZF_MAX_COMPRESSION_LEVEL = 12;
+#else
+static constexpr int BGZF_MAX_COMPRESSION_LEVEL = Z_BEST_COMPRESSION;
+#endif  // SEQAN3_HAS_LIBDEFLATE
+
 template <typename TAlgTag>
 struct CompressionContext {};
 
@@ -80,6 +93,18 @@ struct CompressionContext<detail::bgzf_compression>:
 {
     static constexpr size_t BLOCK_HEADER_LENGTH = detail::bgzf_compression::magic_header.size();
     unsigned char headerPos;
+    // The compression level of the next block.
+    int level{BGZF_DEFAULT_COMPRESSION_LEVEL};
+
+#if SEQAN3_HAS_LIBDEFLATE
+    // Created on first use and kept for all blocks of the thread; the compressor is recreated if the level changes.
+    std::unique_ptr<libdeflate_compressor, void (*)(libdeflate_compressor *)> compressor{nullptr,
+                                                                                         libdeflate_free_compressor};
+    int compressorLevel{-1};
+    std::unique_ptr<libdeflate_decompressor, void (*)(libdeflate_decompressor *)> decompressor{
+        nullptr,
+        libdeflate_free_decompressor};
+#endif  // SEQAN3_HAS_LIBDEFLATE
 };
 
 template <>
@@ -105,7 +130,7 @@ struct DefaultPageSize<detail::bgzf_compression>
 // ----------------------------------------------------------------------------
 
 inline void
-compressInit(CompressionContext<detail::gz_compression> & ctx)
+compressInit(CompressionContext<detail::gz_compression> & ctx, int level = BGZF_DEFAULT_COMPRESSION_LEVEL)
 {
     const int GZIP_WINDOW_BITS = -15;   // no zlib header
     const int Z_DEFAULT_MEM_LEVEL = 8;
@@ -115,9 +140,8 @@ compressInit(CompressionContext<detail::gz_compression> & ctx)
 
     // (weese:) We use Z_BEST_SPEED instead of Z_DEFAULT_COMPRESSION as it turned out
     //          to be 2x faster and produces only 7% bigger output
-//    int status = deflateInit2(&ctx.strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
-//                              GZIP_WINDOW_BITS, Z_DEFAULT_MEM_LEVEL, Z_DEFAULT_STRATEGY);
-    int status = deflateInit2(&ctx.strm, Z_BEST_SPEED, Z_DEFLATED,
+    //          The default level is still Z_BEST_SPEED, but the level can be chosen by the output options.
+    int status = deflateInit2(&ctx.strm, std::min(level, Z_BEST_COMPRESSION), Z_DEFLATED,
                               GZIP_WINDOW_BITS, Z_DEFAULT_MEM_LEVEL, Z_DEFAULT_STRATEGY);
     if (status != Z_OK)
         throw io_error("Calling deflateInit2() failed for gz file.");
@@ -130,7 +154,7 @@ compressInit(CompressionContext<detail::gz_compression> & ctx)
 inline void
 compressInit(CompressionContext<detail::bgzf_compression> & ctx)
 {
-    compressInit(static_cast<CompressionContext<detail::gz_compression> &>(ctx));
+    compressInit(static_cast<CompressionContext<detail::gz_compression> &>(ctx), ctx.level);
     ctx.headerPos = 0;
 }
 
@@ -176,6 +200,65 @@ _bgzfPack32(char * buffer, uint32_t value)
                             buffer);
 }
 
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfCrc32()
+// ----------------------------------------------------------------------------
+
+inline uint32_t
+_bgzfCrc32(void const * buffer, size_t length)
+{
+#if SEQAN3_HAS_LIBDEFLATE
+    return libdeflate_crc32(0u, buffer, length);
+#else
+    return crc32(crc32(0u, NULL, 0u), static_cast<Bytef const *>(buffer), length);
+#endif  // SEQAN3_HAS_LIBDEFLATE
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfDeflate()
+// ----------------------------------------------------------------------------
+
+// Compresses a raw DEFLATE stream (no zlib or gzip header) and returns the compressed size.
+inline size_t
+_bgzfDeflate(char * dst, size_t dstCapacity, void const * src, size_t srcLength,
+             CompressionContext<detail::bgzf_compression> & ctx)
+{
+#if SEQAN3_HAS_LIBDEFLATE
+    if (!ctx.compressor || ctx.compressorLevel != ctx.level)
+    {
+        ctx.compressor.reset(libdeflate_alloc_compressor(ctx.level));
+        if (!ctx.compressor)
+            throw io_error("Calling libdeflate_alloc_compressor() failed for BGZF file.");
+        ctx.compressorLevel = ctx.level;
+    }
+
+    size_t len = libdeflate_deflate_compress(ctx.compressor.get(), src, srcLength, dst, dstCapacity);
+    if (len == 0)
+        throw io_error("Deflation failed. Compressed BGZF data is too big.");
+
+    return len;
+#else
+    compressInit(ctx);
+    ctx.strm.next_in = (Bytef *)(src);
+    ctx.strm.next_out = (Bytef *)(dst);
+    ctx.strm.avail_in = srcLength;
+    ctx.strm.avail_out = dstCapacity;
+
+    int status = deflate(&ctx.strm, Z_FINISH);
+    if (status != Z_STREAM_END)
+    {
+        deflateEnd(&ctx.strm);
+        throw io_error("Deflation failed. Compressed BGZF data is too big.");
+    }
+
+    status = deflateEnd(&ctx.strm);
+    if (status != Z_OK)
+        throw io_error("BGZF deflateEnd() failed.");
+
+    return dstCapacity - ctx.strm.avail_out;
+#endif  // SEQAN3_HAS_LIBDEFLATE
+}
+
 // ----------------------------------------------------------------------------
 // Function _compressBlock()
 // ----------------------------------------------------------------------------
@@ -192,40 +275,37 @@ _compressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
     assert(sizeof(TDestValue) == 1u);
     assert(sizeof(unsigned) == 4u);
 
+    // An empty block is the end-of-file marker, which readers compare byte-wise. Its compressed data depends on the
+    // codec and level (e.g. a stored block for level 0), so the marker is copied instead.
+    if (srcLength == 0)
+    {
+        std::ranges::copy(BGZF_END_OF_FILE_MARKER, dstBegin);
+        return BGZF_END_OF_FILE_MARKER.size();
+    }
+
     // 1. COPY HEADER
     std::ranges::copy(detail::bgzf_compression::magic_header, dstBegin);
 
     // 2. COMPRESS
-    compressInit(ctx);
-    ctx.strm.next_in = (Bytef *)(srcBegin);
-    ctx.strm.next_out = (Bytef *)(dstBegin + BLOCK_HEADER_LENGTH);
-    ctx.strm.avail_in = srcLength * sizeof(TSourceValue);
-    ctx.strm.avail_out = dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
-
-    int status = deflate(&ctx.strm, Z_FINISH);
-    if (status != Z_STREAM_END)
-    {
-        deflateEnd(&ctx.strm);
-        throw io_error("Deflation failed. Compressed BGZF data is too big.");
-    }
-
-    status = deflateEnd(&ctx.strm);
-    if (status != Z_OK)
-        throw io_error("BGZF deflateEnd() failed.");
+    size_t len = BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH +
+                 _bgzfDeflate(dstBegin + BLOCK_HEADER_LENGTH,
+                              dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH,
+                              srcBegin,
+                              srcLength * sizeof(TSourceValue),
+                              ctx);
 
 
     // 3. APPEND FOOTER
 
     // Set compressed length into buffer, compute CRC and write CRC into buffer.
 
-    size_t len = dstCapacity - ctx.strm.avail_out;
     _bgzfPack16(dstBegin + 16, len - 1);
 
     dstBegin += len - BLOCK_FOOTER_LENGTH;
-    _bgzfPack32(dstBegin, crc32(crc32(0u, NULL, 0u), (Bytef *)(srcBegin), srcLength * sizeof(TSourceValue)));
+    _bgzfPack32(dstBegin, _bgzfCrc32(srcBegin, srcLength * sizeof(TSourceValue)));
     _bgzfPack32(dstBegin + 4, srcLength * sizeof(TSourceValue));
 
-    return dstCapacity - ctx.strm.avail_out;
+    return len;
 }
 
 // ----------------------------------------------------------------------------
@@ -255,6 +335,54 @@ decompressInit(CompressionContext<detail::bgzf_compression> & ctx)
     ctx.headerPos = 0;
 }
 
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfInflate()
+// ----------------------------------------------------------------------------
+
+// Decompresses a raw DEFLATE stream (no zlib or gzip header) and returns the decompressed size.
+inline size_t
+_bgzfInflate(char * dst, size_t dstCapacity, void const * src, size_t srcLength,
+             CompressionContext<detail::bgzf_compression> & ctx)
+{
+#if SEQAN3_HAS_LIBDEFLATE
+    if (!ctx.decompressor)
+    {
+        ctx.decompressor.reset(libdeflate_alloc_decompressor());
+        if (!ctx.decompressor)
+            throw io_error("Calling libdeflate_alloc_decompressor() failed for BGZF file.");
+    }
+
+    size_t len = 0;
+    libdeflate_result result = libdeflate_deflate_decompress(ctx.decompressor.get(), src, srcLength,
+                                                             dst, dstCapacity, &len);
+    if (result == LIBDEFLATE_INSUFFICIENT_SPACE)
+        throw io_error("Inflation failed. Decompressed BGZF data is too big.");
+    if (result != LIBDEFLATE_SUCCESS)
+        throw io_error("Inflation failed. Invalid BGZF data.");
+
+    return len;
+#else
+    decompressInit(ctx);
+    ctx.strm.next_in = (Bytef *)(src);
+    ctx.strm.next_out = (Bytef *)(dst);
+    ctx.strm.avail_in = srcLength;
+    ctx.strm.avail_out = dstCapacity;
+
+    int status = inflate(&ctx.strm, Z_FINISH);
+    if (status != Z_STREAM_END)
+    {
+        inflateEnd(&ctx.strm);
+        throw io_error("Inflation failed. Decompressed BGZF data is too big.");
+    }
+
+    status = inflateEnd(&ctx.strm);
+    if (status != Z_OK)
+        throw io_error("BGZF inflateEnd() failed.");
+
+    return dstCapacity - ctx.strm.avail_out;
+#endif  // SEQAN3_HAS_LIBDEFLATE
+}
+
 // ----------------------------------------------------------------------------
 // Function _decompressBlock()
 // ----------------------------------------------------------------------------
@@ -285,38 +413,27 @@ _decompressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
 
     // 2. DECOMPRESS
 
-    decompressInit(ctx);
-    ctx.strm.next_in = (Bytef *)(srcBegin + BLOCK_HEADER_LENGTH);
-    ctx.strm.next_out = (Bytef *)(dstBegin);
-    ctx.strm.avail_in = srcLength - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
-    ctx.strm.avail_out = dstCapacity * sizeof(TDestValue);
-
-    int status = inflate(&ctx.strm, Z_FINISH);
-    if (status != Z_STREAM_END)
-    {
-        inflateEnd(&ctx.strm);
-        throw io_error("Inflation failed. Decompressed BGZF data is too big.");
-    }
-
-    status = inflateEnd(&ctx.strm);
-    if (status != Z_OK)
-        throw io_error("BGZF inflateEnd() failed.");
+    size_t len = _bgzfInflate(reinterpret_cast<char *>(dstBegin),
+                              dstCapacity * sizeof(TDestValue),
+                              srcBegin + BLOCK_HEADER_LENGTH,
+                              srcLength - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH,
+                              ctx);
 
 
     // 3. CHECK FOOTER
 
     // Check compressed length in buffer, compute CRC and compare with CRC in buffer.
 
-    unsigned crc = crc32(crc32(0u, NULL, 0u), (Bytef *)(dstBegin), dstCapacity - ctx.strm.avail_out);
+    unsigned crc = _bgzfCrc32(dstBegin, len);
 
     srcBegin += compressedLen - BLOCK_FOOTER_LENGTH;
     if (_bgzfUnpack32(srcBegin) != crc)
         throw io_error("BGZF wrong checksum.");
 
-    if (_bgzfUnpack32(srcBegin + 4) != dstCapacity - ctx.strm.avail_out)
+    if (_bgzfUnpack32(srcBegin + 4) != len)
         throw io_error("BGZF size mismatch.");
 
-    return (dstCapacity - ctx.strm.avail_out) / sizeof(TDestValue);
+    return len / sizeof(TDestValue);
 }
 
 }  // namespace seqan3::contrib
@@ -0,0 +1,199 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without ZSTD-support."
+#endif
+
+#include <zstd.h>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambuf
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>
+>
+class basic_zstd_istreambuf : public std::basic_streambuf<Elem, Tr>
+{
+    static_assert(sizeof(Elem) == 1, "The zstd streams only support streams over bytes.");
+
+public:
+    typedef std::basic_istream<Elem, Tr>& istream_reference;
+    typedef typename Tr::char_type        char_type;
+    typedef typename Tr::int_type         int_type;
+
+    static constexpr size_t MAX_PUTBACK = 4;
+
+    basic_zstd_istreambuf(istream_reference istream_) :
+        m_istream(istream_),
+        m_dctx(ZSTD_createDCtx()),
+        m_input_buffer(ZSTD_DStreamInSize()),
+        m_buffer(MAX_PUTBACK + ZSTD_DStreamOutSize())
+    {
+        if (m_dctx == nullptr)
+            throw io_error("Calling ZSTD_createDCtx() failed.");
+
+        this->setg(&m_buffer[0] + MAX_PUTBACK, &m_buffer[0] + MAX_PUTBACK, &m_buffer[0] + MAX_PUTBACK);
+    }
+
+    basic_zstd_istreambuf(basic_zstd_istreambuf const &) = delete;
+    basic_zstd_istreambuf & operator=(basic_zstd_istreambuf const &) = delete;
+
+    ~basic_zstd_istreambuf()
+    {
+        ZSTD_freeDCtx(m_dctx);
+    }
+
+    int_type underflow()
+    {
+        if (this->gptr() && this->gptr() < this->egptr())
+            return Tr::to_int_type(*this->gptr());
+
+        size_t putback = std::min<size_t>(this->gptr() - this->eback(), MAX_PUTBACK);
+        std::memmove(&m_buffer[0] + (MAX_PUTBACK - putback), this->gptr() - putback, putback);
+
+        size_t size = decompress(&m_buffer[0] + MAX_PUTBACK, m_buffer.size() - MAX_PUTBACK);
+        if (size == 0)
+            return Tr::eof();
+
+        this->setg(&m_buffer[0] + (MAX_PUTBACK - putback),  // beginning of putback area
+                   &m_buffer[0] + MAX_PUTBACK,              // read position
+                   &m_buffer[0] + MAX_PUTBACK + size);      // end of buffer
+
+        return Tr::to_int_type(*this->gptr());
+    }
+
+    // returns a reference to the input stream
+    istream_reference get_istream() { return m_istream; };
+
+private:
+    // Decompresses at least one byte into dst unless the input is exhausted; returns the number of bytes.
+    // Consecutive frames (e.g. of concatenated files) are decompressed as one stream.
+    size_t decompress(char_type * dst, size_t capacity)
+    {
+        ZSTD_outBuffer output{dst, capacity, 0};
+
+        while (output.pos == 0)
+        {
+            // if the last call filled the output buffer, the decompressor may still hold data
+            if (m_input.pos == m_input.size && !m_output_pending)
+            {
+                m_istream.read(&m_input_buffer[0], m_input_buffer.size());
+                m_input = ZSTD_inBuffer{&m_input_buffer[0], static_cast<size_t>(m_istream.gcount()), 0};
+
+                if (m_input.size == 0)
+                {
+                    if (m_frame_pending)
+                        throw io_error("Unexpected end of zstd compressed data.");
+                    return 0;
+                }
+            }
+
+            size_t const ret = ZSTD_decompressStream(m_dctx, &output, &m_input);
+            if (ZSTD_isError(ret))
+                throw io_error(std::string{"Decompressing zstd data failed: "} + ZSTD_getErrorName(ret));
+
+            m_frame_pending = ret != 0;
+            m_output_pending = output.pos == output.size;
+        }
+
+        return output.pos;
+    }
+
+    istream_reference      m_istream;
+    ZSTD_DCtx *            m_dctx;
+    std::vector<char_type> m_input_buffer;
+    std::vector<char_type> m_buffer;
+    ZSTD_inBuffer          m_input{nullptr, 0, 0};
+    bool                   m_frame_pending{false};
+    bool                   m_output_pending{false};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>
+>
+class basic_zstd_istreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>&   istream_reference;
+    typedef basic_zstd_istreambuf<Elem, Tr> zstd_streambuf_type;
+
+    basic_zstd_istreambase(istream_reference istream_)
+        : m_buf(istream_)
+    {
+        this->init(&m_buf);
+    };
+
+    // returns the underlying zstd streambuf
+    zstd_streambuf_type* rdbuf() { return &m_buf; };
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istream
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>
+>
+class basic_zstd_istream :
+    public basic_zstd_istreambase<Elem,Tr>,
+    public std::basic_istream<Elem,Tr>
+{
+public:
+    typedef basic_zstd_istreambase<Elem,Tr> zstd_istreambase_type;
+    typedef std::basic_istream<Elem,Tr>     istream_type;
+    typedef istream_type&                   istream_reference;
+
+    basic_zstd_istream(istream_reference istream_) :
+        zstd_istreambase_type(istream_),
+        istream_type(zstd_istreambase_type::rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+// --------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------
+
+// A typedef for basic_zstd_istream<char>
+typedef basic_zstd_istream<char> zstd_istream;
+
+} // namespace seqan3::contrib
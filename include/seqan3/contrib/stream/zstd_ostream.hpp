@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_ostream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without ZSTD-support."
+#endif
+
+#include <zstd.h>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A static variable indicating the number of threads to use for compressing zstd-streams.
+ *        Defaults to std::thread::hardware_concurrency. Has no effect if libzstd was built without multithreading.
+ */
+inline static uint64_t zstd_thread_count = std::thread::hardware_concurrency();
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambuf
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>
+>
+class basic_zstd_ostreambuf : public std::basic_streambuf<Elem, Tr>
+{
+    static_assert(sizeof(Elem) == 1, "The zstd streams only support streams over bytes.");
+
+public:
+    typedef std::basic_ostream<Elem, Tr>& ostream_reference;
+    typedef typename Tr::char_type        char_type;
+    typedef typename Tr::int_type         int_type;
+
+    basic_zstd_ostreambuf(ostream_reference ostream_, int level, size_t numThreads) :
+        m_ostream(ostream_),
+        m_cctx(ZSTD_createCCtx()),
+        m_buffer(ZSTD_CStreamInSize()),
+        m_output_buffer(ZSTD_CStreamOutSize())
+    {
+        if (m_cctx == nullptr)
+            throw io_error("Calling ZSTD_createCCtx() failed.");
+
+        set_compression_level(level);
+
+        // The frame is split into jobs that are compressed in parallel. This fails if libzstd was built without
+        // multithreading support, in which case the stream is compressed on the calling thread.
+        if (numThreads > 1)
+            ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_nbWorkers, static_cast<int>(numThreads));
+
+        this->setp(&m_buffer[0], &m_buffer[0] + (m_buffer.size() - 1));
+    }
+
+    basic_zstd_ostreambuf(basic_zstd_ostreambuf const &) = delete;
+    basic_zstd_ostreambuf & operator=(basic_zstd_ostreambuf const &) = delete;
+
+    ~basic_zstd_ostreambuf()
+    {
+        compress(ZSTD_e_end);
+        m_ostream.flush();
+        ZSTD_freeCCtx(m_cctx);
+    }
+
+    // sets the compression level of the frame; clamped to [1, ZSTD_maxCLevel()], s.t. 0 does not select the default
+    // level of libzstd. Must be called before the first bytes are compressed.
+    void set_compression_level(int level)
+    {
+        ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_compressionLevel, std::clamp(level, 1, ZSTD_maxCLevel()));
+    }
+
+    int_type overflow(int_type c)
+    {
+        if (!Tr::eq_int_type(c, Tr::eof()))
+        {
+            *this->pptr() = Tr::to_char_type(c);
+            this->pbump(1);
+        }
+
+        return compress(ZSTD_e_continue) ? Tr::not_eof(c) : Tr::eof();
+    }
+
+    // ends the current zstd block, s.t. all data written so far can be decompressed
+    int sync()
+    {
+        return compress(ZSTD_e_flush) ? 0 : -1;
+    }
+
+    // returns a reference to the output stream
+    ostream_reference get_ostream() const { return m_ostream; };
+
+private:
+    // Passes the put area to the compressor and writes the compressed bytes to the output stream.
+    // With ZSTD_e_continue, the compressor may keep data buffered; ZSTD_e_flush and ZSTD_e_end write all of it.
+    bool compress(ZSTD_EndDirective mode)
+    {
+        ZSTD_inBuffer input{this->pbase(), static_cast<size_t>(this->pptr() - this->pbase()), 0};
+
+        bool done = false;
+        while (!done)
+        {
+            ZSTD_outBuffer output{&m_output_buffer[0], m_output_buffer.size(), 0};
+            size_t const remaining = ZSTD_compressStream2(m_cctx, &output, &input, mode);
+
+            if (ZSTD_isError(remaining))
+                return false;
+
+            m_ostream.write(&m_output_buffer[0], output.pos);
+            done = (mode == ZSTD_e_continue) ? input.pos == input.size : remaining == 0;
+        }
+
+        this->setp(&m_buffer[0], &m_buffer[0] + (m_buffer.size() - 1));
+        return m_ostream.good();
+    }
+
+    ostream_reference      m_ostream;
+    ZSTD_CCtx *            m_cctx;
+    std::vector<char_type> m_buffer;
+    std::vector<char_type> m_output_buffer;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>
+>
+class basic_zstd_ostreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr>&     ostream_reference;
+    typedef basic_zstd_ostreambuf<Elem, Tr> zstd_streambuf_type;
+
+    basic_zstd_ostreambase(ostream_reference ostream_, int level, size_t numThreads)
+        : m_buf(ostream_, level, numThreads)
+    {
+        this->init(&m_buf);
+    };
+
+    // returns the underlying zstd streambuf
+    zstd_streambuf_type* rdbuf() { return &m_buf; };
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostream
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>
+>
+class basic_zstd_ostream :
+    public basic_zstd_ostreambase<Elem,Tr>,
+    public std::basic_ostream<Elem,Tr>
+{
+public:
+    typedef basic_zstd_ostreambase<Elem,Tr> zstd_ostreambase_type;
+    typedef std::basic_ostream<Elem,Tr>     ostream_type;
+    typedef ostream_type&                   ostream_reference;
+
+    basic_zstd_ostream(ostream_reference ostream_,
+                       int level = ZSTD_CLEVEL_DEFAULT,
+                       size_t numThreads = zstd_thread_count) :
+        zstd_ostreambase_type(ostream_, level, numThreads),
+        ostream_type(zstd_ostreambase_type::rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+// --------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------
+
+// A typedef for basic_zstd_ostream<char>
+typedef basic_zstd_ostream<char> zstd_ostream;
+
+} // namespace seqan3::contrib
@@ -20,8 +20,13 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/bam_input.hpp>
+#include <seqan3/io/alignment_file/bam_output.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/genomic_region.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
 #include <seqan3/io/alignment_file/input.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
@@ -0,0 +1,675 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup alignment_file
+ * \{
+ */
+
+//!\brief The position of a BAM record on its reference, as needed to index and query a BAM file.
+struct bam_record_span
+{
+    int32_t ref_id{-1};   //!< The reference id of the record; -1 if the record is unplaced.
+    int64_t begin{-1};    //!< The first (0-based) position of the alignment; -1 if the record is unplaced.
+    int64_t end{-1};      //!< The position behind the alignment (`begin + 1` for records without aligned bases).
+    bool unmapped{true};  //!< Whether the record is flagged as unmapped.
+};
+
+//!\brief Reads a value of `value_t` from the binary `stream`.
+//!\throws seqan3::unexpected_end_of_input if the stream ends before the value.
+template <typename value_t>
+inline value_t read_binary_value(std::istream & stream)
+{
+    value_t value{};
+    if (!stream.read(reinterpret_cast<char *>(&value), sizeof(value_t)))
+        throw unexpected_end_of_input{"Unexpected end of input while reading binary data."};
+    return value;
+}
+
+//!\brief Writes `value` to the binary `stream`.
+template <typename value_t>
+inline void write_binary_value(std::ostream & stream, value_t const value)
+{
+    stream.write(reinterpret_cast<char const *>(&value), sizeof(value_t));
+}
+
+/*!\brief Skips the header of a decompressed BAM stream.
+ * \returns The number of reference sequences.
+ * \throws seqan3::format_error if the stream is not in BAM format.
+ */
+inline int32_t skip_bam_header(std::istream & stream)
+{
+    std::array<char, 4> magic{};
+    if (!stream.read(magic.data(), magic.size()) || std::memcmp(magic.data(), "BAM\1", magic.size()) != 0)
+        throw format_error{"File is not in BAM format."};
+
+    auto skip = [&stream] (int32_t const count)
+    {
+        if (count < 0 || stream.ignore(count).gcount() != count)
+            throw format_error{"The header of the BAM file is corrupted."};
+    };
+
+    skip(read_binary_value<int32_t>(stream)); // header text
+
+    int32_t const n_ref = read_binary_value<int32_t>(stream);
+    if (n_ref < 0)
+        throw format_error{"The header of the BAM file is corrupted."};
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+        skip(read_binary_value<int32_t>(stream) + 4); // name and length
+
+    return n_ref;
+}
+
+/*!\brief Reads the position of the next record of a decompressed BAM stream, skipping the rest of the record.
+ * \param[in,out] stream The stream; must be at the beginning of a record.
+ * \param[out]    span   The position of the record.
+ * \param[in,out] buffer A buffer for the bytes of the record.
+ * \returns `false` if the stream is at its end.
+ * \throws seqan3::format_error if the record is corrupted.
+ */
+inline bool read_bam_record_span(std::istream & stream, bam_record_span & span, std::string & buffer)
+{
+    int32_t block_size{};
+    if (!stream.read(reinterpret_cast<char *>(&block_size), sizeof(block_size)))
+    {
+        if (stream.gcount() == 0)
+            return false;
+        throw unexpected_end_of_input{"Unexpected end of input while reading a BAM record."};
+    }
+
+    constexpr int32_t core_size = 32; // the fixed length fields after block_size
+    if (block_size < core_size)
+        throw format_error{"The BAM record is corrupted."};
+
+    buffer.resize(block_size);
+    if (!stream.read(buffer.data(), block_size))
+        throw unexpected_end_of_input{"Unexpected end of input while reading a BAM record."};
+
+    int32_t pos{};
+    uint16_t n_cigar_op{};
+    uint16_t flag{};
+    std::memcpy(&span.ref_id, buffer.data(), 4);
+    std::memcpy(&pos, buffer.data() + 4, 4);
+    uint8_t const l_read_name = static_cast<uint8_t>(buffer[8]);
+    std::memcpy(&n_cigar_op, buffer.data() + 12, 2);
+    std::memcpy(&flag, buffer.data() + 14, 2);
+
+    if (core_size + l_read_name + 4 * n_cigar_op > block_size)
+        throw format_error{"The BAM record is corrupted."};
+
+    // M, D, N, = and X consume the reference
+    int64_t ref_length{0};
+    for (size_t i = 0; i < n_cigar_op; ++i)
+    {
+        uint32_t op{};
+        std::memcpy(&op, buffer.data() + core_size + l_read_name + 4 * i, 4);
+        if ((op & 0xf) == 0 || (op & 0xf) == 2 || (op & 0xf) == 3 || (op & 0xf) == 7 || (op & 0xf) == 8)
+            ref_length += op >> 4;
+    }
+
+    span.unmapped = flag & 4;
+    span.begin = pos;
+    span.end = pos + ((span.unmapped || ref_length == 0) ? 1 : ref_length);
+    return true;
+}
+
+//!\}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+//!\brief A contiguous range of a BGZF-compressed file, given by the virtual offsets of its begin and end.
+//!\ingroup alignment_file
+struct bam_index_chunk
+{
+    //!\brief The virtual offset of the first record.
+    uint64_t begin{};
+    //!\brief The virtual offset behind the last record.
+    uint64_t end{};
+
+    //!\brief Two chunks are equal if begin and end are equal.
+    friend bool operator==(bam_index_chunk const & lhs, bam_index_chunk const & rhs) noexcept
+    {
+        return lhs.begin == rhs.begin && lhs.end == rhs.end;
+    }
+
+    //!\brief Two chunks are unequal if begin or end are unequal.
+    friend bool operator!=(bam_index_chunk const & lhs, bam_index_chunk const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/*!\brief The index of a coordinate-sorted, BGZF-compressed BAM file (`.bai` or `.csi`) for region queries.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The index assigns every record to the smallest bin of a hierarchical binning scheme that contains its alignment and
+ * stores, for each bin, the chunks of the file that hold its records as virtual offsets of the BGZF file (the offset
+ * of the compressed block shifted left by 16 bits plus the offset in the uncompressed block). Additionally, it stores
+ * the lowest virtual offset of the records that overlap each window of `2^min_shift` positions. A query for a region
+ * therefore yields the few chunks of the file that can contain overlapping records, s.t. only these need to be
+ * decompressed (see seqan3::alignment_file_input::set_region).
+ *
+ * The BAI format uses a fixed binning scheme (`min_shift` 14 and `depth` 5) and is limited to references of at most
+ * 2^29 positions. The CSI format stores the binning scheme and supports longer references.
+ *
+ * The index is built from a BAM file or read from a `.bai` or `.csi` file:
+ *
+ * \include test/snippet/io/alignment_file/bam_index.cpp
+ */
+class bam_index
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index() = default;                              //!< Defaulted.
+    bam_index(bam_index const &) = default;             //!< Defaulted.
+    bam_index(bam_index &&) = default;                  //!< Defaulted.
+    bam_index & operator=(bam_index const &) = default; //!< Defaulted.
+    bam_index & operator=(bam_index &&) = default;      //!< Defaulted.
+    ~bam_index() = default;                             //!< Defaulted.
+
+    /*!\brief Builds the index of the BAM file in `bam_stream`.
+     * \param[in] bam_stream A BGZF-compressed BAM file whose records are sorted by coordinate.
+     * \param[in] min_shift  The number of bits of the positions of the smallest bins (14 for BAI).
+     * \param[in] depth      The number of levels of the binning scheme below the root bin (5 for BAI).
+     * \throws seqan3::format_error if the file is not a BGZF-compressed BAM file, its records are not sorted by
+     *         coordinate or the binning scheme is invalid.
+     */
+    explicit bam_index(std::istream & bam_stream, uint32_t const min_shift = 14, uint32_t const depth = 5) :
+        binning_shift{min_shift}, binning_depth{depth}
+    {
+#ifdef SEQAN3_HAS_ZLIB
+        check_binning();
+
+        auto decompressed = detail::make_secondary_istream(bam_stream);
+        auto * bgzf_stream = dynamic_cast<contrib::bgzf_istream *>(decompressed.get());
+        if (bgzf_stream == nullptr)
+            throw format_error{"Only BGZF-compressed BAM files can be indexed."};
+
+        references.resize(detail::skip_bam_header(*bgzf_stream));
+        unplaced_count = 0;
+
+        auto tell = [bgzf_stream] ()
+        {
+            std::streamoff const offset = bgzf_stream->tellg();
+            if (offset < 0)
+                throw io_error{"Could not determine the virtual offset in the BAM file."};
+            return static_cast<uint64_t>(offset);
+        };
+
+        detail::bam_record_span span{};
+        std::string buffer{};
+        int32_t previous_ref_id{0};
+        int64_t previous_begin{0};
+
+        for (uint64_t record_begin = tell(); detail::read_bam_record_span(*bgzf_stream, span, buffer); )
+        {
+            uint64_t const record_end = tell();
+
+            if (span.ref_id < 0 || span.begin < 0) // unplaced records are stored at the end
+            {
+                ++*unplaced_count;
+            }
+            else if (*unplaced_count > 0 || span.ref_id < previous_ref_id ||
+                     (span.ref_id == previous_ref_id && span.begin < previous_begin))
+            {
+                throw format_error{"The BAM file is not sorted by coordinate; it cannot be indexed."};
+            }
+            else if (static_cast<size_t>(span.ref_id) >= references.size())
+            {
+                throw format_error{"The reference id of a record is not part of the BAM header."};
+            }
+            else
+            {
+                add_record(references[span.ref_id], span, bam_index_chunk{record_begin, record_end});
+                previous_ref_id = span.ref_id;
+                previous_begin = span.begin;
+            }
+
+            record_begin = record_end;
+        }
+
+        for (reference_type & reference : references)
+        {
+            // windows without records get the offset of the previous window
+            uint64_t previous{0};
+            for (uint64_t & offset : reference.intervals)
+                previous = offset = (offset == no_offset) ? previous : offset;
+
+            assign_bin_offsets(reference);
+        }
+#else
+        (void) bam_stream;
+        throw file_open_error{"Indexing a BAM file requires ZLIB."};
+#endif
+    }
+    //!\}
+
+    /*!\name Index files
+     * \{
+     */
+    /*!\brief Reads a BAI or CSI index; the format is detected from the content.
+     * \param[in] index_stream The `.bai` or `.csi` file.
+     * \throws seqan3::format_error if the stream contains neither a BAI nor a CSI index.
+     * \throws seqan3::unexpected_end_of_input if the index is truncated.
+     */
+    static bam_index read(std::istream & index_stream)
+    {
+        auto decompressed = detail::make_secondary_istream(index_stream); // a CSI index is BGZF-compressed
+        std::istream & stream = *decompressed;
+
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+        bool const is_csi = std::memcmp(magic.data(), "CSI\1", magic.size()) == 0;
+        if (!stream || (!is_csi && std::memcmp(magic.data(), "BAI\1", magic.size()) != 0))
+            throw format_error{"The file is neither a BAI nor a CSI index."};
+
+        auto read_count = [&stream] ()
+        {
+            int32_t const count = detail::read_binary_value<int32_t>(stream);
+            if (count < 0)
+                throw format_error{"The BAM index is corrupted."};
+            return static_cast<size_t>(count);
+        };
+
+        bam_index index{};
+        if (is_csi)
+        {
+            index.binning_shift = static_cast<uint32_t>(read_count());
+            index.binning_depth = static_cast<uint32_t>(read_count());
+            index.check_binning();
+            index.auxiliary_data.resize(read_count());
+            if (!stream.read(index.auxiliary_data.data(), index.auxiliary_data.size()))
+                throw unexpected_end_of_input{"Unexpected end of input while reading the BAM index."};
+        }
+
+        index.references.resize(read_count());
+        for (reference_type & reference : index.references)
+        {
+            for (size_t bin_count = read_count(); bin_count > 0; --bin_count)
+            {
+                uint32_t const bin = detail::read_binary_value<uint32_t>(stream);
+                bin_type entry{};
+                if (is_csi)
+                    entry.loffset = detail::read_binary_value<uint64_t>(stream);
+
+                entry.chunks.resize(read_count());
+                for (bam_index_chunk & chunk : entry.chunks)
+                {
+                    chunk.begin = detail::read_binary_value<uint64_t>(stream);
+                    chunk.end = detail::read_binary_value<uint64_t>(stream);
+                }
+
+                if (bin == index.pseudo_bin())
+                {
+                    if (entry.chunks.size() != 2)
+                        throw format_error{"The BAM index is corrupted."};
+                    reference.metadata = {entry.chunks[0].begin, entry.chunks[0].end,
+                                          entry.chunks[1].begin, entry.chunks[1].end};
+                }
+                else
+                {
+                    reference.bins[bin] = std::move(entry);
+                }
+            }
+
+            if (!is_csi)
+            {
+                reference.intervals.resize(read_count());
+                for (uint64_t & offset : reference.intervals)
+                    offset = detail::read_binary_value<uint64_t>(stream);
+                index.assign_bin_offsets(reference);
+            }
+        }
+
+        // the number of unplaced records is optional
+        uint64_t count{};
+        if (stream.read(reinterpret_cast<char *>(&count), sizeof(count)))
+            index.unplaced_count = count;
+
+        return index;
+    }
+
+    /*!\brief Writes the index as BAI file.
+     * \throws seqan3::format_error if the index does not use the binning scheme of BAI.
+     */
+    void write_bai(std::ostream & index_stream) const
+    {
+        if (binning_shift != 14 || binning_depth != 5)
+            throw format_error{"A BAI index requires a min_shift of 14 and a depth of 5; write a CSI index instead."};
+
+        index_stream.write("BAI\1", 4);
+        write_references(index_stream, false);
+    }
+
+    //!\brief Writes the index as BGZF-compressed CSI file.
+    void write_csi(std::ostream & index_stream) const
+    {
+#ifdef SEQAN3_HAS_ZLIB
+        contrib::bgzf_ostream stream{index_stream};
+        stream.write("CSI\1", 4);
+        detail::write_binary_value<int32_t>(stream, binning_shift);
+        detail::write_binary_value<int32_t>(stream, binning_depth);
+        detail::write_binary_value<int32_t>(stream, auxiliary_data.size());
+        stream.write(auxiliary_data.data(), auxiliary_data.size());
+        write_references(stream, true);
+#else
+        (void) index_stream;
+        throw file_open_error{"Writing a CSI index requires ZLIB."};
+#endif
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    //!\brief The number of bits of the positions of the smallest bins.
+    uint32_t min_shift() const noexcept
+    {
+        return binning_shift;
+    }
+
+    //!\brief The number of levels of the binning scheme below the root bin.
+    uint32_t depth() const noexcept
+    {
+        return binning_depth;
+    }
+
+    //!\brief The number of reference sequences.
+    size_t reference_count() const noexcept
+    {
+        return references.size();
+    }
+
+    //!\brief The number of records without a position, if the index stores it.
+    std::optional<uint64_t> unplaced_record_count() const noexcept
+    {
+        return unplaced_count;
+    }
+
+    /*!\brief The chunks of the file that contain all records overlapping `[begin, end)` of a reference.
+     * \param[in] reference_index The position of the reference in the header of the BAM file.
+     * \param[in] begin           The first (0-based) position of the region.
+     * \param[in] end             The position behind the region.
+     * \returns The chunks sorted by their begin; overlapping and adjacent chunks are merged.
+     *
+     * \details
+     *
+     * The chunks may also contain records that do not overlap the region; they need to be filtered when reading.
+     */
+    std::vector<bam_index_chunk> query(size_t const reference_index, uint64_t const begin, uint64_t end) const
+    {
+        std::vector<bam_index_chunk> result{};
+
+        end = std::min(end, uint64_t{1} << (binning_shift + 3 * binning_depth));
+        if (reference_index >= references.size() || begin >= end)
+            return result;
+
+        reference_type const & reference = references[reference_index];
+        uint64_t const min_offset = lowest_offset(reference, begin);
+
+        // the bins that overlap the region on each level
+        uint32_t shift = binning_shift + 3 * binning_depth;
+        for (uint32_t level = 0; level <= binning_depth; ++level, shift -= 3)
+        {
+            auto const last = reference.bins.upper_bound(level_offset(level) + ((end - 1) >> shift));
+            for (auto it = reference.bins.lower_bound(level_offset(level) + (begin >> shift)); it != last; ++it)
+                for (bam_index_chunk const & chunk : it->second.chunks)
+                    if (chunk.end > min_offset)
+                        result.push_back(chunk);
+        }
+
+        std::sort(result.begin(), result.end(), [] (auto const & lhs, auto const & rhs)
+        {
+            return lhs.begin < rhs.begin;
+        });
+
+        size_t merged = 0;
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            if (merged > 0 && result[i].begin <= result[merged - 1].end)
+                result[merged - 1].end = std::max(result[merged - 1].end, result[i].end);
+            else
+                result[merged++] = result[i];
+        }
+        result.resize(merged);
+
+        return result;
+    }
+    //!\}
+
+    //!\brief Two indices are equal if they store the same bins, chunks, offsets and counts.
+    friend bool operator==(bam_index const & lhs, bam_index const & rhs) noexcept
+    {
+        return lhs.binning_shift == rhs.binning_shift && lhs.binning_depth == rhs.binning_depth &&
+               lhs.auxiliary_data == rhs.auxiliary_data && lhs.references == rhs.references &&
+               lhs.unplaced_count == rhs.unplaced_count;
+    }
+
+    //!\brief Two indices are unequal if they differ in any bin, chunk, offset or count.
+    friend bool operator!=(bam_index const & lhs, bam_index const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    //!\brief The chunks of a bin.
+    struct bin_type
+    {
+        //!\brief The lowest virtual offset of the records overlapping the first window of the bin.
+        uint64_t loffset{};
+        //!\brief The chunks of the records in the bin.
+        std::vector<bam_index_chunk> chunks{};
+
+        //!\brief Two bins are equal if their offsets and chunks are equal.
+        friend bool operator==(bin_type const & lhs, bin_type const & rhs) noexcept
+        {
+            return lhs.loffset == rhs.loffset && lhs.chunks == rhs.chunks;
+        }
+    };
+
+    //!\brief The index of a reference sequence.
+    struct reference_type
+    {
+        //!\brief The non-empty bins.
+        std::map<uint32_t, bin_type> bins{};
+        //!\brief The lowest virtual offset of the records overlapping each window of `2^min_shift` positions.
+        std::vector<uint64_t> intervals{};
+        //!\brief The begin and end of the records of the reference and the number of mapped and unmapped records.
+        std::optional<std::array<uint64_t, 4>> metadata{};
+
+        //!\brief Two references are equal if their bins, windows and metadata are equal.
+        friend bool operator==(reference_type const & lhs, reference_type const & rhs) noexcept
+        {
+            return lhs.bins == rhs.bins && lhs.intervals == rhs.intervals && lhs.metadata == rhs.metadata;
+        }
+    };
+
+    //!\brief Marks windows without records while building the index.
+    static constexpr uint64_t no_offset = std::numeric_limits<uint64_t>::max();
+
+    //!\brief The number of bits of the positions of the smallest bins.
+    uint32_t binning_shift{14};
+    //!\brief The number of levels of the binning scheme below the root bin.
+    uint32_t binning_depth{5};
+    //!\brief The auxiliary data of a CSI index.
+    std::string auxiliary_data{};
+    //!\brief The index of each reference sequence.
+    std::vector<reference_type> references{};
+    //!\brief The number of records without a position.
+    std::optional<uint64_t> unplaced_count{};
+
+    //!\brief Throws seqan3::format_error if the binning scheme cannot be represented.
+    void check_binning() const
+    {
+        if (binning_depth > 9 || binning_shift < 1 || binning_shift + 3 * binning_depth > 62)
+            throw format_error{"Invalid binning scheme of the BAM index (min_shift " + std::to_string(binning_shift) +
+                               ", depth " + std::to_string(binning_depth) + ")."};
+    }
+
+    //!\brief The number of bins on the levels above `level`.
+    static constexpr uint32_t level_offset(uint32_t const level) noexcept
+    {
+        return ((uint32_t{1} << (3 * level)) - 1) / 7;
+    }
+
+    //!\brief The bin that stores the metadata of a reference (37450 for BAI).
+    uint32_t pseudo_bin() const noexcept
+    {
+        return level_offset(binning_depth + 1) + 1;
+    }
+
+    //!\brief The smallest bin that contains `[begin, end)`.
+    uint32_t region_to_bin(uint64_t const begin, uint64_t const end) const noexcept
+    {
+        uint32_t shift = binning_shift;
+        for (uint32_t level = binning_depth; level > 0; --level, shift += 3)
+            if (begin >> shift == (end - 1) >> shift)
+                return level_offset(level) + (begin >> shift);
+        return 0;
+    }
+
+    //!\brief The first position of `bin`.
+    uint64_t bin_begin(uint32_t const bin) const noexcept
+    {
+        uint32_t level = 0;
+        while (level < binning_depth && bin >= level_offset(level + 1))
+            ++level;
+        return uint64_t{bin - level_offset(level)} << (binning_shift + 3 * (binning_depth - level));
+    }
+
+    //!\brief A lower bound of the virtual offsets of the records that overlap `position` or lie behind it.
+    uint64_t lowest_offset(reference_type const & reference, uint64_t const position) const
+    {
+        if (!reference.intervals.empty())
+            return reference.intervals[std::min<uint64_t>(position >> binning_shift, reference.intervals.size() - 1)];
+
+        // CSI: the offset of the smallest bin that contains the position
+        uint32_t shift = binning_shift;
+        for (uint32_t level = binning_depth; ; --level, shift += 3)
+        {
+            auto const it = reference.bins.find(level_offset(level) + (position >> shift));
+            if (it != reference.bins.end())
+                return it->second.loffset;
+            if (level == 0)
+                return 0;
+        }
+    }
+
+    //!\brief Adds the record at `chunk` with position `span` to `reference`.
+    void add_record(reference_type & reference, detail::bam_record_span const & span, bam_index_chunk const & chunk)
+    {
+        if (static_cast<uint64_t>(span.end) > (uint64_t{1} << (binning_shift + 3 * binning_depth)))
+            throw format_error{"A record lies behind the positions covered by the binning scheme of the index; "
+                               "increase the depth (CSI index)."};
+
+        std::vector<bam_index_chunk> & chunks = reference.bins[region_to_bin(span.begin, span.end)].chunks;
+        if (!chunks.empty() && chunks.back().end == chunk.begin)
+            chunks.back().end = chunk.end;
+        else
+            chunks.push_back(chunk);
+
+        uint64_t const last_window = (span.end - 1) >> binning_shift;
+        if (reference.intervals.size() <= last_window)
+            reference.intervals.resize(last_window + 1, no_offset);
+        for (uint64_t window = span.begin >> binning_shift; window <= last_window; ++window)
+            reference.intervals[window] = std::min(reference.intervals[window], chunk.begin);
+
+        if (!reference.metadata)
+            reference.metadata = {chunk.begin, chunk.end, 0, 0};
+        (*reference.metadata)[1] = chunk.end;
+        ++(*reference.metadata)[span.unmapped ? 3 : 2];
+    }
+
+    //!\brief Sets the offset of each bin of `reference` from its windows.
+    void assign_bin_offsets(reference_type & reference) const
+    {
+        for (auto & [bin, entry] : reference.bins)
+        {
+            uint64_t const window = bin_begin(bin) >> binning_shift;
+            entry.loffset = (window < reference.intervals.size()) ? reference.intervals[window] : 0;
+        }
+    }
+
+    //!\brief Writes the references in the BAI or CSI format.
+    void write_references(std::ostream & stream, bool const is_csi) const
+    {
+        detail::write_binary_value<int32_t>(stream, references.size());
+        for (reference_type const & reference : references)
+        {
+            detail::write_binary_value<int32_t>(stream, reference.bins.size() + reference.metadata.has_value());
+
+            auto write_bin = [&] (uint32_t const bin, uint64_t const loffset, auto const & chunks)
+            {
+                detail::write_binary_value<uint32_t>(stream, bin);
+                if (is_csi)
+                    detail::write_binary_value<uint64_t>(stream, loffset);
+                detail::write_binary_value<int32_t>(stream, chunks.size());
+                for (bam_index_chunk const & chunk : chunks)
+                {
+                    detail::write_binary_value<uint64_t>(stream, chunk.begin);
+                    detail::write_binary_value<uint64_t>(stream, chunk.end);
+                }
+            };
+
+            for (auto const & [bin, entry] : reference.bins)
+                write_bin(bin, entry.loffset, entry.chunks);
+
+            if (reference.metadata)
+            {
+                auto const & [first, last, mapped, unmapped] = *reference.metadata;
+                write_bin(pseudo_bin(), 0, std::array{bam_index_chunk{first, last}, bam_index_chunk{mapped, unmapped}});
+            }
+
+            if (!is_csi)
+            {
+                detail::write_binary_value<int32_t>(stream, reference.intervals.size());
+                for (uint64_t const offset : reference.intervals)
+                    detail::write_binary_value<uint64_t>(stream, offset);
+            }
+        }
+
+        if (unplaced_count)
+            detail::write_binary_value<uint64_t>(stream, *unplaced_count);
+    }
+};
+
+} // namespace seqan3
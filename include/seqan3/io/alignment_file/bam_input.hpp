@@ -0,0 +1,241 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_file_input.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/header.hpp>
+#include <seqan3/io/detail/in_file_iterator.hpp>
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/concept.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A BAM file whose records are read as seqan3::bam_record, i.e. without decoding their fields.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * This file reads the header of a BAM file like seqan3::alignment_file_input, but each record is only copied into a
+ * seqan3::bam_record whose fields are decoded when they are accessed. Reading a record therefore costs little more than
+ * decompressing it, regardless of which fields are used later on. Together with seqan3::bam_file_output, records
+ * can be filtered and written without decoding or re-encoding them.
+ *
+ * The header is read on construction. As for seqan3::alignment_file_input, compressed files (BGZF, GZip and BZip2)
+ * are detected and decompressed transparently.
+ *
+ * \include test/snippet/io/alignment_file/bam_record.cpp
+ */
+class bam_file_input
+{
+public:
+    /*!\name Range associated types
+     * \{
+     */
+    using value_type      = bam_record;                               //!< The type of a record.
+    using reference       = bam_record &;                             //!< The reference type.
+    using const_reference = void;                                     //!< Not const-iterable.
+    using size_type       = size_t;                                   //!< An unsigned integer type.
+    using difference_type = std::make_signed_t<size_t>;               //!< A signed integer type.
+    using iterator        = detail::in_file_iterator<bam_file_input>; //!< The iterator type.
+    using const_iterator  = void;                                     //!< Not const-iterable.
+    using sentinel        = std::ranges::default_sentinel_t;          //!< The type returned by end().
+    //!\}
+
+    //!\brief The type of the header.
+    using header_type = alignment_file_header<>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_file_input() = delete;                                   //!< Deleted.
+    bam_file_input(bam_file_input const &) = delete;             //!< Deleted.
+    bam_file_input & operator=(bam_file_input const &) = delete; //!< Deleted.
+    bam_file_input(bam_file_input &&) = default;                 //!< Defaulted.
+    bam_file_input & operator=(bam_file_input &&) = default;     //!< Defaulted.
+    ~bam_file_input() = default;                                 //!< Defaulted.
+
+    /*!\brief Opens the file at `filename` and reads its header.
+     * \param[in] filename Path to the BAM file.
+     * \throws seqan3::file_open_error if the file could not be opened.
+     * \throws seqan3::format_error if the file does not begin with a valid BAM header.
+     */
+    explicit bam_file_input(std::filesystem::path filename) :
+        primary_stream{new std::ifstream{filename, std::ios_base::in | std::ios::binary}, stream_deleter_default}
+    {
+        if (!primary_stream->good())
+            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+        secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
+        read_header();
+    }
+
+    /*!\brief Reads from an existing stream and reads the header.
+     * \tparam stream_t The stream type; must model seqan3::input_stream.
+     * \param[in] stream The stream to read from; compressed streams are decompressed transparently.
+     * \throws seqan3::format_error if the stream does not begin with a valid BAM header.
+     */
+    template <input_stream stream_t>
+    //!\cond
+        requires std::same_as<typename std::remove_reference_t<stream_t>::char_type, char>
+    //!\endcond
+    explicit bam_file_input(stream_t & stream) :
+        primary_stream{&stream, stream_deleter_noop}
+    {
+        secondary_stream = detail::make_secondary_istream(*primary_stream);
+        read_header();
+    }
+
+    //!\overload
+    template <input_stream stream_t>
+    //!\cond
+        requires std::same_as<typename std::remove_reference_t<stream_t>::char_type, char>
+    //!\endcond
+    explicit bam_file_input(stream_t && stream) :
+        primary_stream{new stream_t{std::move(stream)}, stream_deleter_default}
+    {
+        secondary_stream = detail::make_secondary_istream(*primary_stream);
+        read_header();
+    }
+    //!\}
+
+    /*!\name Range interface
+     * \{
+     */
+    //!\brief Returns an iterator to the current record; reads the first record on the first call.
+    iterator begin()
+    {
+        if (!first_record_was_read)
+        {
+            read_next_record();
+            first_record_was_read = true;
+        }
+
+        return {*this};
+    }
+
+    //!\brief Returns a sentinel for comparison with iterator.
+    sentinel end() noexcept
+    {
+        return {};
+    }
+
+    //!\brief Returns the current record.
+    reference front()
+    {
+        return *begin();
+    }
+    //!\}
+
+    //!\brief The header of the file; the reference ids of the records are indices into `header().ref_ids()`.
+    header_type & header() noexcept
+    {
+        return *header_ptr;
+    }
+
+protected:
+    //!\privatesection
+    /*!\name Stream / file access
+     * \{
+     */
+    //!\brief The type of the internal stream pointers. Allows dynamically setting ownership management.
+    using stream_ptr_t = std::unique_ptr<std::istream, std::function<void(std::istream *)>>;
+    //!\brief Stream deleter that does nothing (no ownership assumed).
+    static void stream_deleter_noop(std::istream *) {}
+    //!\brief Stream deleter with default behaviour (ownership assumed).
+    static void stream_deleter_default(std::istream * ptr) { delete ptr; }
+
+    //!\brief The primary stream is the user provided stream or the file stream if constructed from filename.
+    stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
+    //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
+    stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\}
+
+    //!\brief The file header object.
+    std::unique_ptr<header_type> header_ptr{new header_type{}};
+    //!\brief The current record.
+    bam_record record_buffer{};
+    //!\brief Tracks whether the very first record is buffered when calling begin().
+    bool first_record_was_read{false};
+    //!\brief File is at position 1 behind the last record.
+    bool at_end{false};
+
+    //!\brief Reads the header of the file.
+    void read_header()
+    {
+        detail::format_bam_exposer format{};
+        std::ranges::subrange<std::istreambuf_iterator<char>, std::istreambuf_iterator<char>> stream_view
+        {
+            std::istreambuf_iterator<char>{*secondary_stream}, std::istreambuf_iterator<char>{}
+        };
+
+        format.read_bam_header(stream_view, *header_ptr, std::ignore);
+    }
+
+    //!\brief Copies the bytes of the next record into the record buffer.
+    void read_next_record()
+    {
+        std::streambuf & buffer = *secondary_stream->rdbuf();
+        std::string & data = record_buffer.data;
+
+        int32_t block_size{};
+        std::streamsize const read_bytes = buffer.sgetn(reinterpret_cast<char *>(&block_size), sizeof(block_size));
+
+        if (read_bytes == 0)
+        {
+            at_end = true;
+            return;
+        }
+        else if (read_bytes != sizeof(block_size))
+        {
+            throw unexpected_end_of_input{"The BAM file ended in the middle of a record."};
+        }
+        else if (block_size < 0)
+        {
+            throw format_error{"The BAM record is invalid: its block_size is negative."};
+        }
+
+        data.resize(sizeof(block_size) + block_size);
+        std::memcpy(data.data(), &block_size, sizeof(block_size));
+
+        if (buffer.sgetn(data.data() + sizeof(block_size), block_size) != block_size)
+            throw unexpected_end_of_input{"The BAM file ended in the middle of a record."};
+
+        record_buffer.validate();
+
+        if (std::optional<int32_t> const ref_id = record_buffer.ref_id();
+            ref_id && static_cast<size_t>(*ref_id) >= header_ptr->ref_ids().size()) // [[unlikely]]
+        {
+            throw format_error{"Reference id index '" + std::to_string(*ref_id) + "' is not in range of "
+                               "header.ref_ids(), which has size " + std::to_string(header_ptr->ref_ids().size()) +
+                               "."};
+        }
+    }
+
+    //!\brief Befriend iterator so it can access the buffers.
+    friend iterator;
+};
+
+} // namespace seqan3
@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_file_output.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/header.hpp>
+#include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/detail/misc_output.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/concept.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A BAM file that writes seqan3::bam_record byte by byte, i.e. without encoding their fields.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The header is written on construction; the records are then appended as they were read by a seqan3::bam_file_input.
+ * The reference ids of the records are not translated, so the header must list the references in the same order as
+ * the header of the file the records were read from (usually, it is that header).
+ *
+ * If constructed from a filename ending in `.bam`, the file is BGZF-compressed as with seqan3::alignment_file_output.
+ *
+ * \include test/snippet/io/alignment_file/bam_record.cpp
+ */
+class bam_file_output
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_file_output() = delete;                                    //!< Deleted.
+    bam_file_output(bam_file_output const &) = delete;             //!< Deleted.
+    bam_file_output & operator=(bam_file_output const &) = delete; //!< Deleted.
+    bam_file_output(bam_file_output &&) = default;                 //!< Defaulted.
+    bam_file_output & operator=(bam_file_output &&) = default;     //!< Defaulted.
+    ~bam_file_output() = default;                                  //!< Defaulted.
+
+    /*!\brief Opens the file at `filename` and writes the header.
+     * \tparam ref_ids_type The type of the reference ids of the header.
+     * \param[in] filename Path to the file; a `.bam` extension selects BGZF compression.
+     * \param[in] header   The header to write.
+     * \param[in] options  The options of the SAM header text and the compression level. [optional]
+     * \throws seqan3::file_open_error if the file could not be opened.
+     */
+    template <typename ref_ids_type>
+    bam_file_output(std::filesystem::path filename,
+                    alignment_file_header<ref_ids_type> & header,
+                    alignment_file_output_options const & options = alignment_file_output_options{}) :
+        primary_stream{new std::ofstream{filename, std::ios_base::out | std::ios::binary}, stream_deleter_default}
+    {
+        if (!primary_stream->good())
+            throw file_open_error{"Could not open file " + filename.string() + " for writing."};
+
+        secondary_stream = detail::make_secondary_ostream(*primary_stream, filename);
+        detail::set_compression_level(*secondary_stream, options.compression_level);
+        detail::format_bam_exposer{}.write_bam_header(*secondary_stream, options, header);
+    }
+
+    /*!\brief Writes to an existing stream; starts by writing the header.
+     * \tparam stream_t     The stream type; must model seqan3::output_stream.
+     * \tparam ref_ids_type The type of the reference ids of the header.
+     * \param[out] stream  The stream to write to; no compression is applied.
+     * \param[in]  header  The header to write.
+     * \param[in]  options The options of the SAM header text. [optional]
+     */
+    template <output_stream stream_t, typename ref_ids_type>
+    //!\cond
+        requires std::same_as<typename std::remove_reference_t<stream_t>::char_type, char>
+    //!\endcond
+    bam_file_output(stream_t & stream,
+                    alignment_file_header<ref_ids_type> & header,
+                    alignment_file_output_options const & options = alignment_file_output_options{}) :
+        primary_stream{&stream, stream_deleter_noop},
+        secondary_stream{&stream, stream_deleter_noop}
+    {
+        detail::format_bam_exposer{}.write_bam_header(*secondary_stream, options, header);
+    }
+    //!\}
+
+    /*!\name Writing records
+     * \{
+     */
+    //!\brief Appends the bytes of `record` to the file.
+    void push_back(bam_record const & record)
+    {
+        std::string_view const data = record.raw_data();
+        secondary_stream->write(data.data(), data.size());
+    }
+
+    /*!\brief Appends all records of a range to the file.
+     * \tparam rng_t The type of the range; must model std::ranges::input_range over seqan3::bam_record.
+     * \param[in] range The records to write.
+     */
+    template <std::ranges::input_range rng_t>
+    //!\cond
+        requires std::same_as<remove_cvref_t<reference_t<rng_t>>, bam_record>
+    //!\endcond
+    bam_file_output & operator=(rng_t && range)
+    {
+        for (auto && record : range)
+            push_back(record);
+
+        return *this;
+    }
+    //!\}
+
+protected:
+    //!\privatesection
+    /*!\name Stream / file access
+     * \{
+     */
+    //!\brief The type of the internal stream pointers. Allows dynamically setting ownership management.
+    using stream_ptr_t = std::unique_ptr<std::ostream, std::function<void(std::ostream *)>>;
+    //!\brief Stream deleter that does nothing (no ownership assumed).
+    static void stream_deleter_noop(std::ostream *) {}
+    //!\brief Stream deleter with default behaviour (ownership assumed).
+    static void stream_deleter_default(std::ostream * ptr) { delete ptr; }
+
+    //!\brief The primary stream is the user provided stream or the file stream if constructed from filename.
+    stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
+    //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
+    stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\}
+};
+
+} // namespace seqan3
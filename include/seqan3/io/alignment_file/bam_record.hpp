@@ -0,0 +1,349 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_record.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/alignment_file/format_bam.hpp>
+#include <seqan3/io/alignment_file/misc.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/detail/memory_streambuf.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/range/views/take_exactly.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+//!\brief Exposes the BAM header, CIGAR and tag handling of seqan3::format_bam to the raw BAM records and files.
+//!\ingroup alignment_file
+struct format_bam_exposer : public format_bam
+{
+    using format_bam::read_bam_header;
+    using format_bam::write_bam_header;
+    using format_bam::read_tags;
+    using format_bam::parse_binary_cigar;
+    using format_bam::parse_cigar;
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+class bam_file_input;
+
+/*!\brief A BAM record that keeps the raw bytes of the record and decodes its fields only when they are accessed.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * seqan3::alignment_file_input decodes every selected field of every record when reading it. A bam_record instead
+ * stores the binary record as read from the file (see seqan3::bam_file_input):
+ *
+ *   * the fixed-size fields (e.g. flag(), mapq(), ref_id() and ref_offset()) and the id() are read directly from the
+ *     bytes without any conversion,
+ *   * the sequence() and base_qualities() are views that convert the bases and qualities when they are accessed,
+ *   * the cigar_vector() and the tags() are only decoded when the member function is called.
+ *
+ * Records that are written to a seqan3::bam_file_output are copied byte by byte, so tasks like filtering a file by
+ * flag or mapping quality neither decode nor re-encode the records.
+ *
+ * The views returned by sequence() and base_qualities() refer to the bytes of the record; they are invalidated if the
+ * record is assigned or destroyed, e.g. when a seqan3::bam_file_input reads the next record into it.
+ *
+ * \include test/snippet/io/alignment_file/bam_record.cpp
+ */
+class bam_record
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record() = default;                               //!< Defaulted.
+    bam_record(bam_record const &) = default;             //!< Defaulted.
+    bam_record & operator=(bam_record const &) = default; //!< Defaulted.
+    bam_record(bam_record &&) = default;                  //!< Defaulted.
+    bam_record & operator=(bam_record &&) = default;      //!< Defaulted.
+    ~bam_record() = default;                              //!< Defaulted.
+
+    /*!\brief Constructs the record from the bytes of a binary BAM record.
+     * \param[in] raw The record as stored in the (decompressed) BAM file, beginning with its `block_size`.
+     * \throws seqan3::format_error if the sizes stored in the record do not match the number of bytes.
+     */
+    explicit bam_record(std::string raw) : data{std::move(raw)}
+    {
+        validate();
+    }
+    //!\}
+
+    //!\brief The bytes of the record as stored in the (decompressed) BAM file, beginning with its `block_size`.
+    std::string_view raw_data() const noexcept
+    {
+        return data;
+    }
+
+    /*!\name Fixed-size fields
+     * \brief These fields are read directly from the bytes of the record.
+     * \{
+     */
+    //!\brief The index of the reference sequence in the header (seqan3::field::ref_id) or std::nullopt if unmapped.
+    std::optional<int32_t> ref_id() const noexcept
+    {
+        return to_optional(read<int32_t>(ref_id_position));
+    }
+
+    //!\brief The 0-based position of the alignment (seqan3::field::ref_offset) or std::nullopt if not set.
+    std::optional<int32_t> ref_offset() const noexcept
+    {
+        return to_optional(read<int32_t>(ref_offset_position));
+    }
+
+    //!\brief The mapping quality (seqan3::field::mapq).
+    uint8_t mapq() const noexcept
+    {
+        return read<uint8_t>(mapq_position);
+    }
+
+    //!\brief The flag (seqan3::field::flag).
+    sam_flag flag() const noexcept
+    {
+        return static_cast<sam_flag>(read<uint16_t>(flag_position));
+    }
+
+    //!\brief The reference id and position of the mate and the template length (seqan3::field::mate).
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate() const noexcept
+    {
+        return {to_optional(read<int32_t>(mate_ref_id_position)),
+                to_optional(read<int32_t>(mate_ref_offset_position)),
+                read<int32_t>(template_length_position)};
+    }
+
+    //!\brief The read name (seqan3::field::id).
+    std::string_view id() const noexcept
+    {
+        return std::string_view{data}.substr(id_position, read<uint8_t>(id_length_position) - 1);
+    }
+    //!\}
+
+    /*!\name Lazily decoded fields
+     * \{
+     */
+    /*!\brief Decodes the CIGAR operations of the alignment (seqan3::field::cigar).
+     * \throws seqan3::format_error if the CIGAR string was too long for the record and the CG tag that holds it is
+     *         missing.
+     *
+     * \details
+     *
+     * If the alignment has more than 65535 operations, the record stores a placeholder `kSmN` and the CIGAR string in
+     * the CG tag; in this case, the CIGAR string of the tag is returned.
+     */
+    std::vector<cigar> cigar_vector() const
+    {
+        detail::format_bam_exposer format{};
+        [[maybe_unused]] auto [operations, ref_length, seq_length] =
+            decode(cigar_position(), 4 * cigar_count(), [&] (auto & view)
+            {
+                return format.parse_binary_cigar(view, cigar_count());
+            });
+
+        int32_t const sequence_length = read<int32_t>(sequence_length_position);
+
+        if (sequence_length != 0 && operations.size() == 2 && seq_length == sequence_length &&
+            get<1>(operations[0]) == 'S'_cigar_op && get<1>(operations[1]) == 'N'_cigar_op)
+        {
+            sam_tag_dictionary const tag_dict = tags();
+            auto it = tag_dict.find("CG"_tag);
+
+            if (it == tag_dict.end() || !std::holds_alternative<std::string>(it->second))
+                throw format_error{"The CIGAR string of the record exceeded 65535 operations and should be stored in "
+                                   "the optional field CG but this tag is not present in the record."};
+
+            operations = get<0>(format.parse_cigar(std::views::all(std::get<std::string>(it->second))));
+        }
+
+        return operations;
+    }
+
+    /*!\brief A view over the bases of the read (seqan3::field::seq); decodes each base when it is accessed.
+     * \returns A std::ranges::random_access_range over seqan3::sam_dna16.
+     */
+    auto sequence() const
+    {
+        char const * const first = data.data() + sequence_position();
+
+        return std::views::iota(int32_t{0}, read<int32_t>(sequence_length_position))
+             | std::views::transform([first] (int32_t const i)
+               {
+                   uint8_t const packed = static_cast<uint8_t>(first[i / 2]);
+                   return sam_dna16{}.assign_rank((i % 2 == 0) ? packed >> 4 : packed & 0x0f);
+               });
+    }
+
+    /*!\brief A view over the base qualities (seqan3::field::qual); decodes each quality when it is accessed.
+     * \returns A std::ranges::random_access_range over seqan3::phred42; empty if the record has no qualities.
+     */
+    auto base_qualities() const
+    {
+        int32_t const sequence_length = read<int32_t>(sequence_length_position);
+        char const * const first = data.data() + quality_position();
+        // the qualities of a record without qualities are all 0xFF
+        int32_t const size = (sequence_length > 0 && static_cast<uint8_t>(*first) == 0xFF) ? 0 : sequence_length;
+
+        return std::views::iota(int32_t{0}, size)
+             | std::views::transform([first] (int32_t const i)
+               {
+                   return phred42{}.assign_char(static_cast<char>(first[i] + 33));
+               });
+    }
+
+    //!\brief Decodes the optional fields of the record (seqan3::field::tags).
+    sam_tag_dictionary tags() const
+    {
+        detail::format_bam_exposer format{};
+        sam_tag_dictionary tag_dict{};
+        size_t const size = data.size() - tags_position();
+
+        decode(tags_position(), size, [&] (auto & view)
+        {
+            format.read_tags(view | views::take_exactly_or_throw(size), tag_dict);
+        });
+
+        return tag_dict;
+    }
+    //!\}
+
+    //!\brief Compares the bytes of the records.
+    friend bool operator==(bam_record const & lhs, bam_record const & rhs) noexcept
+    {
+        return lhs.data == rhs.data;
+    }
+
+    //!\brief Compares the bytes of the records.
+    friend bool operator!=(bam_record const & lhs, bam_record const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    //!\brief Befriend the input file so it can read into the buffer of the record.
+    friend bam_file_input;
+
+    /*!\name Layout of a record
+     * \brief The positions of the fields in the bytes of a record (see the SAM/BAM specification).
+     * \{
+     */
+    static constexpr size_t ref_id_position{4};            //!< refID
+    static constexpr size_t ref_offset_position{8};        //!< pos
+    static constexpr size_t id_length_position{12};        //!< l_read_name
+    static constexpr size_t mapq_position{13};             //!< mapq
+    static constexpr size_t cigar_count_position{16};      //!< n_cigar_op
+    static constexpr size_t flag_position{18};             //!< flag
+    static constexpr size_t sequence_length_position{20};  //!< l_seq
+    static constexpr size_t mate_ref_id_position{24};      //!< next_refID
+    static constexpr size_t mate_ref_offset_position{28};  //!< next_pos
+    static constexpr size_t template_length_position{32};  //!< tlen
+    static constexpr size_t id_position{36};               //!< read_name
+    //!\}
+
+    //!\brief The bytes of the record, beginning with its `block_size`.
+    std::string data{};
+
+    //!\brief Reads a fixed-size value at `position`.
+    template <typename value_t>
+    value_t read(size_t const position) const noexcept
+    {
+        value_t value{};
+        std::memcpy(&value, data.data() + position, sizeof(value_t));
+        return value;
+    }
+
+    //!\brief Converts a BAM position or id to a std::optional (-1 is not set).
+    static std::optional<int32_t> to_optional(int32_t const value) noexcept
+    {
+        return (value < 0) ? std::nullopt : std::optional<int32_t>{value};
+    }
+
+    //!\brief The number of CIGAR operations.
+    uint16_t cigar_count() const noexcept
+    {
+        return read<uint16_t>(cigar_count_position);
+    }
+
+    //!\brief The position of the CIGAR operations.
+    size_t cigar_position() const noexcept
+    {
+        return id_position + read<uint8_t>(id_length_position);
+    }
+
+    //!\brief The position of the packed bases.
+    size_t sequence_position() const noexcept
+    {
+        return cigar_position() + 4 * cigar_count();
+    }
+
+    //!\brief The position of the base qualities.
+    size_t quality_position() const noexcept
+    {
+        return sequence_position() + (read<int32_t>(sequence_length_position) + 1) / 2;
+    }
+
+    //!\brief The position of the optional fields.
+    size_t tags_position() const noexcept
+    {
+        return quality_position() + read<int32_t>(sequence_length_position);
+    }
+
+    /*!\brief Invokes `decoder` with a single-pass view over `size` bytes of the record beginning at `position`.
+     * \details The format reads binary fields from such a view as it would from the stream of a file.
+     */
+    template <typename decoder_t>
+    decltype(auto) decode(size_t const position, size_t const size, decoder_t && decoder) const
+    {
+        char * const first = const_cast<char *>(data.data()) + position; // the bytes are only read
+        detail::memory_streambuf buffer{first, first + size};
+        std::istream stream{&buffer};
+        std::ranges::subrange<std::istreambuf_iterator<char>, std::istreambuf_iterator<char>> view
+        {
+            std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}
+        };
+
+        return decoder(view);
+    }
+
+    /*!\brief Checks that the sizes stored in the record do not exceed the record.
+     * \throws seqan3::format_error if the record is invalid.
+     */
+    void validate() const
+    {
+        if (data.size() < id_position ||
+            static_cast<size_t>(read<int32_t>(0)) + 4 != data.size() ||
+            read<uint8_t>(id_length_position) == 0 ||
+            read<int32_t>(sequence_length_position) < 0 ||
+            tags_position() > data.size())
+        {
+            throw format_error{"The BAM record is invalid: its block_size does not match the sizes of its fields."};
+        }
+    }
+};
+
+} // namespace seqan3
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <cstring>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <seqan3/alphabet/detail/convert.hpp>
@@ -146,6 +148,22 @@ protected:
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(e_value),
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(bit_score));
 
+    template <typename stream_view_type, typename ref_ids_type, typename ref_seqs_type>
+    void read_bam_header(stream_view_type && stream_view,
+                         alignment_file_header<ref_ids_type> & header,
+                         ref_seqs_type & ref_seqs);
+
+    template <typename stream_type, typename header_type>
+    void write_bam_header(stream_type & stream, alignment_file_output_options const & options, header_type & header);
+
+    template <typename tags_view_type, typename tag_dict_type>
+    void read_tags(tags_view_type && tags_view, tag_dict_type & tag_dict);
+
+    template <typename cigar_input_type>
+    auto parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const;
+
+    using format_sam_base::parse_cigar; // inherit parse_cigar from format_sam_base explicitly
+
 private:
     //!\brief A variable that tracks whether the content of header has been read or not.
     bool header_was_read{false};
@@ -256,9 +274,6 @@ private:
     template <typename stream_view_type>
     void read_field(stream_view_type && stream_view, sam_tag_dictionary & target);
 
-    template <typename cigar_input_type>
-    auto parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const;
-
     static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
 };
 
@@ -326,53 +341,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (!header_was_read)
     {
-        // magic BAM string
-        if (!std::ranges::equal(stream_view | views::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
-            throw format_error{"File is not in BAM format."};
-
-        int32_t tmp32{};
-        read_field(stream_view, tmp32);
-
-        if (tmp32 > 0) // header text is present
-            read_header(stream_view | views::take_exactly_or_throw(tmp32)
-                                    | views::take_until_and_consume(is_char<'\0'>),
-                        header,
-                        ref_seqs);
-
-        int32_t n_ref;
-        read_field(stream_view, n_ref);
-
-        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
-        {
-            read_field(stream_view, tmp32); // l_name (length of reference name including \0 character)
-
-            string_buffer.resize(tmp32 - 1);
-            std::ranges::copy_n(std::ranges::begin(stream_view), tmp32 - 1, string_buffer.data()); // copy without \0 character
-            std::ranges::next(std::ranges::begin(stream_view)); // skip \0 character
-
-            read_field(stream_view, tmp32); // l_ref (length of reference sequence)
-
-            auto id_it = header.ref_dict.find(string_buffer);
-
-            // sanity checks of reference information to existing header object:
-            if (id_it == header.ref_dict.end()) // [unlikely]
-            {
-                throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
-                                                     "' found in BAM file header (header.ref_ids():",
-                                                     header.ref_ids(), ").")};
-            }
-            else if (id_it->second != ref_idx) // [unlikely]
-            {
-                throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
-                                                     " does not correspond to the position ", id_it->second,
-                                                     " in the header (header.ref_ids():", header.ref_ids(), ").")};
-            }
-            else if (std::get<0>(header.ref_id_info[id_it->second]) != tmp32) // [unlikely]
-            {
-                throw format_error{"Provided reference has unequal length as specified in the header."};
-            }
-        }
-
+        read_bam_header(stream_view, header, ref_seqs);
         header_was_read = true;
 
         if (stream_buf_t{stream} == stream_buf_t{}) // no records follow
@@ -536,8 +505,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     assert(remaining_bytes >= 0);
     auto tags_view = stream_view | views::take_exactly_or_throw(remaining_bytes);
 
-    while (tags_view.size() > 0)
-        read_field(tags_view, tag_dict);
+    read_tags(tags_view, tag_dict);
 
     // DONE READING - wrap up
     // -------------------------------------------------------------------------------------------------------------
@@ -585,6 +553,118 @@ inline void format_bam::read_alignment_record(stream_type & stream,
         std::swap(cigar_vector, tmp_cigar_vector);
 }
 
+/*!\brief Reads the BAM header (the magic string, the SAM header text and the binary reference information).
+ * \tparam stream_view_type The type of the stream as a view.
+ * \tparam ref_ids_type     The type of the reference ids of the header.
+ * \tparam ref_seqs_type    The type of the reference sequences (might decay to ignore).
+ * \param[in, out] stream_view The stream view to read from; positioned at the beginning of the file.
+ * \param[in, out] header      The header to fill.
+ * \param[in]      ref_seqs    The reference sequences, if provided to the file.
+ * \throws seqan3::format_error if the header is invalid or does not match the provided reference information.
+ */
+template <typename stream_view_type, typename ref_ids_type, typename ref_seqs_type>
+inline void format_bam::read_bam_header(stream_view_type && stream_view,
+                                        alignment_file_header<ref_ids_type> & header,
+                                        ref_seqs_type & ref_seqs)
+{
+    // magic BAM string
+    if (!std::ranges::equal(stream_view | views::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
+        throw format_error{"File is not in BAM format."};
+
+    int32_t tmp32{};
+    read_field(stream_view, tmp32);
+
+    if (tmp32 > 0) // header text is present
+        read_header(stream_view | views::take_exactly_or_throw(tmp32)
+                                | views::take_until_and_consume(is_char<'\0'>),
+                    header,
+                    ref_seqs);
+
+    int32_t n_ref;
+    read_field(stream_view, n_ref);
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+    {
+        read_field(stream_view, tmp32); // l_name (length of reference name including \0 character)
+
+        string_buffer.resize(tmp32 - 1);
+        std::ranges::copy_n(std::ranges::begin(stream_view), tmp32 - 1, string_buffer.data()); // copy without \0 character
+        std::ranges::next(std::ranges::begin(stream_view)); // skip \0 character
+
+        read_field(stream_view, tmp32); // l_ref (length of reference sequence)
+
+        auto id_it = header.ref_dict.find(string_buffer);
+
+        // sanity checks of reference information to existing header object:
+        if (id_it == header.ref_dict.end()) // [unlikely]
+        {
+            throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
+                                                 "' found in BAM file header (header.ref_ids():",
+                                                 header.ref_ids(), ").")};
+        }
+        else if (id_it->second != ref_idx) // [unlikely]
+        {
+            throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
+                                                 " does not correspond to the position ", id_it->second,
+                                                 " in the header (header.ref_ids():", header.ref_ids(), ").")};
+        }
+        else if (std::get<0>(header.ref_id_info[id_it->second]) != tmp32) // [unlikely]
+        {
+            throw format_error{"Provided reference has unequal length as specified in the header."};
+        }
+    }
+}
+
+/*!\brief Writes the BAM header (the magic string, the SAM header text and the binary reference information).
+ * \tparam stream_type The type of the output stream.
+ * \tparam header_type The type of the header.
+ * \param[in, out] stream  The stream to write to.
+ * \param[in]      options The output options, passed on to the SAM header.
+ * \param[in]      header  The header to write.
+ */
+template <typename stream_type, typename header_type>
+inline void format_bam::write_bam_header(stream_type & stream,
+                                         alignment_file_output_options const & options,
+                                         header_type & header)
+{
+    seqan3::ostreambuf_iterator stream_it{stream};
+
+    stream << "BAM\1";
+    std::ostringstream os;
+    write_header(os, options, header); // write SAM header to temporary stream to query the size.
+    int32_t l_text{static_cast<int32_t>(os.str().size())};
+    std::ranges::copy_n(reinterpret_cast<char *>(&l_text), 4, stream_it); // write read id
+
+    stream  << os.str();
+
+    int32_t n_ref{static_cast<int32_t>(header.ref_ids().size())};
+    std::ranges::copy_n(reinterpret_cast<char *>(&n_ref), 4, stream_it); // write read id
+
+    for (int32_t ridx = 0; ridx < n_ref; ++ridx)
+    {
+        int32_t l_name{static_cast<int32_t>(header.ref_ids()[ridx].size()) + 1}; // plus null character
+        std::ranges::copy_n(reinterpret_cast<char *>(&l_name), 4, stream_it);    // write l_name
+        // write reference name:
+        std::ranges::copy(header.ref_ids()[ridx].begin(), header.ref_ids()[ridx].end(), stream_it);
+        stream_it = '\0';
+        // write reference sequence length:
+        std::ranges::copy_n(reinterpret_cast<char *>(&get<0>(header.ref_id_info[ridx])), 4, stream_it);
+    }
+}
+
+/*!\brief Reads all optional fields of a record into the seqan3::sam_tag_dictionary.
+ * \tparam tags_view_type The type of the view over the binary optional fields; must be sized.
+ * \tparam tag_dict_type  The type of the tag dictionary (might decay to ignore).
+ * \param[in, out] tags_view The view over the optional fields of the record.
+ * \param[out]     tag_dict  The tag dictionary to fill.
+ */
+template <typename tags_view_type, typename tag_dict_type>
+inline void format_bam::read_tags(tags_view_type && tags_view, tag_dict_type & tag_dict)
+{
+    while (tags_view.size() > 0)
+        read_field(tags_view, tag_dict);
+}
+
 //!\copydoc alignment_file_output_format::write_alignment_record
 template <typename stream_type,
           typename header_type,
@@ -700,28 +780,7 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
         // ---------------------------------------------------------------------
         if (!header_was_written)
         {
-            stream << "BAM\1";
-            std::ostringstream os;
-            write_header(os, options, header); // write SAM header to temporary stream to query the size.
-            int32_t l_text{static_cast<int32_t>(os.str().size())};
-            std::ranges::copy_n(reinterpret_cast<char *>(&l_text), 4, stream_it); // write read id
-
-            stream  << os.str();
-
-            int32_t n_ref{static_cast<int32_t>(header.ref_ids().size())};
-            std::ranges::copy_n(reinterpret_cast<char *>(&n_ref), 4, stream_it); // write read id
-
-            for (int32_t ridx = 0; ridx < n_ref; ++ridx)
-            {
-                int32_t l_name{static_cast<int32_t>(header.ref_ids()[ridx].size()) + 1}; // plus null character
-                std::ranges::copy_n(reinterpret_cast<char *>(&l_name), 4, stream_it);    // write l_name
-                // write reference name:
-                std::ranges::copy(header.ref_ids()[ridx].begin(), header.ref_ids()[ridx].end(), stream_it);
-                stream_it = '\0';
-                // write reference sequence length:
-                std::ranges::copy_n(reinterpret_cast<char *>(&get<0>(header.ref_id_info[ridx])), 4, stream_it);
-            }
-
+            write_bam_header(stream, options, header);
             header_was_written = true;
         }
 
@@ -1200,3 +1259,39 @@ inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_d
 }
 
 } // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief A BAM record is preceded by its size, s.t. the records of a chunk are found without parsing them.
+ * \ingroup alignment_file
+ * \param[in] chunk Bytes of the BAM file behind the header; begins with a record.
+ * \returns The end of the last complete record in `chunk` or std::string_view::npos if there is none.
+ *
+ * \details
+ *
+ * Used by seqan3::alignment_file_input::read_batches to split the file into chunks for
+ * seqan3::detail::read_record_batches. A negative block size ends the chunk, s.t. the parser reports the error.
+ */
+inline size_t last_record_end(format_bam const &, std::string_view const chunk)
+{
+    size_t record_end = 0;
+    int32_t block_size{};
+
+    while (chunk.size() - record_end >= sizeof(block_size))
+    {
+        std::memcpy(&block_size, chunk.data() + record_end, sizeof(block_size));
+
+        if (block_size < 0)
+            return chunk.size();
+
+        if (chunk.size() - record_end - sizeof(block_size) < static_cast<size_t>(block_size))
+            break;
+
+        record_end += sizeof(block_size) + block_size;
+    }
+
+    return record_end == 0 ? std::string_view::npos : record_end;
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::genomic_region.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace seqan3
+{
+
+/*!\brief A region of a reference sequence, e.g. for region queries on an indexed alignment file.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The region is the half-open interval `[begin, end)` of 0-based positions on the reference named `reference_id`.
+ * Use seqan3::genomic_region::from_string to parse the notation of samtools.
+ */
+struct genomic_region
+{
+    //!\brief The name of the reference sequence.
+    std::string reference_id{};
+    //!\brief The first (0-based) position of the region.
+    uint64_t begin{0};
+    //!\brief The position behind the region; the maximum value denotes the end of the reference.
+    uint64_t end{std::numeric_limits<uint64_t>::max()};
+
+    /*!\brief Parses a region in samtools notation, e.g. `chr1:1,000,000-2,000,000`.
+     * \param[in] region The region as `name`, `name:begin` or `name:begin-end` with 1-based, inclusive positions;
+     *                   the positions may contain ',' as thousands separator.
+     * \throws std::invalid_argument if the region is empty, the begin is 0 or the end is smaller than the begin.
+     *
+     * \details
+     *
+     * If the part after the last ':' is not a position or a range of positions, it is considered part of the name, s.t.
+     * names that contain ':' can be given without positions.
+     */
+    static genomic_region from_string(std::string_view const region)
+    {
+        genomic_region result{std::string{region}};
+
+        size_t const colon = region.rfind(':');
+        if (colon == std::string_view::npos)
+            return check(std::move(result), region);
+
+        // parses digits and separators; returns false if there are none or another character occurs
+        auto parse_position = [] (std::string_view const digits, uint64_t & position)
+        {
+            bool has_digit = false;
+            position = 0;
+            for (char const c : digits)
+            {
+                if (c == ',')
+                    continue;
+                if (c < '0' || c > '9')
+                    return false;
+                position = position * 10 + (c - '0');
+                has_digit = true;
+            }
+            return has_digit;
+        };
+
+        std::string_view const range = region.substr(colon + 1);
+        size_t const dash = range.find('-');
+
+        uint64_t begin{};
+        if (!parse_position(range.substr(0, dash), begin))
+            return check(std::move(result), region);
+
+        uint64_t end{std::numeric_limits<uint64_t>::max()};
+        if (dash != std::string_view::npos && dash + 1 != range.size() && !parse_position(range.substr(dash + 1), end))
+            return check(std::move(result), region);
+
+        if (begin == 0 || end < begin)
+            throw std::invalid_argument{"Invalid region " + std::string{region} + ": positions are 1-based and the "
+                                        "end must not be smaller than the begin."};
+
+        result.reference_id = region.substr(0, colon);
+        result.begin = begin - 1;
+        result.end = end;
+        return check(std::move(result), region);
+    }
+
+private:
+    //!\brief Throws std::invalid_argument if the name of `result` is empty.
+    static genomic_region check(genomic_region result, std::string_view const region)
+    {
+        if (result.reference_id.empty())
+            throw std::invalid_argument{"Invalid region " + std::string{region} + ": the reference name is empty."};
+        return result;
+    }
+};
+
+} // namespace seqan3
@@ -14,7 +14,10 @@
 
 #include <cassert>
 #include <fstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <variant>
 #include <vector>
 
@@ -27,6 +30,8 @@
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/core/type_traits/transformation_trait_or.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/genomic_region.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
@@ -34,6 +39,7 @@
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/record_batch_reader.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/stream/concept.hpp>
@@ -842,6 +848,167 @@ public:
         return *header_ptr;
     }
 
+    /*!\name Region queries
+     * \brief Restricts the file to the records that overlap a region of a reference.
+     * \{
+     */
+    /*!\brief Restricts the file to the records that overlap `region`, using the index of the file.
+     * \param[in] index  The index of the file, see seqan3::bam_index.
+     * \param[in] region The region of a reference.
+     * \throws seqan3::format_error if the file is not a BGZF-compressed BAM file.
+     * \throws std::out_of_range if the header contains no reference named `region.reference_id`.
+     *
+     * \details
+     *
+     * Afterwards, begin() points to the first record that overlaps the region and the iteration stops behind the last
+     * such record. The index provides the chunks of the file that can contain such records; only these chunks are
+     * decompressed and read, s.t. the time of a query depends on the size of the region and not on the size of the file.
+     * Records of the chunks that do not overlap the region are skipped without being parsed into the record.
+     *
+     * The region can be changed by calling this function again; all previously read records are invalidated.
+     *
+     * \include test/snippet/io/alignment_file/bam_index.cpp
+     */
+    void set_region(bam_index const & index, genomic_region const & region)
+    {
+#ifdef SEQAN3_HAS_ZLIB
+        bool const is_bam = std::visit([] (auto const & f)
+        {
+            return std::same_as<remove_cvref_t<decltype(f)>, detail::alignment_file_input_format_exposer<format_bam>>;
+        }, format);
+
+        if (!is_bam || dynamic_cast<contrib::basic_bgzf_istream<stream_char_type> *>(secondary_stream.get()) == nullptr)
+            throw format_error{"Region queries require a BGZF-compressed BAM file."};
+
+        auto const & ref_ids = header().ref_ids(); // reads the header
+        auto const id_it = std::ranges::find_if(ref_ids, [&region] (auto const & id)
+        {
+            return std::ranges::equal(id, region.reference_id);
+        });
+
+        if (id_it == std::ranges::end(ref_ids))
+            throw std::out_of_range{"The header contains no reference named " + region.reference_id + "."};
+
+        region_ref_id = std::ranges::distance(std::ranges::begin(ref_ids), id_it);
+        region_begin = region.begin;
+        region_end = region.end;
+        region_chunks = index.query(region_ref_id, region.begin, region.end);
+        region_chunk = 0;
+        region_is_set = true;
+        at_end = false;
+
+        if (!region_chunks.empty())
+        {
+            secondary_stream->clear();
+            secondary_stream->seekg(region_chunks.front().begin);
+        }
+
+        read_next_record();
+#else
+        (void) index;
+        (void) region;
+        throw format_error{"Region queries require a BGZF-compressed BAM file, but no ZLIB is available."};
+#endif
+    }
+
+    /*!\brief Restricts the file to the records that overlap `region`, e.g. `chr1:1,000,000-2,000,000`.
+     * \param[in] index  The index of the file, see seqan3::bam_index.
+     * \param[in] region The region in samtools notation, see seqan3::genomic_region::from_string.
+     * \throws std::invalid_argument if the region is invalid.
+     * \throws seqan3::format_error if the file is not a BGZF-compressed BAM file.
+     * \throws std::out_of_range if the header contains no reference of the given name.
+     */
+    void set_region(bam_index const & index, std::string_view const region)
+    {
+        set_region(index, genomic_region::from_string(region));
+    }
+    //!\}
+
+    /*!\brief Reads the remaining records in batches that are parsed in parallel.
+     * \tparam delegate_t The type of the callable invoked with each batch; must be invocable with
+     *                    `std::vector<record_type> &`.
+     * \param[in] delegate     Invoked with each batch of records on the calling thread, in the order of the file.
+     * \param[in] thread_count The number of threads that parse the records.
+     * \param[in] chunk_size   The approximate number of bytes of the (decompressed) file per batch.
+     * \throws seqan3::format_error if a record could not be parsed.
+     *
+     * \details
+     *
+     * The records of a BAM file are preceded by their size, so the decompressed file is split into chunks of complete
+     * records without parsing them. `thread_count` threads parse the chunks into batches of records while the next
+     * chunks are read (and decompressed by the threads of the BGZF stream). The batches are reused after the delegate
+     * returns; move the records out of the batch to keep them.
+     *
+     * SAM files and files restricted by set_region() are read record by record on the calling thread and passed to the
+     * delegate in batches as well. After this function returns, the file is at end.
+     *
+     * Together with seqan3::alignment_file_output::write_batches, a file is converted or filtered with both the
+     * parsing and the formatting of the records spread over several threads:
+     *
+     * \include test/snippet/io/alignment_file/alignment_file_batches.cpp
+     */
+    template <typename delegate_t>
+    //!\cond
+        requires std::invocable<delegate_t, std::vector<record_type> &>
+    //!\endcond
+    void read_batches(delegate_t && delegate,
+                      size_t const thread_count = std::thread::hardware_concurrency(),
+                      size_t const chunk_size = 1ULL << 22)
+    {
+        std::vector<record_type> batch{};
+
+        // the header is read together with the first record, which is passed on first
+        begin();
+        if (!at_end)
+        {
+            batch.push_back(std::move(record_buffer));
+            delegate(batch);
+            batch.clear();
+        }
+
+        assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f)
+        {
+            if constexpr (detail::record_splittable_format<std::remove_reference_t<decltype(f)>>)
+            {
+                if (!at_end && !region_is_set)
+                {
+                    // every thread parses with its own copy of the format, which has already read the header
+                    detail::read_record_batches<record_type>(*secondary_stream,
+                                                             thread_count,
+                                                             chunk_size,
+                                                             [&f] (std::string_view const chunk)
+                                                             {
+                                                                 return detail::last_record_end(f, chunk);
+                                                             },
+                                                             [this, f] (std::istream & stream,
+                                                                        record_type & record) mutable
+                                                             {
+                                                                 read_record(f, stream, record);
+                                                             },
+                                                             delegate);
+                    return;
+                }
+            }
+
+            for (read_next_record(); !at_end; read_next_record())
+            {
+                batch.push_back(std::move(record_buffer));
+                if (batch.size() == sequential_batch_size)
+                {
+                    delegate(batch);
+                    batch.clear();
+                }
+            }
+
+            if (!batch.empty())
+                delegate(batch);
+        }, format);
+
+        record_buffer.clear();
+        at_end = true;
+    }
+
 protected:
     //!\privatesection
 
@@ -897,7 +1064,33 @@ protected:
     bool first_record_was_read{false};
     //!\brief File is one position behind the last record.
     bool at_end{false};
+    //!\}
 
+    //!\brief The number of records per batch if seqan3::alignment_file_input::read_batches reads record by record.
+    static constexpr size_t sequential_batch_size = 1024;
+
+    /*!\name Region queries
+     * \{
+     */
+    //!\brief Whether the file is restricted to a region by set_region().
+    bool region_is_set{false};
+    //!\brief The position of the reference of the region in the header.
+    int32_t region_ref_id{-1};
+    //!\brief The first position of the region.
+    uint64_t region_begin{0};
+    //!\brief The position behind the region.
+    uint64_t region_end{0};
+    //!\brief The chunks of the file that can contain records of the region.
+    std::vector<bam_index_chunk> region_chunks{};
+    //!\brief The chunk that is currently read.
+    size_t region_chunk{0};
+    //!\brief A buffer for the bytes of records that are skipped.
+    std::string region_buffer{};
+    //!\}
+
+    /*!\name Format
+     * \{
+     */
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
                                                            detail::alignment_file_input_format_exposer>::type;
@@ -950,6 +1143,44 @@ protected:
     }
     //!\}
 
+    /*!\brief Moves the stream to the next record that overlaps the region.
+     * \returns `false` if there is no further record in the region.
+     */
+    bool seek_next_region_record()
+    {
+        while (region_chunk < region_chunks.size())
+        {
+            std::streamoff const position = secondary_stream->tellg();
+            if (position < 0 || static_cast<uint64_t>(position) >= region_chunks[region_chunk].end)
+            {
+                if (++region_chunk < region_chunks.size())
+                {
+                    secondary_stream->clear();
+                    secondary_stream->seekg(region_chunks[region_chunk].begin);
+                }
+                continue;
+            }
+
+            detail::bam_record_span span{};
+            if (!detail::read_bam_record_span(*secondary_stream, span, region_buffer))
+                return false;
+
+            // the records are sorted by coordinate; unplaced records are at the end
+            if (span.ref_id < 0 || span.ref_id > region_ref_id ||
+                (span.ref_id == region_ref_id && static_cast<uint64_t>(span.begin) >= region_end))
+                return false;
+
+            // overlaps the region: let the format parse it
+            if (span.ref_id == region_ref_id && static_cast<uint64_t>(span.end) > region_begin)
+            {
+                secondary_stream->seekg(position);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
@@ -958,40 +1189,49 @@ protected:
         detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
 
         // at end if we could not read further
-        if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
+        if ((region_is_set && !seek_next_region_record()) ||
+            std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
             std::istreambuf_iterator<stream_char_type>{})
         {
             at_end = true;
             return;
         }
 
-        auto call_read_func = [this] (auto & ref_seq_info)
+        assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f)
         {
-            std::visit([&] (auto & f)
-            {
-                f.read_alignment_record(*secondary_stream,
-                                        options,
-                                        ref_seq_info,
-                                        *header_ptr,
-                                        detail::get_or_ignore<field::seq>(record_buffer),
-                                        detail::get_or_ignore<field::qual>(record_buffer),
-                                        detail::get_or_ignore<field::id>(record_buffer),
-                                        detail::get_or_ignore<field::offset>(record_buffer),
-                                        detail::get_or_ignore<field::ref_seq>(record_buffer),
-                                        detail::get_or_ignore<field::ref_id>(record_buffer),
-                                        detail::get_or_ignore<field::ref_offset>(record_buffer),
-                                        detail::get_or_ignore<field::alignment>(record_buffer),
-                                        detail::get_or_ignore<field::cigar>(record_buffer),
-                                        detail::get_or_ignore<field::flag>(record_buffer),
-                                        detail::get_or_ignore<field::mapq>(record_buffer),
-                                        detail::get_or_ignore<field::mate>(record_buffer),
-                                        detail::get_or_ignore<field::tags>(record_buffer),
-                                        detail::get_or_ignore<field::evalue>(record_buffer),
-                                        detail::get_or_ignore<field::bit_score>(record_buffer));
-            }, format);
-        };
+            read_record(f, *secondary_stream, record_buffer);
+        }, format);
+    }
 
-        assert(!format.valueless_by_exception());
+    //!\brief Reads the next record from `stream` into `record` with the format `f`.
+    template <typename format_t>
+    void read_record(format_t & f, std::basic_istream<stream_char_type> & stream, record_type & record)
+    {
+        detail::get_or_ignore<field::header_ptr>(record) = header_ptr.get();
+
+        auto call_read_func = [&] (auto & ref_seq_info)
+        {
+            f.read_alignment_record(stream,
+                                    options,
+                                    ref_seq_info,
+                                    *header_ptr,
+                                    detail::get_or_ignore<field::seq>(record),
+                                    detail::get_or_ignore<field::qual>(record),
+                                    detail::get_or_ignore<field::id>(record),
+                                    detail::get_or_ignore<field::offset>(record),
+                                    detail::get_or_ignore<field::ref_seq>(record),
+                                    detail::get_or_ignore<field::ref_id>(record),
+                                    detail::get_or_ignore<field::ref_offset>(record),
+                                    detail::get_or_ignore<field::alignment>(record),
+                                    detail::get_or_ignore<field::cigar>(record),
+                                    detail::get_or_ignore<field::flag>(record),
+                                    detail::get_or_ignore<field::mapq>(record),
+                                    detail::get_or_ignore<field::mate>(record),
+                                    detail::get_or_ignore<field::tags>(record),
+                                    detail::get_or_ignore<field::evalue>(record),
+                                    detail::get_or_ignore<field::bit_score>(record));
+        };
 
         if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
             call_read_func(*reference_sequences_ptr);
@@ -12,15 +12,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <variant>
 #include <vector>
 
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/type_list/traits.hpp>
+#include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -30,8 +33,10 @@
 #include <seqan3/io/detail/out_file_iterator.hpp>
 #include <seqan3/io/detail/misc_output.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/record_batch_writer.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
+#include <seqan3/std/iterator>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/std/ranges>
@@ -513,25 +518,13 @@ public:
                  requires { requires detail::is_type_specialisation_of_v<remove_cvref_t<record_t>, record>; }
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+        apply_compression_level();
 
-        write_record(detail::get_or<field::header_ptr>(r, nullptr),
-                     detail::get_or<field::seq>(r, std::string_view{}),
-                     detail::get_or<field::qual>(r, std::string_view{}),
-                     detail::get_or<field::id>(r, std::string_view{}),
-                     detail::get_or<field::offset>(r, 0u),
-                     detail::get_or<field::ref_seq>(r, std::string_view{}),
-                     detail::get_or<field::ref_id>(r, std::ignore),
-                     detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
-                     detail::get_or<field::alignment>(r, default_align_t{}),
-                     detail::get_or<field::cigar>(r, std::vector<cigar>{}),
-                     detail::get_or<field::flag>(r, sam_flag::none),
-                     detail::get_or<field::mapq>(r, 0u),
-                     detail::get_or<field::mate>(r, default_mate_t{}),
-                     detail::get_or<field::tags>(r, sam_tag_dictionary{}),
-                     detail::get_or<field::evalue>(r, 0u),
-                     detail::get_or<field::bit_score>(r, 0u));
+        assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f)
+        {
+            write_fields(f, *secondary_stream, r);
+        }, format);
     }
 
     /*!\brief           Write a record in form of a std::tuple to the file.
@@ -561,26 +554,13 @@ public:
         requires tuple_like<tuple_t>
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+        apply_compression_level();
 
-        // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
-        write_record(detail::get_or<selected_field_ids::index_of(field::header_ptr)>(t, nullptr),
-                     detail::get_or<selected_field_ids::index_of(field::seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::qual)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::id)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::offset)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::ref_seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::ref_id)>(t, std::ignore),
-                     detail::get_or<selected_field_ids::index_of(field::ref_offset)>(t, std::optional<int32_t>{}),
-                     detail::get_or<selected_field_ids::index_of(field::alignment)>(t, default_align_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::cigar)>(t, std::vector<cigar>{}),
-                     detail::get_or<selected_field_ids::index_of(field::flag)>(t, sam_flag::none),
-                     detail::get_or<selected_field_ids::index_of(field::mapq)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::mate)>(t, default_mate_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::tags)>(t, sam_tag_dictionary{}),
-                     detail::get_or<selected_field_ids::index_of(field::evalue)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::bit_score)>(t, 0u));
+        assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f)
+        {
+            write_fields(f, *secondary_stream, t);
+        }, format);
     }
 
     /*!\brief            Write a record to the file by passing individual fields.
@@ -694,6 +674,88 @@ public:
     }
     //!\}
 
+    /*!\brief Writes a range of records (or tuples) that are formatted in parallel.
+     * \tparam rng_t Type of the range, must satisfy std::ranges::input_range and have a reference type that
+     *               satisfies seqan3::tuple_like.
+     * \param[in] range        The records to write.
+     * \param[in] thread_count The number of threads that format the records.
+     * \param[in] batch_size   The number of records formatted by a thread at once.
+     *
+     * \details
+     *
+     * The first record is written with push_back() (together with the header); the remaining records are formatted
+     * into memory in batches by `thread_count` threads and written to the file in the order of the range. The threads
+     * of a BGZF-compressed BAM file compress the formatted bytes in parallel as well.
+     *
+     * The records of a random access range (e.g. a batch passed on by seqan3::alignment_file_input::read_batches) are
+     * formatted in place; the records of other ranges are copied into batches on the calling thread while the previous
+     * batches are formatted.
+     *
+     * \include test/snippet/io/alignment_file/alignment_file_batches.cpp
+     */
+    template <typename rng_t>
+    void write_batches(rng_t && range,
+                       size_t const thread_count = std::thread::hardware_concurrency(),
+                       size_t const batch_size = 1024)
+    //!\cond
+        requires std::ranges::input_range<rng_t> && tuple_like<reference_t<rng_t>>
+    //!\endcond
+    {
+        auto it = std::ranges::begin(range);
+        auto const end = std::ranges::end(range);
+
+        if (it == end)
+            return;
+
+        // the header is written together with the first record
+        push_back(*it);
+        ++it;
+
+        assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f)
+        {
+            // every thread formats with its own copy of the format, which has already written the header
+            auto format_batch = [this, f] (auto const & batch, std::basic_ostream<stream_char_type> & stream) mutable
+            {
+                for (auto && r : batch)
+                    write_fields(f, stream, r);
+            };
+
+            if constexpr (std::ranges::random_access_range<rng_t> &&
+                          std::sized_sentinel_for<std::ranges::sentinel_t<rng_t>, std::ranges::iterator_t<rng_t>>)
+            {
+                using batch_t = std::ranges::subrange<std::ranges::iterator_t<rng_t>>;
+
+                detail::write_record_batches<batch_t>(*secondary_stream, thread_count, [&] (batch_t & batch)
+                {
+                    auto const size = std::min<difference_type_t<rng_t>>(batch_size, end - it);
+                    batch = batch_t{it, it + size};
+                    it += size;
+                    return size > 0;
+                }, format_batch);
+            }
+            else
+            {
+                using batch_t = std::vector<std::ranges::range_value_t<rng_t>>;
+
+                detail::write_record_batches<batch_t>(*secondary_stream, thread_count, [&] (batch_t & batch)
+                {
+                    size_t size = 0;
+                    for (; size < batch_size && it != end; ++it, ++size)
+                    {
+                        if (size < batch.size())
+                            batch[size] = *it; // reuses the memory of the previous records
+                        else
+                            batch.push_back(*it);
+                    }
+
+                    batch.erase(batch.begin() + size, batch.end());
+                    return size > 0;
+                }, format_batch);
+            }
+        }, format);
+    }
+
     //!\brief The options are public and its members can be set directly.
     alignment_file_output_options options;
 
@@ -752,6 +814,19 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief Whether seqan3::alignment_file_output_options::compression_level was passed on to the secondary stream.
+    bool compression_level_was_set{false};
+
+    //!\brief Passes seqan3::alignment_file_output_options::compression_level on to the secondary stream before the first record.
+    void apply_compression_level()
+    {
+        if (!compression_level_was_set)
+        {
+            detail::set_compression_level(*secondary_stream, options.compression_level);
+            compression_level_was_set = true;
+        }
+    }
+
     //!\brief The header type, which specilised with ref_ids_type if reference information are given.
     using header_type = alignment_file_header<std::conditional_t<std::same_as<ref_ids_type, ref_info_not_given>,
                                               std::vector<std::string>,
@@ -786,39 +861,92 @@ protected:
         }
     }
 
+    /*!\brief Writes a record or tuple with the format `f` to `stream`.
+     * \details The fields of a seqan3::record are identified by their seqan3::field, the elements of a tuple by their
+     *          position in `selected_field_ids`.
+     */
+    template <typename format_t, typename record_t>
+    void write_fields(format_t & f, std::basic_ostream<stream_char_type> & stream, record_t && r)
+    {
+        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
+        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+
+        if constexpr (detail::is_type_specialisation_of_v<remove_cvref_t<record_t>, record>)
+        {
+            write_record(f,
+                         stream,
+                         detail::get_or<field::header_ptr>(r, nullptr),
+                         detail::get_or<field::seq>(r, std::string_view{}),
+                         detail::get_or<field::qual>(r, std::string_view{}),
+                         detail::get_or<field::id>(r, std::string_view{}),
+                         detail::get_or<field::offset>(r, 0u),
+                         detail::get_or<field::ref_seq>(r, std::string_view{}),
+                         detail::get_or<field::ref_id>(r, std::ignore),
+                         detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
+                         detail::get_or<field::alignment>(r, default_align_t{}),
+                         detail::get_or<field::cigar>(r, std::vector<cigar>{}),
+                         detail::get_or<field::flag>(r, sam_flag::none),
+                         detail::get_or<field::mapq>(r, 0u),
+                         detail::get_or<field::mate>(r, default_mate_t{}),
+                         detail::get_or<field::tags>(r, sam_tag_dictionary{}),
+                         detail::get_or<field::evalue>(r, 0u),
+                         detail::get_or<field::bit_score>(r, 0u));
+        }
+        else
+        {
+            // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
+            write_record(f,
+                         stream,
+                         detail::get_or<selected_field_ids::index_of(field::header_ptr)>(r, nullptr),
+                         detail::get_or<selected_field_ids::index_of(field::seq)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::qual)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::id)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::offset)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::ref_seq)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::ref_id)>(r, std::ignore),
+                         detail::get_or<selected_field_ids::index_of(field::ref_offset)>(r, std::optional<int32_t>{}),
+                         detail::get_or<selected_field_ids::index_of(field::alignment)>(r, default_align_t{}),
+                         detail::get_or<selected_field_ids::index_of(field::cigar)>(r, std::vector<cigar>{}),
+                         detail::get_or<selected_field_ids::index_of(field::flag)>(r, sam_flag::none),
+                         detail::get_or<selected_field_ids::index_of(field::mapq)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::mate)>(r, default_mate_t{}),
+                         detail::get_or<selected_field_ids::index_of(field::tags)>(r, sam_tag_dictionary{}),
+                         detail::get_or<selected_field_ids::index_of(field::evalue)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::bit_score)>(r, 0u));
+        }
+    }
+
     //!\brief Write record to format.
-    template <typename record_header_ptr_t, typename ...pack_type>
-    void write_record(record_header_ptr_t && record_header_ptr, pack_type && ...remainder)
+    template <typename format_t, typename record_header_ptr_t, typename ...pack_type>
+    void write_record(format_t & f,
+                      std::basic_ostream<stream_char_type> & stream,
+                      record_header_ptr_t && record_header_ptr,
+                      pack_type && ...remainder)
     {
         static_assert((sizeof...(pack_type) == 15), "Wrong parameter list passed to write_record.");
 
-        assert(!format.valueless_by_exception());
-
-        std::visit([&] (auto & f)
+        // use header from record if explicitly given, e.g. file_output = file_input
+        if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
         {
-            // use header from record if explicitly given, e.g. file_output = file_input
-            if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
-            {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         *record_header_ptr,
-                                         std::forward<pack_type>(remainder)...);
-            }
-            else if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
-            {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         std::ignore,
-                                         std::forward<pack_type>(remainder)...);
-            }
-            else
-            {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         *header_ptr,
-                                         std::forward<pack_type>(remainder)...);
-            }
-        }, format);
+            f.write_alignment_record(stream,
+                                     options,
+                                     *record_header_ptr,
+                                     std::forward<pack_type>(remainder)...);
+        }
+        else if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
+        {
+            f.write_alignment_record(stream,
+                                     options,
+                                     std::ignore,
+                                     std::forward<pack_type>(remainder)...);
+        }
+        else
+        {
+            f.write_alignment_record(stream,
+                                     options,
+                                     *header_ptr,
+                                     std::forward<pack_type>(remainder)...);
+        }
     }
 
     //!\brief Befriend iterator so it can access the buffers.
@@ -12,8 +12,15 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/concept/core_language.hpp>
@@ -316,21 +323,420 @@ template <> struct sam_tag_type<"UQ"_tag> { using type = int32_t; };
  * for the tag "XZ" or learn more about an std::variant at
  * https://en.cppreference.com/w/cpp/utility/variant.
  *
+ * ### Storage
+ *
+ * The dictionary provides the interface of a std::map from the tag id to the std::variant, but stores the tags in a
+ * single vector that is sorted by tag id. A record with a few tags therefore needs a single buffer instead of one tree
+ * node per tag, and this buffer is kept when the record buffer of a file is reset for the next record. Note that
+ * inserting and erasing tags invalidates all iterators and references into the dictionary and that the tag id of the
+ * seqan3::sam_tag_dictionary::value_type is not const, but must not be modified, since the tags are kept sorted.
+ *
  * \sa seqan3::sam_tag_type
  * \sa https://en.cppreference.com/w/cpp/utility/variant
  * \sa https://samtools.github.io/hts-specs/SAMv1.pdf
  * \sa https://samtools.github.io/hts-specs/SAMtags.pdf
  */
-class sam_tag_dictionary : public std::map<uint16_t, detail::sam_tag_variant>
+class sam_tag_dictionary
 {
-private:
-    //!\brief The base type.
-    using base_type = std::map<uint16_t, detail::sam_tag_variant>;
-
 public:
     //!\brief The variant type defining all valid SAM tag field types.
     using variant_type = detail::sam_tag_variant;
 
+    /*!\name Associated types
+     * \{
+     */
+    using key_type        = uint16_t;                                //!< The tag id.
+    using mapped_type     = variant_type;                            //!< The value of a tag.
+    using value_type      = std::pair<key_type, mapped_type>;        //!< A tag and its value.
+    using size_type       = size_t;                                  //!< An unsigned integer type.
+    using difference_type = std::ptrdiff_t;                          //!< A signed integer type.
+    using reference       = value_type &;                            //!< The reference type.
+    using const_reference = value_type const &;                      //!< The const reference type.
+    using iterator        = std::vector<value_type>::iterator;       //!< The iterator type.
+    using const_iterator  = std::vector<value_type>::const_iterator; //!< The const iterator type.
+    using reverse_iterator       = std::reverse_iterator<iterator>;       //!< The reverse iterator type.
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>; //!< The const reverse iterator type.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_tag_dictionary() = default;                                       //!< Defaulted.
+    sam_tag_dictionary(sam_tag_dictionary const &) = default;             //!< Defaulted.
+    sam_tag_dictionary & operator=(sam_tag_dictionary const &) = default; //!< Defaulted.
+    sam_tag_dictionary(sam_tag_dictionary &&) = default;                  //!< Defaulted.
+    ~sam_tag_dictionary() = default;                                      //!< Defaulted.
+
+    /*!\brief Move assignment that keeps the memory of `*this` if the tags of `other` fit into it.
+     * \param[in] other The dictionary to move from.
+     *
+     * \details
+     *
+     * Files reset the fields of their record buffer by assigning `{}` before reading the next record. Keeping the
+     * memory means that reading the tags of a record does not allocate, unless it has more tags than all records
+     * before or tags that are long strings or arrays.
+     */
+    sam_tag_dictionary & operator=(sam_tag_dictionary && other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        if (entries.capacity() < other.entries.size())
+        {
+            entries = std::move(other.entries);
+        }
+        else
+        {
+            entries.clear();
+            std::move(other.entries.begin(), other.entries.end(), std::back_inserter(entries));
+        }
+
+        other.entries.clear();
+
+        return *this;
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \brief The tags are visited in ascending order of their id.
+     * \attention In contrast to std::map, inserting or erasing a tag invalidates all iterators and references.
+     * \{
+     */
+    //!\brief Returns an iterator to the first tag.
+    iterator begin() noexcept
+    {
+        return entries.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return entries.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return entries.cbegin();
+    }
+
+    //!\brief Returns an iterator behind the last tag.
+    iterator end() noexcept
+    {
+        return entries.end();
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return entries.end();
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return entries.cend();
+    }
+
+    //!\brief Returns a reverse iterator to the last tag.
+    reverse_iterator rbegin() noexcept
+    {
+        return entries.rbegin();
+    }
+
+    //!\copydoc rbegin()
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return entries.rbegin();
+    }
+
+    //!\copydoc rbegin()
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return entries.crbegin();
+    }
+
+    //!\brief Returns a reverse iterator before the first tag.
+    reverse_iterator rend() noexcept
+    {
+        return entries.rend();
+    }
+
+    //!\copydoc rend()
+    const_reverse_iterator rend() const noexcept
+    {
+        return entries.rend();
+    }
+
+    //!\copydoc rend()
+    const_reverse_iterator crend() const noexcept
+    {
+        return entries.crend();
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Whether the dictionary contains no tags.
+    bool empty() const noexcept
+    {
+        return entries.empty();
+    }
+
+    //!\brief The number of tags.
+    size_type size() const noexcept
+    {
+        return entries.size();
+    }
+
+    //!\brief The maximum number of tags.
+    size_type max_size() const noexcept
+    {
+        return entries.max_size();
+    }
+
+    //!\brief Reserves memory for `new_capacity` tags.
+    void reserve(size_type const new_capacity)
+    {
+        entries.reserve(new_capacity);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    //!\brief Returns an iterator to the value of `tag` or end() if the tag is not set.
+    iterator find(key_type const tag) noexcept
+    {
+        iterator it = lower_bound(tag);
+        return (it != end() && it->first == tag) ? it : end();
+    }
+
+    //!\copydoc find()
+    const_iterator find(key_type const tag) const noexcept
+    {
+        const_iterator it = lower_bound(tag);
+        return (it != end() && it->first == tag) ? it : end();
+    }
+
+    //!\brief Returns 1 if `tag` is set and 0 otherwise.
+    size_type count(key_type const tag) const noexcept
+    {
+        return find(tag) != end();
+    }
+
+    //!\brief Whether `tag` is set.
+    bool contains(key_type const tag) const noexcept
+    {
+        return find(tag) != end();
+    }
+
+    /*!\brief Returns the value of `tag`.
+     * \throws std::out_of_range if the tag is not set.
+     */
+    mapped_type & at(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == end())
+            throw std::out_of_range{"The SAM tag is not set in the seqan3::sam_tag_dictionary."};
+
+        return it->second;
+    }
+
+    //!\copydoc at()
+    mapped_type const & at(key_type const tag) const
+    {
+        const_iterator it = find(tag);
+
+        if (it == end())
+            throw std::out_of_range{"The SAM tag is not set in the seqan3::sam_tag_dictionary."};
+
+        return it->second;
+    }
+
+    //!\brief Returns the value of `tag`; inserts a value-initialised std::variant if the tag is not set.
+    mapped_type & operator[](key_type const tag)
+    {
+        return try_emplace(tag).first->second;
+    }
+
+    //!\brief Returns an iterator to the first tag that is not less than `tag`.
+    iterator lower_bound(key_type const tag) noexcept
+    {
+        return std::lower_bound(entries.begin(), entries.end(), tag,
+                                [] (value_type const & entry, key_type const key) { return entry.first < key; });
+    }
+
+    //!\copydoc lower_bound()
+    const_iterator lower_bound(key_type const tag) const noexcept
+    {
+        return std::lower_bound(entries.begin(), entries.end(), tag,
+                                [] (value_type const & entry, key_type const key) { return entry.first < key; });
+    }
+
+    //!\brief Returns an iterator to the first tag that is greater than `tag`.
+    iterator upper_bound(key_type const tag) noexcept
+    {
+        return std::upper_bound(entries.begin(), entries.end(), tag,
+                                [] (key_type const key, value_type const & entry) { return key < entry.first; });
+    }
+
+    //!\copydoc upper_bound()
+    const_iterator upper_bound(key_type const tag) const noexcept
+    {
+        return std::upper_bound(entries.begin(), entries.end(), tag,
+                                [] (key_type const key, value_type const & entry) { return key < entry.first; });
+    }
+
+    //!\brief Returns the range of tags equal to `tag`, i.e. the tag or an empty range.
+    std::pair<iterator, iterator> equal_range(key_type const tag) noexcept
+    {
+        return {lower_bound(tag), upper_bound(tag)};
+    }
+
+    //!\copydoc equal_range()
+    std::pair<const_iterator, const_iterator> equal_range(key_type const tag) const noexcept
+    {
+        return {lower_bound(tag), upper_bound(tag)};
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all tags; keeps the memory.
+    void clear() noexcept
+    {
+        entries.clear();
+    }
+
+    /*!\brief Inserts `tag` with the value constructed from `args` if the tag is not set yet.
+     * \returns An iterator to the value of `tag` and whether it was inserted.
+     */
+    template <typename ...args_t>
+    std::pair<iterator, bool> try_emplace(key_type const tag, args_t && ...args)
+    {
+        // tags are usually inserted in ascending order or read from files with few tags
+        iterator it = (entries.empty() || entries.back().first < tag) ? end() : lower_bound(tag);
+
+        if (it != end() && it->first == tag)
+            return {it, false};
+
+        return {entries.emplace(it, std::piecewise_construct,
+                                std::forward_as_tuple(tag),
+                                std::forward_as_tuple(std::forward<args_t>(args)...)),
+                true};
+    }
+
+    //!\brief Inserts `value` if its tag is not set yet; returns an iterator to the value and whether it was inserted.
+    std::pair<iterator, bool> insert(value_type value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    /*!\brief Inserts `value` if its tag is not set yet; `hint` is used if the tag belongs right before it.
+     * \returns An iterator to the value of the tag.
+     */
+    iterator insert(const_iterator hint, value_type value)
+    {
+        bool const hint_fits = (hint == cend() || value.first < hint->first) &&
+                               (hint == cbegin() || std::prev(hint)->first < value.first);
+
+        if (!hint_fits)
+            return insert(std::move(value)).first;
+
+        return entries.insert(hint, std::move(value));
+    }
+
+    //!\brief Inserts the tags of `[first, last)` that are not set yet.
+    template <typename input_iterator_t>
+    void insert(input_iterator_t first, input_iterator_t last)
+    {
+        for (; first != last; ++first)
+            insert(value_type{*first});
+    }
+
+    //!\brief Inserts the tags of `values` that are not set yet.
+    void insert(std::initializer_list<value_type> values)
+    {
+        insert(values.begin(), values.end());
+    }
+
+    /*!\brief Inserts the value_type constructed from `args` if its tag is not set yet.
+     * \returns An iterator to the value of the tag and whether it was inserted.
+     */
+    template <typename ...args_t>
+    std::pair<iterator, bool> emplace(args_t && ...args)
+    {
+        return insert(value_type(std::forward<args_t>(args)...));
+    }
+
+    //!\brief Inserts the value_type constructed from `args` if its tag is not set yet; see the hinted insert().
+    template <typename ...args_t>
+    iterator emplace_hint(const_iterator hint, args_t && ...args)
+    {
+        return insert(hint, value_type(std::forward<args_t>(args)...));
+    }
+
+    /*!\brief Sets `tag` to `value`, whether the tag is set already or not.
+     * \returns An iterator to the value of `tag` and whether it was inserted.
+     */
+    template <typename value_t>
+    std::pair<iterator, bool> insert_or_assign(key_type const tag, value_t && value)
+    {
+        std::pair<iterator, bool> result = try_emplace(tag, std::forward<value_t>(value));
+
+        if (!result.second)
+            result.first->second = std::forward<value_t>(value);
+
+        return result;
+    }
+
+    //!\brief Removes the tag that `it` points to; returns an iterator to the next tag.
+    iterator erase(const_iterator it)
+    {
+        return entries.erase(it);
+    }
+
+    //!\brief Removes `tag`; returns the number of removed tags (0 or 1).
+    size_type erase(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == end())
+            return 0;
+
+        entries.erase(it);
+        return 1;
+    }
+
+    //!\brief Exchanges the tags with those of `other`.
+    void swap(sam_tag_dictionary & other) noexcept
+    {
+        entries.swap(other.entries);
+    }
+    //!\}
+
+    //!\brief Exchanges the tags of `lhs` and `rhs`.
+    friend void swap(sam_tag_dictionary & lhs, sam_tag_dictionary & rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    //!\brief Whether both dictionaries contain the same tags with the same values.
+    friend bool operator==(sam_tag_dictionary const & lhs, sam_tag_dictionary const & rhs)
+    {
+        return lhs.entries == rhs.entries;
+    }
+
+    //!\brief Whether the dictionaries differ in a tag or a value.
+    friend bool operator!=(sam_tag_dictionary const & lhs, sam_tag_dictionary const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
     /*!\name Getter function for the seqan3::sam_tag_dictionary.
      *\brief Gets the value of known SAM tags by its correct type instead of the std::variant.
      * \tparam tag The unique tag id of a SAM tag.
@@ -346,7 +752,7 @@ public:
      * \{
      */
 
-    //!\brief Uses std::map::operator[] for access and default initializes new keys.
+    //!\brief Uses operator[] for access and default initializes new keys.
     template <uint16_t tag>
     //!\cond
         requires !std::same_as<sam_tag_type_t<tag>, variant_type>
@@ -359,7 +765,7 @@ public:
         return std::get<sam_tag_type_t<tag>>((*this)[tag]);
     }
 
-    //!\brief Uses std::map::operator[] for access and default initializes new keys.
+    //!\brief Uses operator[] for access and default initializes new keys.
     template <uint16_t tag>
     //!\cond
         requires !std::same_as<sam_tag_type_t<tag>, variant_type>
@@ -372,8 +778,8 @@ public:
         return std::get<sam_tag_type_t<tag>>(std::move((*this)[tag]));
     }
 
-    //!\brief Uses std::map::at() for access and throws when the key is unknown.
-    //!\throws std::out_of_range if map has no key `tag`.
+    //!\brief Uses at() for access and throws when the key is unknown.
+    //!\throws std::out_of_range if the dictionary has no key `tag`.
     template <uint16_t tag>
     //!\cond
         requires !std::same_as<sam_tag_type_t<tag>, variant_type>
@@ -383,8 +789,8 @@ public:
         return std::get<sam_tag_type_t<tag>>((*this).at(tag));
     }
 
-    //!\brief Uses std::map::at() for access and throws when the key is unknown.
-    //!\throws std::out_of_range if map has no key `tag`.
+    //!\brief Uses at() for access and throws when the key is unknown.
+    //!\throws std::out_of_range if the dictionary has no key `tag`.
     template <uint16_t tag>
     //!\cond
         requires !std::same_as<sam_tag_type_t<tag>, variant_type>
@@ -394,6 +800,10 @@ public:
         return std::get<sam_tag_type_t<tag>>(std::move((*this).at(tag)));
     }
     //!\}
+
+private:
+    //!\brief The tags and their values, sorted by tag.
+    std::vector<value_type> entries{};
 };
 
 } // namespace seqan3
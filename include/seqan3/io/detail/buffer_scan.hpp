@@ -0,0 +1,228 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides functions that scan the buffer of a seqan3::detail::fast_istreambuf_iterator block-wise.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/stream/iterator.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup io
+ * \{
+ */
+
+//!\brief How seqan3::detail::scan_buffer treats a character.
+enum class scan_action : uint8_t
+{
+    append,  //!< The character is passed to the output.
+    skip,    //!< The character is skipped.
+    stop,    //!< Scanning stops before the character.
+    invalid  //!< Scanning stops before the character; the caller reports an error.
+};
+
+//!\brief The result of seqan3::detail::scan_buffer.
+enum class scan_status : uint8_t
+{
+    stop,        //!< The iterator points to a character with seqan3::detail::scan_action::stop.
+    invalid,     //!< The iterator points to a character with seqan3::detail::scan_action::invalid.
+    limit,       //!< The maximum number of characters was passed to the output.
+    end_of_input //!< The end of the input was reached.
+};
+
+//!\brief The seqan3::detail::scan_action of every character.
+using scan_table = std::array<scan_action, 256>;
+
+/*!\brief Creates a seqan3::detail::scan_table from character predicates.
+ * \param[in] stop   Characters that end the scan; checked first.
+ * \param[in] skip   Characters that are skipped; checked second.
+ * \param[in] append Characters that are passed to the output; all other characters are invalid.
+ */
+template <typename stop_t, typename skip_t, typename append_t>
+inline scan_table make_scan_table(stop_t && stop, skip_t && skip, append_t && append)
+{
+    scan_table table{};
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        char const c = static_cast<char>(i);
+        if (stop(c))
+            table[i] = scan_action::stop;
+        else if (skip(c))
+            table[i] = scan_action::skip;
+        else if (append(c))
+            table[i] = scan_action::append;
+        else
+            table[i] = scan_action::invalid;
+    }
+    return table;
+}
+
+/*!\brief The result of seqan3::assign_char_to for every character, s.t. a character is converted by a single lookup.
+ * \tparam alphabet_t The target alphabet.
+ */
+template <typename alphabet_t>
+inline std::array<alphabet_t, 256> const & char_conversion_table()
+{
+    static std::array<alphabet_t, 256> const table = [] ()
+    {
+        std::array<alphabet_t, 256> result{};
+        for (size_t i = 0; i < result.size(); ++i)
+            result[i] = assign_char_to(static_cast<char>(i), alphabet_t{});
+        return result;
+    }();
+    return table;
+}
+
+/*!\brief Appends the characters in `[first, last)` converted to the value type of `container`.
+ * \details
+ *
+ * Containers that can be resized are resized once and the converted characters are written in place; all other
+ * containers are appended to character by character.
+ */
+template <typename container_t>
+inline void append_converted(container_t & container, char const * const first, char const * const last)
+{
+    using alphabet_t = value_type_t<container_t>;
+    auto const & table = char_conversion_table<alphabet_t>();
+
+    if constexpr (std::ranges::random_access_range<container_t> &&
+                  requires (container_t & c) { c.resize(size_t{}); c.size(); })
+    {
+        size_t const old_size = container.size();
+        container.resize(old_size + (last - first));
+        auto out = std::ranges::begin(container) + old_size;
+        for (char const * it = first; it != last; ++it, ++out)
+            *out = table[static_cast<unsigned char>(*it)];
+    }
+    else
+    {
+        for (char const * it = first; it != last; ++it)
+            container.push_back(table[static_cast<unsigned char>(*it)]);
+    }
+}
+
+/*!\brief Scans the input character by character table-driven, passing runs of characters to `output`.
+ * \param[in,out] it     The input iterator; afterwards points to the character the scan stopped at.
+ * \param[in]     table  The seqan3::detail::scan_action of every character.
+ * \param[in]     output Invoked with `(char const * first, char const * last)` for each run of appended characters.
+ * \param[in]     limit  The maximum number of characters passed to the output; the scan stops before the next
+ *                       appendable character once the limit is reached.
+ * \returns The reason the scan stopped.
+ *
+ * \details
+ *
+ * The characters are read directly from the buffer of the stream; consecutive appendable characters (e.g. a line of a
+ * sequence) are passed to the output at once instead of one by one.
+ */
+template <typename output_t>
+inline scan_status scan_buffer(fast_istreambuf_iterator<char> & it,
+                               scan_table const & table,
+                               output_t && output,
+                               size_t limit = std::numeric_limits<size_t>::max())
+{
+    for (auto buffer = it.buffered(); !buffer.empty(); buffer = it.buffered())
+    {
+        char const * const first = buffer.data();
+        char const * const last = first + buffer.size();
+        char const * run_begin = first;
+
+        for (char const * current = first; current != last; ++current)
+        {
+            scan_action const action = table[static_cast<unsigned char>(*current)];
+
+            if (action == scan_action::append)
+            {
+                if (limit == 0)
+                {
+                    if (run_begin != current)
+                        output(run_begin, current);
+                    it.skip_buffered(current - first);
+                    return scan_status::limit;
+                }
+                --limit;
+            }
+            else
+            {
+                if (run_begin != current)
+                    output(run_begin, current);
+                run_begin = current + 1;
+
+                if (action != scan_action::skip)
+                {
+                    it.skip_buffered(current - first);
+                    return action == scan_action::stop ? scan_status::stop : scan_status::invalid;
+                }
+            }
+        }
+
+        if (run_begin != last)
+            output(run_begin, last);
+        it.skip_buffered(last - first);
+    }
+
+    return scan_status::end_of_input;
+}
+
+/*!\brief Skips the input up to and including the next `delimiter`, searching the buffer with `std::memchr`.
+ * \returns `true` if the delimiter was found, `false` if the end of the input was reached.
+ */
+inline bool skip_buffer_past(fast_istreambuf_iterator<char> & it, char const delimiter)
+{
+    for (auto buffer = it.buffered(); !buffer.empty(); buffer = it.buffered())
+    {
+        void const * const found = std::memchr(buffer.data(), delimiter, buffer.size());
+        if (found != nullptr)
+        {
+            it.skip_buffered(static_cast<char const *>(found) - buffer.data() + 1);
+            return true;
+        }
+        it.skip_buffered(buffer.size());
+    }
+
+    return false;
+}
+
+/*!\brief Appends the characters before the first one that satisfies `is_delimiter` to `container` and skips the
+ *        rest of the line.
+ * \param[in,out] it           The input iterator; afterwards points to the beginning of the next line.
+ * \param[in]     is_delimiter A stateless character predicate, e.g. `is_cntrl || is_blank`.
+ * \param[out]    container    The container the characters are appended to.
+ * \returns `false` if the end of the input was reached before the end of the line.
+ */
+template <typename delimiter_t, typename container_t>
+inline bool read_line_until(fast_istreambuf_iterator<char> & it, delimiter_t const & is_delimiter,
+                            container_t & container)
+{
+    static scan_table const table = make_scan_table(is_delimiter,
+                                                    [] (char) { return false; },
+                                                    [] (char) { return true; });
+
+    if (scan_buffer(it, table, [&container] (char const * first, char const * last)
+        {
+            append_converted(container, first, last);
+        }) == scan_status::end_of_input)
+    {
+        return false;
+    }
+
+    return skip_buffer_past(it, '\n');
+}
+
+//!\}
+
+} // namespace seqan3::detail
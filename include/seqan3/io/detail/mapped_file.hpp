@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::mapped_file.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/filesystem>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SEQAN3_HAS_MMAP 1
+#else
+#define SEQAN3_HAS_MMAP 0
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only memory mapping of a file.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The file is mapped into memory with `mmap` on POSIX systems, s.t. its content is only loaded by the operating system
+ * when it is accessed and no copy is made. On other systems, the file is read into memory on construction.
+ *
+ * This class assumes owning semantics; it is move-only.
+ */
+class mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_file() = default;                                   //!< Defaulted.
+    mapped_file(mapped_file const &) = delete;                 //!< Deleted.
+    mapped_file & operator=(mapped_file const &) = delete;     //!< Deleted.
+
+    //!\brief Takes over the mapping of `other`.
+    mapped_file(mapped_file && other) noexcept
+    {
+        swap(other);
+    }
+
+    //!\brief Takes over the mapping of `other`.
+    mapped_file & operator=(mapped_file && other) noexcept
+    {
+        mapped_file{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    /*!\brief Maps the file at `path` into memory.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     */
+    explicit mapped_file(std::filesystem::path const & path)
+    {
+#if SEQAN3_HAS_MMAP
+        int const descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor == -1)
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        struct stat status{};
+        if (::fstat(descriptor, &status) == -1)
+        {
+            ::close(descriptor);
+            throw file_open_error{"Could not determine the size of file " + path.string() + "."};
+        }
+
+        size = static_cast<size_t>(status.st_size);
+        if (size > 0)
+        {
+            void * const address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (address == MAP_FAILED)
+            {
+                ::close(descriptor);
+                throw file_open_error{"Could not map file " + path.string() + " into memory."};
+            }
+            data = static_cast<char const *>(address);
+            ::madvise(address, size, MADV_SEQUENTIAL);
+        }
+        ::close(descriptor); // the mapping stays valid
+#else
+        std::ifstream stream{path, std::ios_base::in | std::ios::binary};
+        if (!stream.good())
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        buffer.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+        data = buffer.data();
+        size = buffer.size();
+#endif
+    }
+
+    //!\brief Unmaps the file.
+    ~mapped_file()
+    {
+#if SEQAN3_HAS_MMAP
+        if (data != nullptr)
+            ::munmap(const_cast<char *>(data), size);
+#endif
+    }
+    //!\}
+
+    //!\brief The content of the file.
+    std::string_view view() const noexcept
+    {
+        return {data, size};
+    }
+
+private:
+    //!\brief Swaps the mappings of `*this` and `other`.
+    void swap(mapped_file & other) noexcept
+    {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+#if !SEQAN3_HAS_MMAP
+        std::swap(buffer, other.buffer);
+        data = buffer.data(); // the characters of short strings do not move with the string
+        other.data = other.buffer.data();
+#endif
+    }
+
+    //!\brief The first byte of the file.
+    char const * data{nullptr};
+    //!\brief The size of the file in bytes.
+    size_t size{0};
+#if !SEQAN3_HAS_MMAP
+    //!\brief The content of the file if it cannot be mapped.
+    std::string buffer{};
+#endif
+};
+
+} // namespace seqan3::detail
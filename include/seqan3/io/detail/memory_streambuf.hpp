@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_streambuf and seqan3::detail::string_streambuf.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <streambuf>
+#include <string>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief A stream buffer that reads from a chunk of memory without copying it.
+//!\ingroup io
+class memory_streambuf : public std::streambuf
+{
+public:
+    //!\brief Reads from the characters in `[first, last)`.
+    memory_streambuf(char * const first, char * const last)
+    {
+        setg(first, first, last);
+    }
+};
+
+/*!\brief A stream buffer that writes into a std::string and keeps its memory when it is reused.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The characters are written directly into the string, which is cleared on construction and shrunk to the written
+ * characters on destruction; the string must not be accessed in between.
+ */
+class string_streambuf : public std::streambuf
+{
+public:
+    //!\brief Writes into `target`, overwriting its content.
+    explicit string_streambuf(std::string & target) : target{target}
+    {
+        target.resize(target.capacity());
+        set_put_area(0);
+    }
+
+    //!\brief Shrinks the string to the written characters.
+    ~string_streambuf() override
+    {
+        target.resize(pptr() - pbase());
+    }
+
+protected:
+    //!\brief Doubles the size of the string and appends `ch`.
+    int_type overflow(int_type const ch) override
+    {
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+            return traits_type::not_eof(ch);
+
+        size_t const written = pptr() - pbase();
+        target.resize(std::max<size_t>(2 * target.size(), 256));
+        set_put_area(written);
+
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        return ch;
+    }
+
+private:
+    //!\brief The string written to.
+    std::string & target;
+
+    //!\brief Makes the whole string the put area; the first `written` characters are kept.
+    void set_put_area(size_t written)
+    {
+        setp(target.data(), target.data() + target.size());
+
+        for (; written > INT_MAX; written -= INT_MAX) // pbump only takes an int
+            pbump(INT_MAX);
+        pbump(static_cast<int>(written));
+    }
+};
+
+} // namespace seqan3::detail
@@ -25,6 +25,9 @@
     #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
     #include <seqan3/contrib/stream/gz_istream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_istream.hpp>
+#endif
 #include <seqan3/io/detail/magic_header.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/concepts>
@@ -150,7 +153,14 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
     }
     else if (starts_with(magic_number, zstd_compression::magic_header)) // ZStd
     {
-        throw file_open_error{"Trying to read from a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        if (contains_extension(zstd_compression{}, extension))
+            filename.replace_extension();
+
+        return {new contrib::basic_zstd_istream<char_t>{primary_stream}, stream_deleter_default};
+    #else
+        throw file_open_error{"Trying to read from a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <iostream>
+#include <optional>
 #include <string>
 #include <tuple>
 
@@ -24,6 +25,9 @@
     #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
 #include <seqan3/std/filesystem>
 
 namespace seqan3::detail
@@ -69,10 +73,43 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     }
     else if (extension == ".zst")
     {
-        throw file_open_error{"Trying to write a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        filename.replace_extension("");
+        return {new contrib::basic_zstd_ostream<char_t>{primary_stream}, stream_deleter_default};
+    #else
+        throw file_open_error{"Trying to write a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
 }
 
+/*!\brief Sets the compression level of a stream created by seqan3::detail::make_secondary_ostream.
+ * \param[in,out] secondary_stream The secondary stream.
+ * \param[in]     level            The compression level; clamped to the levels supported by the codec. If no level
+ *                                 is given, the stream keeps the default level of its codec.
+ *
+ * \details
+ *
+ * Only BGZF streams (`.gz`, `.bgzf` and `.bam`) and zstd streams (`.zst`) have a configurable level; other streams
+ * are not changed. The level of a BGZF stream applies to all blocks that are compressed after the call, the level of
+ * a zstd stream must be set before the first bytes are compressed.
+ */
+template <builtin_character char_t>
+inline void set_compression_level([[maybe_unused]] std::basic_ostream<char_t> & secondary_stream,
+                                  std::optional<int> const level)
+{
+    if (!level)
+        return;
+
+#ifdef SEQAN3_HAS_ZLIB
+    if (auto * bgzf_stream = dynamic_cast<contrib::basic_bgzf_ostream<char_t> *>(&secondary_stream))
+        bgzf_stream->rdbuf()->set_compression_level(*level);
+#endif
+#ifdef SEQAN3_HAS_ZSTD
+    if (auto * zstd_stream = dynamic_cast<contrib::basic_zstd_ostream<char_t> *>(&secondary_stream))
+        zstd_stream->rdbuf()->set_compression_level(*level);
+#endif
+}
+
 } // namespace seqan3::detail
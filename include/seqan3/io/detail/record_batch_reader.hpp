@@ -0,0 +1,300 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::read_record_batches.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <istream>
+#include <iterator>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/detail/memory_streambuf.hpp>
+#include <seqan3/io/sequence_file/format_fasta.hpp>
+#include <seqan3/io/sequence_file/format_fastq.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup io
+ * \{
+ */
+
+/*!\name Record boundaries
+ * \brief Returns the end of the last complete record in `chunk`, which begins with a record, or
+ *        std::string_view::npos if `chunk` holds no complete record.
+ * \{
+ */
+//!\brief A FastA record ends before a line that begins with '>' or ';'.
+inline size_t last_record_end(format_fasta const &, std::string_view const chunk)
+{
+    size_t const gt = chunk.rfind("\n>");
+    size_t const semicolon = chunk.rfind("\n;");
+
+    if (gt == std::string_view::npos && semicolon == std::string_view::npos)
+        return std::string_view::npos;
+
+    if (gt == std::string_view::npos)
+        return semicolon + 1;
+    if (semicolon == std::string_view::npos)
+        return gt + 1;
+    return std::max(gt, semicolon) + 1;
+}
+
+/*!\brief A FastQ record ends after as many qualities as its sequence has characters.
+ *
+ * \details
+ *
+ * Like seqan3::format_fastq, the sequence and the qualities may span several lines and whitespace is ignored, i.e. the
+ * records are found by counting the characters of the sequence and of the qualities, not the lines.
+ */
+inline size_t last_record_end(format_fastq const &, std::string_view const chunk)
+{
+    auto is_space = [] (char const c) { return c == ' ' || (c >= '\t' && c <= '\r'); };
+
+    size_t record_end = std::string_view::npos;
+    size_t pos = 0;
+
+    while (pos < chunk.size())
+    {
+        // the ID line, the sequence and the 2nd ID line
+        size_t const id_end = chunk.find('\n', pos);
+        if (id_end == std::string_view::npos)
+            break;
+
+        size_t const second_id = chunk.find('+', id_end + 1);
+        if (second_id == std::string_view::npos)
+            break;
+
+        size_t const second_id_end = chunk.find('\n', second_id);
+        if (second_id_end == std::string_view::npos)
+            break;
+
+        size_t const sequence_size = std::count_if(chunk.begin() + id_end + 1, chunk.begin() + second_id,
+                                                   [&] (char const c) { return !is_space(c); });
+
+        // the qualities, which may contain '@' and '+'
+        pos = second_id_end + 1;
+        for (size_t quality_count = 0; quality_count < sequence_size && pos < chunk.size(); ++pos)
+            quality_count += !is_space(chunk[pos]);
+
+        // the rest of the last quality line
+        while (pos < chunk.size() && chunk[pos] != '\n' && is_space(chunk[pos]))
+            ++pos;
+
+        if (pos == chunk.size())
+            break;
+
+        if (chunk[pos] == '\n')
+            ++pos;
+
+        record_end = pos;
+    }
+
+    return record_end;
+}
+//!\}
+
+//!\brief A format whose records can be found in a chunk of the file by seqan3::detail::last_record_end.
+//!\cond
+template <typename format_t>
+SEQAN3_CONCEPT record_splittable_format = requires (format_t const & format, std::string_view const chunk)
+{
+    { last_record_end(format, chunk) } -> size_t;
+};
+//!\endcond
+
+/*!\brief Reads record-aligned chunks of `stream` and parses them into batches of records on `thread_count` threads.
+ * \tparam record_t The type of the records.
+ * \param[in] stream       The (decompressed) input stream; must be at the beginning of a record.
+ * \param[in] thread_count The number of threads parsing the chunks.
+ * \param[in] chunk_size   The number of bytes read at once; a chunk holds all complete records of at least this many
+ *                         bytes.
+ * \param[in] record_end   Invocable with a `std::string_view`; returns the end of the last complete record in it or
+ *                         std::string_view::npos.
+ * \param[in] parse        Invocable with an `std::istream &` and a `record_t &`; reads the next record. Every
+ *                         thread parses with its own copy, s.t. a parser may keep state.
+ * \param[in] delegate     Invoked with each batch (a `std::vector<record_t> &`) on the calling thread, in file order.
+ * \throws Any exception thrown while parsing a chunk is rethrown when its batch is due.
+ *
+ * \details
+ *
+ * The calling thread reads chunks of `chunk_size` bytes and cuts them after the last complete record; the remainder
+ * is prepended to the next chunk. The worker threads parse the chunks into batches of records while the calling thread
+ * reads ahead (up to two chunks per thread) and passes the finished batches to the delegate in the order of the file.
+ * The chunks and batches are reused, s.t. the records keep the memory of their fields.
+ */
+template <typename record_t, typename record_end_t, typename parse_t, typename delegate_t>
+inline void read_record_batches(std::istream & stream,
+                                size_t const thread_count,
+                                size_t const chunk_size,
+                                record_end_t && record_end,
+                                parse_t && parse,
+                                delegate_t && delegate)
+{
+    // A chunk of the file and the records parsed from it.
+    struct slot_type
+    {
+        std::string chunk{};
+        std::vector<record_t> records{};
+        std::exception_ptr error{};
+        bool done{false};
+    };
+
+    std::vector<slot_type> slots(2 * std::max<size_t>(thread_count, 1));
+    std::mutex slot_mutex{};
+    std::condition_variable slot_done{};
+    contrib::fixed_buffer_queue<size_t> tasks{slots.size()};
+
+    auto parse_slot = [] (slot_type & slot, auto & parse_record)
+    {
+        memory_streambuf buffer{slot.chunk.data(), slot.chunk.data() + slot.chunk.size()};
+        std::istream chunk_stream{&buffer};
+
+        size_t count = 0;
+        while (std::istreambuf_iterator<char>{chunk_stream} != std::istreambuf_iterator<char>{})
+        {
+            if (count == slot.records.size())
+                slot.records.emplace_back();
+            else
+                slot.records[count].clear();
+
+            parse_record(chunk_stream, slot.records[count]);
+            ++count;
+        }
+        slot.records.resize(count);
+    };
+
+    std::vector<std::thread> workers{};
+
+    // Stops the workers on return and also if the delegate or the input throws.
+    struct worker_guard
+    {
+        contrib::fixed_buffer_queue<size_t> & tasks;
+        std::vector<std::thread> & workers;
+
+        ~worker_guard()
+        {
+            tasks.close();
+            for (std::thread & worker : workers)
+                if (worker.joinable())
+                    worker.join();
+        }
+    } guard{tasks, workers};
+
+    for (size_t i = 0; i < std::max<size_t>(thread_count, 1); ++i)
+    {
+        workers.emplace_back([&, parse_record = parse] () mutable
+        {
+            for (;;)
+            {
+                size_t index{};
+                if (tasks.wait_pop(index) == contrib::queue_op_status::closed)
+                    return;
+
+                slot_type & slot = slots[index];
+                try
+                {
+                    parse_slot(slot, parse_record);
+                }
+                catch (...)
+                {
+                    slot.error = std::current_exception();
+                }
+
+                {
+                    std::lock_guard lock{slot_mutex};
+                    slot.done = true;
+                }
+                slot_done.notify_all();
+            }
+        });
+    }
+
+    // Fills `chunk` with the carried over bytes and complete records read from the stream.
+    std::string carry_over{};
+    bool at_end = false;
+    auto read_chunk = [&] (std::string & chunk)
+    {
+        chunk.assign(carry_over);
+        carry_over.clear();
+
+        while (!at_end)
+        {
+            size_t const old_size = chunk.size();
+            chunk.resize(old_size + chunk_size);
+            stream.read(chunk.data() + old_size, chunk_size);
+            chunk.resize(old_size + stream.gcount());
+
+            if (!stream) // the rest of the file is the last chunk
+            {
+                at_end = true;
+                break;
+            }
+
+            size_t const end = record_end(std::string_view{chunk});
+            if (end != std::string_view::npos && end > 0)
+            {
+                carry_over.assign(chunk, end, std::string::npos);
+                chunk.resize(end);
+                break;
+            }
+        }
+    };
+
+    size_t next_read = 0;
+    size_t next_delivery = 0;
+    while (true)
+    {
+        // read ahead into all slots whose batch was delivered
+        while (!at_end && next_read - next_delivery < slots.size())
+        {
+            slot_type & slot = slots[next_read % slots.size()];
+            read_chunk(slot.chunk);
+            if (slot.chunk.empty())
+                break;
+
+            slot.done = false;
+            slot.error = nullptr;
+            [[maybe_unused]] contrib::queue_op_status status = tasks.wait_push(next_read % slots.size());
+            assert(status == contrib::queue_op_status::success);
+            ++next_read;
+        }
+
+        if (next_delivery == next_read)
+            break;
+
+        slot_type & slot = slots[next_delivery % slots.size()];
+        {
+            std::unique_lock lock{slot_mutex};
+            slot_done.wait(lock, [&slot] () { return slot.done; });
+        }
+
+        if (slot.error)
+            std::rethrow_exception(slot.error);
+
+        delegate(slot.records);
+        ++next_delivery;
+    }
+}
+
+//!\}
+
+} // namespace seqan3::detail
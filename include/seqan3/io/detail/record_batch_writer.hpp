@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::write_record_batches.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/detail/memory_streambuf.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Formats batches of records on `thread_count` threads and writes them to `stream` in order.
+ * \ingroup io
+ * \tparam batch_t The type of a batch of records; must be default constructible.
+ * \param[out] stream       The (compressing) output stream.
+ * \param[in]  thread_count The number of threads formatting the batches.
+ * \param[in]  fill         Invocable with a `batch_t &`; replaces the batch by the next records and returns `false` if
+ *                          there are none.
+ * \param[in]  format       Invocable with a `batch_t const &` and an `std::ostream &`; writes the records of the batch.
+ *                          Every thread formats with its own copy, s.t. a formatter may keep state.
+ * \throws Any exception thrown while formatting a batch is rethrown when its bytes are due.
+ *
+ * \details
+ *
+ * The calling thread fills the batches (up to two per thread ahead of the stream) while the worker threads format
+ * them into memory. The formatted bytes are written to the stream on the calling thread in the order of the batches,
+ * s.t. the compression threads of a BGZF stream receive them as if the records had been written one by one.
+ * The batches and their byte buffers are reused.
+ */
+template <typename batch_t, typename fill_t, typename format_t>
+inline void write_record_batches(std::ostream & stream,
+                                 size_t const thread_count,
+                                 fill_t && fill,
+                                 format_t && format)
+{
+    // A batch of records and the bytes formatted from it.
+    struct slot_type
+    {
+        batch_t batch{};
+        std::string bytes{};
+        std::exception_ptr error{};
+        bool done{false};
+    };
+
+    std::vector<slot_type> slots(2 * std::max<size_t>(thread_count, 1));
+    std::mutex slot_mutex{};
+    std::condition_variable slot_done{};
+    contrib::fixed_buffer_queue<size_t> tasks{slots.size()};
+
+    std::vector<std::thread> workers{};
+
+    // Stops the workers on return and also if filling, formatting or the stream throws.
+    struct worker_guard
+    {
+        contrib::fixed_buffer_queue<size_t> & tasks;
+        std::vector<std::thread> & workers;
+
+        ~worker_guard()
+        {
+            tasks.close();
+            for (std::thread & worker : workers)
+                if (worker.joinable())
+                    worker.join();
+        }
+    } guard{tasks, workers};
+
+    for (size_t i = 0; i < std::max<size_t>(thread_count, 1); ++i)
+    {
+        workers.emplace_back([&, format_batch = format] () mutable
+        {
+            for (;;)
+            {
+                size_t index{};
+                if (tasks.wait_pop(index) == contrib::queue_op_status::closed)
+                    return;
+
+                slot_type & slot = slots[index];
+                try
+                {
+                    string_streambuf buffer{slot.bytes};
+                    std::ostream bytes_stream{&buffer};
+                    format_batch(static_cast<batch_t const &>(slot.batch), bytes_stream);
+                }
+                catch (...)
+                {
+                    slot.error = std::current_exception();
+                }
+
+                {
+                    std::lock_guard lock{slot_mutex};
+                    slot.done = true;
+                }
+                slot_done.notify_all();
+            }
+        });
+    }
+
+    size_t next_fill = 0;
+    size_t next_write = 0;
+    bool at_end = false;
+    while (true)
+    {
+        // fill all slots whose bytes were written
+        while (!at_end && next_fill - next_write < slots.size())
+        {
+            slot_type & slot = slots[next_fill % slots.size()];
+            if (!fill(slot.batch))
+            {
+                at_end = true;
+                break;
+            }
+
+            slot.done = false;
+            slot.error = nullptr;
+            [[maybe_unused]] contrib::queue_op_status status = tasks.wait_push(next_fill % slots.size());
+            assert(status == contrib::queue_op_status::success);
+            ++next_fill;
+        }
+
+        if (next_write == next_fill)
+            break;
+
+        slot_type & slot = slots[next_write % slots.size()];
+        {
+            std::unique_lock lock{slot_mutex};
+            slot_done.wait(lock, [&slot] () { return slot.done; });
+        }
+
+        if (slot.error)
+            std::rethrow_exception(slot.error);
+
+        stream.write(slot.bytes.data(), slot.bytes.size());
+        ++next_write;
+    }
+}
+
+} // namespace seqan3::detail
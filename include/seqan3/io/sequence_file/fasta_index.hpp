@@ -0,0 +1,289 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fasta_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/char_operations/predicate.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+//!\brief An entry of a seqan3::fasta_index; the columns of a line of a `.fai` file.
+//!\ingroup sequence
+struct fasta_index_entry
+{
+    //!\brief The name of the sequence (the ID up to the first whitespace).
+    std::string name{};
+    //!\brief The length of the sequence.
+    uint64_t length{};
+    //!\brief The offset of the first character of the sequence in the file.
+    uint64_t offset{};
+    //!\brief The number of sequence characters per line.
+    uint64_t line_bases{};
+    //!\brief The number of bytes per line, including the line break.
+    uint64_t line_bytes{};
+
+    //!\brief Two entries are equal if all members are equal.
+    friend bool operator==(fasta_index_entry const & lhs, fasta_index_entry const & rhs) noexcept
+    {
+        return lhs.name == rhs.name && lhs.length == rhs.length && lhs.offset == rhs.offset &&
+               lhs.line_bases == rhs.line_bases && lhs.line_bytes == rhs.line_bytes;
+    }
+
+    //!\brief Two entries are unequal if any member is unequal.
+    friend bool operator!=(fasta_index_entry const & lhs, fasta_index_entry const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/*!\brief The index of a FastA file (`.fai`) for random access to its sequences.
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * A FastA index stores the length of each sequence, the offset of its first character in the file and the length of
+ * its lines (samtools `faidx` format). Since all lines of a sequence except the last one have the same length, the
+ * offset of any position of a sequence is computed arithmetically, s.t. a region of a sequence is read by seeking to
+ * its first character and reading only the bytes of the region.
+ *
+ * The index is built from an uncompressed FastA file or read from a `.fai` file:
+ *
+ * \include test/snippet/io/sequence_file/fasta_index.cpp
+ */
+class fasta_index
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fasta_index() = default;                                //!< Defaulted.
+    fasta_index(fasta_index const &) = default;             //!< Defaulted.
+    fasta_index(fasta_index &&) = default;                  //!< Defaulted.
+    fasta_index & operator=(fasta_index const &) = default; //!< Defaulted.
+    fasta_index & operator=(fasta_index &&) = default;      //!< Defaulted.
+    ~fasta_index() = default;                               //!< Defaulted.
+
+    /*!\brief Builds the index of the FastA file in `fasta_stream`.
+     * \param[in] fasta_stream An uncompressed FastA file.
+     * \throws seqan3::format_error if the lines of a sequence have different lengths (except the last one) or a
+     *         sequence name occurs twice.
+     */
+    explicit fasta_index(std::istream & fasta_stream)
+    {
+        uint64_t offset = 0;
+        bool after_short_line = false;
+
+        for (std::string line; std::getline(fasta_stream, line); )
+        {
+            uint64_t const line_bytes = line.size() + (fasta_stream.eof() ? 0 : 1);
+            uint64_t const line_bases = line.size() - (!line.empty() && line.back() == '\r');
+            offset += line_bytes;
+
+            if (!line.empty() && (line[0] == '>' || line[0] == ';'))
+            {
+                size_t const name_begin = std::min(line.find_first_not_of(" \t", 1), line.size());
+                size_t const name_end = std::min(line.find_first_of(" \t\r", name_begin), line.size());
+                add_entry(fasta_index_entry{line.substr(name_begin, name_end - name_begin), 0, offset, 0, 0});
+                after_short_line = false;
+                continue;
+            }
+
+            if (entries.empty() || line_bases == 0)
+            {
+                after_short_line = !entries.empty();
+                continue;
+            }
+
+            fasta_index_entry & entry = entries.back();
+            if (entry.line_bases == 0) // first line of the sequence
+            {
+                entry.line_bases = line_bases;
+                entry.line_bytes = line_bytes;
+            }
+            else if (after_short_line || line_bases > entry.line_bases ||
+                     (!fasta_stream.eof() && line_bytes - line_bases != entry.line_bytes - entry.line_bases))
+            {
+                throw format_error{"The lines of the FastA sequence " + entry.name + " have different lengths; "
+                                   "it cannot be indexed."};
+            }
+
+            after_short_line = line_bases < entry.line_bases;
+            entry.length += line_bases;
+        }
+    }
+    //!\}
+
+    /*!\name .fai files
+     * \{
+     */
+    /*!\brief Reads the index from a `.fai` file.
+     * \throws seqan3::format_error if a line does not consist of five tab-separated columns, or if the bases per line
+     *         are 0 for a non-empty sequence or exceed the bytes per line.
+     */
+    static fasta_index read_fai(std::istream & fai_stream)
+    {
+        fasta_index index{};
+        for (std::string line; std::getline(fai_stream, line); )
+        {
+            if (line.empty())
+                continue;
+
+            fasta_index_entry entry{};
+            size_t column_begin = line.find('\t');
+            if (column_begin == std::string::npos)
+                throw format_error{"Invalid line in .fai file: " + line};
+            entry.name = line.substr(0, column_begin);
+
+            for (uint64_t * column : {&entry.length, &entry.offset, &entry.line_bases, &entry.line_bytes})
+            {
+                try
+                {
+                    size_t parsed{};
+                    *column = std::stoull(line.substr(column_begin + 1), &parsed);
+                    column_begin += parsed + 1;
+                }
+                catch (std::logic_error const &)
+                {
+                    throw format_error{"Invalid line in .fai file: " + line};
+                }
+            }
+
+            // the regions are located by dividing by the bases per line
+            if ((entry.length > 0 && entry.line_bases == 0) || entry.line_bytes < entry.line_bases)
+                throw format_error{"Invalid line lengths in .fai file: " + line};
+
+            index.add_entry(std::move(entry));
+        }
+        return index;
+    }
+
+    //!\brief Writes the index as `.fai` file.
+    void write_fai(std::ostream & fai_stream) const
+    {
+        for (fasta_index_entry const & entry : entries)
+        {
+            fai_stream << entry.name << '\t' << entry.length << '\t' << entry.offset << '\t'
+                       << entry.line_bases << '\t' << entry.line_bytes << '\n';
+        }
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    //!\brief The entries in the order of the file.
+    std::vector<fasta_index_entry> const & all() const noexcept
+    {
+        return entries;
+    }
+
+    //!\brief Whether a sequence is named `name`.
+    bool contains(std::string_view const name) const
+    {
+        return positions.find(std::string{name}) != positions.end();
+    }
+
+    /*!\brief The entry of the sequence named `name`.
+     * \throws std::out_of_range if no sequence is named `name`.
+     */
+    fasta_index_entry const & at(std::string_view const name) const
+    {
+        auto const it = positions.find(std::string{name});
+        if (it == positions.end())
+            throw std::out_of_range{"The FastA index contains no sequence named " + std::string{name} + "."};
+        return entries[it->second];
+    }
+    //!\}
+
+    /*!\brief Reads the region `[begin, end)` of the sequence named `name` from `fasta_stream` into `sequence`.
+     * \param[in]  fasta_stream The indexed FastA file; must be seekable.
+     * \param[in]  name         The name of the sequence.
+     * \param[in]  begin        The first position of the region.
+     * \param[in]  end          The position behind the region.
+     * \param[out] sequence     The characters of the region are converted and appended to this container.
+     * \throws std::out_of_range if no sequence is named `name` or the region is not part of the sequence.
+     * \throws seqan3::io_error if the region could not be read.
+     *
+     * \details
+     *
+     * Only the bytes of the region are read from the stream.
+     */
+    template <typename sequence_t>
+    //!\cond
+        requires writable_alphabet<value_type_t<sequence_t>>
+    //!\endcond
+    void read_region(std::istream & fasta_stream,
+                     std::string_view const name,
+                     uint64_t const begin,
+                     uint64_t const end,
+                     sequence_t & sequence) const
+    {
+        fasta_index_entry const & entry = at(name);
+        if (begin > end || end > entry.length)
+        {
+            throw std::out_of_range{"The region [" + std::to_string(begin) + ", " + std::to_string(end) +
+                                    ") is not part of the sequence " + entry.name + "."};
+        }
+
+        if (begin == end)
+            return;
+
+        uint64_t const first = byte_offset(entry, begin);
+        uint64_t const last = byte_offset(entry, end - 1) + 1;
+
+        std::string buffer(last - first, '\0');
+        fasta_stream.clear();
+        fasta_stream.seekg(first);
+        fasta_stream.read(buffer.data(), buffer.size());
+        if (static_cast<uint64_t>(fasta_stream.gcount()) != buffer.size())
+            throw io_error{"Could not read the region of the sequence " + entry.name + "."};
+
+        for (char const c : buffer)
+            if (!is_space(c))
+                sequence.push_back(assign_char_to(c, value_type_t<sequence_t>{}));
+    }
+
+private:
+    //!\brief The byte offset of `position` of the sequence of `entry` in the file.
+    static uint64_t byte_offset(fasta_index_entry const & entry, uint64_t const position) noexcept
+    {
+        return entry.offset + position / entry.line_bases * entry.line_bytes + position % entry.line_bases;
+    }
+
+    //!\brief Appends `entry` to the index.
+    void add_entry(fasta_index_entry entry)
+    {
+        if (!positions.emplace(entry.name, entries.size()).second)
+            throw format_error{"The sequence name " + entry.name + " occurs more than once in the FastA index."};
+        entries.push_back(std::move(entry));
+    }
+
+    //!\brief The entries in the order of the file.
+    std::vector<fasta_index_entry> entries{};
+    //!\brief The position of each entry in `entries` by name.
+    std::unordered_map<std::string, size_t> positions{};
+};
+
+} // namespace seqan3
@@ -22,6 +22,7 @@
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/detail/buffer_scan.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
@@ -191,23 +192,8 @@ private:
                 for (; (it != e) && (is_id || is_blank)(*it); ++it)
                 {}
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_cntrl || is_blank)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, value_type_t<id_type>{}));
-                }
-
-                if (!at_delimiter)
+                if (!detail::read_line_until(it, is_cntrl || is_blank, id))
                     throw unexpected_end_of_input{"FastA ID line did not end in newline."};
-
-                for (; (it != e) && ((!is_char<'\n'>)(*it)); ++it)
-                {}
-
             #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
 
                 std::ranges::copy(stream_view | std::views::drop_while(is_id || is_blank)        // skip leading >
@@ -228,20 +214,8 @@ private:
                 for (; (it != e) && (is_id || is_blank)(*it); ++it)
                 {}
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_char<'\n'>)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, value_type_t<id_type>{}));
-                }
-
-                if (!at_delimiter)
+                if (!detail::read_line_until(it, is_char<'\r'> || is_char<'\n'>, id))
                     throw unexpected_end_of_input{"FastA ID line did not end in newline."};
-
             #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
 
                 std::ranges::copy(stream_view | views::take_line_or_throw                    // read line
@@ -272,21 +246,23 @@ private:
             auto constexpr not_in_alph = !is_in_alphabet<seq_legal_alph_type>;
 
         #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+            // one lookup per character decides whether it ends the sequence, is ignored, appended or illegal
+            static detail::scan_table const table = detail::make_scan_table(is_id,
+                                                                            is_space || is_digit,
+                                                                            !not_in_alph);
             auto it = stream_view.begin();
-            auto e = stream_view.end();
-            for (; (it != e) && ((!is_id)(*it)); ++it)
+            detail::scan_status const status = detail::scan_buffer(it, table, [&seq] (char const * first,
+                                                                                      char const * last)
+            {
+                detail::append_converted(seq, first, last);
+            });
+
+            if (status == detail::scan_status::invalid)
             {
-                if ((is_space || is_digit)(*it))
-                    continue;
-                else if (not_in_alph(*it))
-                {
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                        not_in_alph.msg +
-                                        " evaluated to true on " +
-                                        detail::make_printable(*it)};
-                }
-
-                seq.push_back(assign_char_to(*it, value_type_t<seq_type>{}));
+                throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                    not_in_alph.msg +
+                                    " evaluated to true on " +
+                                    detail::make_printable(*it)};
             }
 
         #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
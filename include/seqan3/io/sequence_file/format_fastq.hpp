@@ -22,6 +22,7 @@
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/io/detail/buffer_scan.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
@@ -126,6 +127,87 @@ protected:
         }
         ++stream_it; // skip '@'
 
+    #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+        // The fields are scanned directly in the stream buffer: one table lookup per character decides whether it
+        // ends the field, is ignored or appended and runs of appended characters are converted at once.
+        if constexpr (!detail::decays_to_ignore_v<id_type>)
+        {
+            bool const at_line_end = options.truncate_ids ? detail::read_line_until(stream_it, is_cntrl || is_blank, id)
+                                                          : detail::read_line_until(stream_it,
+                                                                                    is_char<'\r'> || is_char<'\n'>,
+                                                                                    id);
+            if (!at_line_end)
+                throw unexpected_end_of_input{"Reached end of input before the end of the ID line."};
+        }
+        else if (!detail::skip_buffer_past(stream_it, '\n'))
+        {
+            throw unexpected_end_of_input{"Reached end of input before the end of the ID line."};
+        }
+
+        /* Sequence */
+        auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
+        static detail::scan_table const seq_table = detail::make_scan_table(is_char<'+'>, is_space, [] (char const c)
+        {
+            return detail::decays_to_ignore_v<seq_type> || is_in_alphabet<seq_legal_alph_type>(c);
+        });
+
+        detail::scan_status const seq_status = detail::scan_buffer(stream_it, seq_table,
+                                                                   [&] (char const * first, char const * last)
+        {
+            if constexpr (!detail::decays_to_ignore_v<seq_type>)
+                detail::append_converted(sequence, first, last);
+            sequence_size_after += last - first;
+        });
+
+        if (seq_status == detail::scan_status::invalid)
+        {
+            throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                is_legal_alph.msg +
+                                " evaluated to false on " +
+                                detail::make_printable(*stream_it)};
+        }
+        else if (seq_status == detail::scan_status::end_of_input)
+        {
+            throw unexpected_end_of_input{"Reached end of input before the 2nd ID line."};
+        }
+        sequence_size_after += sequence_size_before;
+
+        /* 2nd ID line */
+        if (!detail::skip_buffer_past(stream_it, '\n'))
+            throw unexpected_end_of_input{"Reached end of input before the end of the 2nd ID line."};
+
+        /* Qualities */
+        size_t const quality_count = sequence_size_after - sequence_size_before;
+        size_t qualities_read = 0;
+        static detail::scan_table const qual_table = detail::make_scan_table([] (char) { return false; },
+                                                                             is_space,
+                                                                             [] (char) { return true; });
+
+        // trailing whitespace (e.g. the newline) is consumed as well
+        detail::scan_buffer(stream_it, qual_table, [&] (char const * first, char const * last)
+        {
+            if constexpr (seq_qual_combined)
+            {
+                // seq_qual field implies that they are the same variable
+                assert(std::addressof(sequence) == std::addressof(qualities));
+                using quality_alphabet_t = typename value_type_t<qual_type>::quality_alphabet_type;
+                auto const & conversion = detail::char_conversion_table<quality_alphabet_t>();
+                auto out = begin(qualities) + sequence_size_before + qualities_read;
+                for (char const * it = first; it != last; ++it, ++out)
+                    *out = conversion[static_cast<unsigned char>(*it)];
+            }
+            else if constexpr (!detail::decays_to_ignore_v<qual_type>)
+            {
+                detail::append_converted(qualities, first, last);
+            }
+            qualities_read += last - first;
+        }, quality_count);
+
+        if (qualities_read != quality_count)
+            throw unexpected_end_of_input{"Reached end of input before designated size."};
+
+    #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
+
         if constexpr (!detail::decays_to_ignore_v<id_type>)
         {
             if (options.truncate_ids)
@@ -206,6 +288,7 @@ protected:
         {
             detail::consume(qview);
         }
+    #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
     }
 
     //!\copydoc sequence_file_output_format::write_sequence_record
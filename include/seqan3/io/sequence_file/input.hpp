@@ -15,6 +15,8 @@
 #include <cassert>
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <variant>
 #include <vector>
 
@@ -31,11 +33,14 @@
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/std/concepts>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/record_batch_reader.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/sequence_file/fasta_index.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
@@ -713,6 +718,122 @@ public:
     }
     //!\}
 
+    /*!\brief Reads the remaining records in batches that are parsed in parallel.
+     * \tparam delegate_t The type of the callable invoked with each batch; must be invocable with
+     *                    `std::vector<record_type> &`.
+     * \param[in] delegate     Invoked with each batch of records on the calling thread, in the order of the file.
+     * \param[in] thread_count The number of threads that parse the records.
+     * \param[in] chunk_size   The approximate number of bytes of the file per batch.
+     * \throws seqan3::format_error if a record could not be parsed.
+     *
+     * \details
+     *
+     * The file is split into record-aligned chunks (records begin with '>' in FastA files and end after as many
+     * qualities as sequence characters in FastQ files) that `thread_count` threads parse into batches of records while
+     * the next chunks are read. The
+     * batches are reused after the delegate returns; move the records out of the batch to keep them.
+     *
+     * Other formats are read record by record on the calling thread and passed to the delegate in batches as well.
+     * After this function returns, the file is at end.
+     *
+     * \include test/snippet/io/sequence_file/sequence_file_input_read_batches.cpp
+     */
+    template <typename delegate_t>
+    //!\cond
+        requires std::invocable<delegate_t, std::vector<record_type> &>
+    //!\endcond
+    void read_batches(delegate_t && delegate,
+                      size_t const thread_count = std::thread::hardware_concurrency(),
+                      size_t const chunk_size = 1ULL << 22)
+    {
+        std::vector<record_type> batch{};
+
+        // a record that was already buffered by begin() is passed on first
+        if (first_record_was_read && !at_end)
+        {
+            batch.push_back(std::move(record_buffer));
+            delegate(batch);
+            batch.clear();
+        }
+        first_record_was_read = true;
+
+        assert(!format.valueless_by_exception());
+        std::visit([&] ([[maybe_unused]] auto & f)
+        {
+            if constexpr (detail::record_splittable_format<std::remove_reference_t<decltype(f)>>)
+            {
+                detail::read_record_batches<record_type>(*secondary_stream,
+                                                         thread_count,
+                                                         chunk_size,
+                                                         [&f] (std::string_view const chunk)
+                                                         {
+                                                             return detail::last_record_end(f, chunk);
+                                                         },
+                                                         [&] (std::istream & stream, record_type & record)
+                                                         {
+                                                             read_record(f, stream, record);
+                                                         },
+                                                         delegate);
+            }
+            else
+            {
+                for (read_next_record(); !at_end; read_next_record())
+                {
+                    batch.push_back(std::move(record_buffer));
+                    if (batch.size() == sequential_batch_size)
+                    {
+                        delegate(batch);
+                        batch.clear();
+                    }
+                }
+
+                if (!batch.empty())
+                    delegate(batch);
+            }
+        }, format);
+
+        record_buffer.clear();
+        at_end = true;
+    }
+
+    /*!\brief Reads the region `[begin, end)` of the sequence named `name` with the help of a FastA index.
+     * \param[in] index The index of the file, see seqan3::fasta_index.
+     * \param[in] name  The name of the sequence.
+     * \param[in] begin The first position of the region.
+     * \param[in] end   The position behind the region.
+     * \returns The region converted to the \ref sequence_type.
+     * \throws std::out_of_range if no sequence is named `name` or the region is not part of the sequence.
+     * \throws seqan3::file_open_error if the file is compressed.
+     *
+     * \details
+     *
+     * The file seeks directly to the first character of the region and reads only the bytes of the region, i.e. the
+     * cost depends on the size of the region and not on the size of the file. The position of the record-wise reading
+     * is not changed.
+     *
+     * \include test/snippet/io/sequence_file/fasta_index.cpp
+     */
+    sequence_type read_region(fasta_index const & index, std::string_view const name, uint64_t const begin,
+                              uint64_t const end)
+    {
+        if (secondary_stream.get() != primary_stream.get())
+            throw file_open_error{"Regions can only be read from uncompressed files."};
+
+        auto const position = primary_stream->tellg();
+        sequence_type sequence{};
+        index.read_region(*primary_stream, name, begin, end, sequence);
+
+        primary_stream->clear();
+        primary_stream->seekg(position);
+        return sequence;
+    }
+
+    //!\overload
+    sequence_type read_region(fasta_index const & index, std::string_view const name)
+    {
+        return read_region(index, name, 0, index.at(name).length);
+    }
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
                              selected_field_ids::contains(field::seq_qual)> options;
@@ -744,6 +865,9 @@ protected:
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
 
+    //!\brief The number of records per batch if seqan3::sequence_file_input::read_batches reads record by record.
+    static constexpr size_t sequential_batch_size = 1024;
+
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
     //!\brief File is at position 1 behind the last record.
@@ -773,26 +897,32 @@ protected:
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
-            // read new record
-            if constexpr (selected_field_ids::contains(field::seq_qual))
-            {
-                f.read_sequence_record(*secondary_stream,
-                                       options,
-                                       detail::get_or_ignore<field::seq_qual>(record_buffer),
-                                       detail::get_or_ignore<field::id>(record_buffer),
-                                       detail::get_or_ignore<field::seq_qual>(record_buffer));
-            }
-            else
-            {
-                f.read_sequence_record(*secondary_stream,
-                                       options,
-                                       detail::get_or_ignore<field::seq>(record_buffer),
-                                       detail::get_or_ignore<field::id>(record_buffer),
-                                       detail::get_or_ignore<field::qual>(record_buffer));
-            }
+            read_record(f, *secondary_stream, record_buffer);
         }, format);
     }
 
+    //!\brief Reads the next record from `stream` into `record` with the format `f`.
+    template <typename format_t>
+    void read_record(format_t & f, std::basic_istream<stream_char_type> & stream, record_type & record)
+    {
+        if constexpr (selected_field_ids::contains(field::seq_qual))
+        {
+            f.read_sequence_record(stream,
+                                   options,
+                                   detail::get_or_ignore<field::seq_qual>(record),
+                                   detail::get_or_ignore<field::id>(record),
+                                   detail::get_or_ignore<field::seq_qual>(record));
+        }
+        else
+        {
+            f.read_sequence_record(stream,
+                                   options,
+                                   detail::get_or_ignore<field::seq>(record),
+                                   detail::get_or_ignore<field::id>(record),
+                                   detail::get_or_ignore<field::qual>(record));
+        }
+    }
+
     //!\brief Read the entire file into the internal column buffers.
     void read_columns()
     {
@@ -0,0 +1,206 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::mapped_sequence_file_input.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/char_operations/predicate.hpp>
+#include <seqan3/core/type_list/type_list.hpp>
+#include <seqan3/io/detail/in_file_iterator.hpp>
+#include <seqan3/io/detail/magic_header.hpp>
+#include <seqan3/io/detail/mapped_file.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/record.hpp>
+#include <seqan3/io/sequence_file/input_options.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A FastA file that is mapped into memory and read without copying the records.
+ * \ingroup sequence
+ * \tparam sequence_alphabet_t The alphabet the sequences are converted to; must satisfy seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * This file behaves like a seqan3::sequence_file_input over the fields seqan3::field::seq and seqan3::field::id of an
+ * uncompressed FastA file, but the file is mapped into memory instead of being read through a stream. The records
+ * refer to the mapped bytes:
+ *
+ *   * the seqan3::field::id is a std::string_view of the ID line (without the leading '>' or ';'),
+ *   * the seqan3::field::seq is a view over the sequence lines that skips whitespace and digits and converts the
+ *     characters to `sequence_alphabet_t` when they are accessed.
+ *
+ * Reading a record therefore neither allocates nor copies, regardless of the length of the sequence; only the pages of
+ * the file that are accessed are loaded. The records remain valid as long as the file exists, so they can be stored
+ * (e.g. the chromosomes of a reference) without copying them into containers.
+ *
+ * In contrast to seqan3::sequence_file_input, the characters of the sequence are not validated; characters that are
+ * not part of `sequence_alphabet_t` are converted as by seqan3::assign_char_to. Only a '>' or ';' at the beginning of
+ * a line begins a new record.
+ *
+ * \include test/snippet/io/sequence_file/mapped_sequence_file_input.cpp
+ */
+template <writable_alphabet sequence_alphabet_t = dna5>
+class mapped_sequence_file_input
+{
+public:
+    /*!\name Field types and record type
+     * \{
+     */
+    //!\brief The type of the seqan3::field::id, a view of the mapped ID line.
+    using id_type = std::string_view;
+    //!\brief The type of the seqan3::field::seq, a view over the mapped sequence lines.
+    using sequence_type = decltype(std::string_view{} | std::views::filter(!(is_space || is_digit))
+                                                      | views::char_to<sequence_alphabet_t>);
+    //!\brief The IDs of the fields of the records.
+    using field_ids = fields<field::seq, field::id>;
+    //!\brief The type of the records.
+    using record_type = record<type_list<sequence_type, id_type>, field_ids>;
+    //!\}
+
+    /*!\name Range associated types
+     * \{
+     */
+    using value_type      = record_type;                                          //!< The type of a record.
+    using reference       = record_type &;                                        //!< The reference type.
+    using const_reference = void;                                                 //!< Not const-iterable.
+    using size_type       = size_t;                                               //!< An unsigned integer type.
+    using difference_type = std::make_signed_t<size_t>;                           //!< A signed integer type.
+    using iterator        = detail::in_file_iterator<mapped_sequence_file_input>; //!< The iterator type.
+    using const_iterator  = void;                                                 //!< Not const-iterable.
+    using sentinel        = std::ranges::default_sentinel_t;                      //!< The type returned by end().
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_sequence_file_input() = delete;                                                   //!< Deleted.
+    mapped_sequence_file_input(mapped_sequence_file_input const &) = delete;                 //!< Deleted.
+    mapped_sequence_file_input & operator=(mapped_sequence_file_input const &) = delete;     //!< Deleted.
+    mapped_sequence_file_input(mapped_sequence_file_input &&) = default;                     //!< Defaulted.
+    mapped_sequence_file_input & operator=(mapped_sequence_file_input &&) = default;         //!< Defaulted.
+    ~mapped_sequence_file_input() = default;                                                 //!< Defaulted.
+
+    /*!\brief Maps the file at `filename` into memory.
+     * \param[in] filename Path to an uncompressed FastA file.
+     * \throws seqan3::file_open_error if the file could not be opened or mapped, or if it is compressed.
+     * \throws seqan3::format_error if the file does not begin with a FastA record.
+     */
+    explicit mapped_sequence_file_input(std::filesystem::path const & filename) : file{filename}
+    {
+        std::string_view const data = file.view();
+
+        auto starts_with = [&data] (auto const & magic_header)
+        {
+            return data.size() >= magic_header.size() &&
+                   std::equal(magic_header.begin(), magic_header.end(), data.begin());
+        };
+
+        if (starts_with(detail::gz_compression::magic_header) ||
+            starts_with(detail::bz2_compression::magic_header) ||
+            starts_with(detail::zstd_compression::magic_header))
+        {
+            throw file_open_error{"The file " + filename.string() + " is compressed and cannot be mapped."};
+        }
+
+        position = std::min(data.find_first_not_of(" \t\n\r\v\f"), data.size());
+        if (position != data.size() && data[position] != '>' && data[position] != ';')
+            throw format_error{"The file " + filename.string() + " does not begin with a FastA record."};
+    }
+    //!\}
+
+    /*!\name Range interface
+     * \{
+     */
+    //!\brief Returns an iterator to the current record; reads the first record on the first call.
+    iterator begin()
+    {
+        if (!first_record_was_read)
+        {
+            read_next_record();
+            first_record_was_read = true;
+        }
+
+        return {*this};
+    }
+
+    //!\brief Returns a sentinel for comparison with iterator.
+    sentinel end() noexcept
+    {
+        return {};
+    }
+
+    //!\brief Returns the current record.
+    reference front() noexcept
+    {
+        return *begin();
+    }
+    //!\}
+
+    //!\brief The options are public and its members can be set directly; only `truncate_ids` is used.
+    sequence_file_input_options<sequence_alphabet_t, false> options;
+
+protected:
+    //!\privatesection
+    //!\brief The current record.
+    record_type record_buffer;
+    //!\brief The mapped file.
+    detail::mapped_file file;
+    //!\brief The position of the next record in the file.
+    size_t position{0};
+    //!\brief Tracks whether the very first record is buffered when calling begin().
+    bool first_record_was_read{false};
+    //!\brief File is at position 1 behind the last record.
+    bool at_end{false};
+
+    //!\brief Locates the next record in the mapped bytes.
+    void read_next_record()
+    {
+        std::string_view const data = file.view();
+
+        if (position == data.size())
+        {
+            at_end = true;
+            return;
+        }
+
+        // ID line: skip the '>' or ';' and leading blanks
+        size_t const line_end = std::min(data.find('\n', position), data.size());
+        size_t const id_begin = std::min(data.find_first_not_of(" \t", position + 1), line_end);
+        auto const id_first = data.begin() + id_begin;
+        auto const line_last = data.begin() + line_end;
+        auto const id_last = options.truncate_ids ? std::find_if(id_first, line_last, is_cntrl || is_blank)
+                                                  : std::find_if(id_first, line_last, is_char<'\r'>);
+
+        // sequence: all lines up to the next ID line, i.e. the next '>' or ';' at the beginning of a line
+        size_t const sequence_begin = std::min(line_end + 1, data.size());
+        size_t const next_id_line = std::min(data.find("\n>", line_end), data.find("\n;", line_end));
+        position = (next_id_line == std::string_view::npos) ? data.size() : next_id_line + 1;
+
+        record_buffer = record_type{data.substr(sequence_begin, position - sequence_begin)
+                                        | std::views::filter(!(is_space || is_digit))
+                                        | views::char_to<sequence_alphabet_t>,
+                                    data.substr(id_begin, id_last - id_first)};
+    }
+
+    //!\brief Befriend iterator so it can access the buffers.
+    friend iterator;
+};
+
+} // namespace seqan3
@@ -645,6 +645,19 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief Whether seqan3::sequence_file_output_options::compression_level was passed on to the secondary stream.
+    bool compression_level_was_set{false};
+
+    //!\brief Passes seqan3::sequence_file_output_options::compression_level on to the secondary stream before the first record.
+    void apply_compression_level()
+    {
+        if (!compression_level_was_set)
+        {
+            detail::set_compression_level(*secondary_stream, options.compression_level);
+            compression_level_was_set = true;
+        }
+    }
+
     //!\brief Write record to format.
     template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
     void write_record(seq_t && seq, id_t && id, qual_t && qual, seq_qual_t && seq_qual)
@@ -657,6 +670,8 @@ protected:
             static_assert(detail::is_type_specialisation_of_v<value_type_t<seq_qual_t>, qualified>,
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
+        apply_compression_level();
+
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
@@ -704,6 +719,8 @@ protected:
             static_assert(detail::is_type_specialisation_of_v<value_type_t<reference_t<seq_quals_t>>, qualified>,
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
+        apply_compression_level();
+
         assert(!format.valueless_by_exception());
         std::visit([&] (auto & f)
         {
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -40,6 +42,17 @@ struct sequence_file_output_options
 
     //!\brief Complete header given for embl or genbank
     bool        embl_genbank_complete_header  = false;
+
+    /*!\brief The compression level of BGZF (`.gz` and `.bgzf`) and zstd (`.zst`) compressed files.
+     *
+     * \details
+     *
+     * If no level is set, each codec uses its own default: 1, the fastest level, for BGZF and 3 for zstd.
+     * BGZF levels range from 0 (no compression) to 9 (best), or to 12 if SeqAn was configured with libdeflate;
+     * zstd levels range from 1 (fastest) to 22 (best). Levels outside of the range of the codec are clamped.
+     * Set the level before the first record is written.
+     */
+    std::optional<int> compression_level{};
 };
 
 } // namespace seqan3
@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <cassert>
 #include <iterator>
+#include <string_view>
 
 #ifndef __cpp_lib_ranges
 #include <range/v3/iterator/stream_iterators.hpp>
@@ -134,6 +136,28 @@ public:
         return *stream_buf->gptr();
     }
 
+    /*!\name Buffer access
+     * \brief Block-wise access to the get area of the stream buffer, e.g. to scan it with `std::memchr`.
+     * \{
+     */
+    //!\brief The buffered characters from the current position on; only empty at the end of the input.
+    std::basic_string_view<char_t, traits_t> buffered() const noexcept
+    {
+        assert(stream_buf != nullptr);
+        return {stream_buf->gptr(), static_cast<size_t>(stream_buf->egptr() - stream_buf->gptr())};
+    }
+
+    //!\brief Advances by `count` buffered characters and rebuffers if all of them have been consumed.
+    void skip_buffered(size_t const count)
+    {
+        assert(stream_buf != nullptr);
+        assert(count <= buffered().size());
+        stream_buf->gbump(static_cast<int>(count));
+        if (stream_buf->gptr() == stream_buf->egptr())
+            stream_buf->sgetc(); // underflow()
+    }
+    //!\}
+
     /*!\name Comparison operators
      * \brief We define comparison only against the sentinel.
      * \{
@@ -19,6 +19,7 @@
 #include <seqan3/range/views/get.hpp>
 #include <seqan3/range/views/interleave.hpp>
 #include <seqan3/range/views/istreambuf.hpp>
+#include <seqan3/range/views/minimiser.hpp>
 #include <seqan3/range/views/pairwise_combine.hpp>
 #include <seqan3/range/views/persist.hpp>
 #include <seqan3/range/views/enforce_random_access.hpp>
@@ -0,0 +1,466 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::views::minimiser.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <stdexcept>
+#include <utility>
+
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/range/concept.hpp>
+#include <seqan3/range/views/detail.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+// ---------------------------------------------------------------------------------------------------------------------
+// sliding_window_minimum
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The minimum of the last `window` values of a sequence, maintained by a monotone deque.
+ * \ingroup views
+ * \tparam value_t The type of the values; must model std::totally_ordered.
+ *
+ * \details
+ *
+ * The deque holds the values of the window that are smaller than all values pushed after them, i.e. it is strictly
+ * increasing from front to back and its front is the minimum of the window. Pushing a value removes all values from
+ * the back that are not smaller, and the front if it left the window. Each value is inserted and removed at most once,
+ * so a push takes amortised constant time, independent of the window size.
+ *
+ * Of equal values, the last one pushed is the minimum.
+ */
+template <std::totally_ordered value_t>
+class sliding_window_minimum
+{
+private:
+    //!\brief The candidates for the minimum together with their positions.
+    std::deque<std::pair<value_t, size_t>> candidates{};
+    //!\brief The number of values in a window.
+    size_t window{1};
+    //!\brief The position of the next value.
+    size_t next_position{0};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sliding_window_minimum() = default;                                           //!< Defaulted.
+    sliding_window_minimum(sliding_window_minimum const &) = default;             //!< Defaulted.
+    sliding_window_minimum(sliding_window_minimum &&) = default;                  //!< Defaulted.
+    sliding_window_minimum & operator=(sliding_window_minimum const &) = default; //!< Defaulted.
+    sliding_window_minimum & operator=(sliding_window_minimum &&) = default;      //!< Defaulted.
+    ~sliding_window_minimum() = default;                                          //!< Defaulted.
+
+    //!\brief Constructs an empty window of `window_` values.
+    explicit sliding_window_minimum(size_t const window_) : window{std::max<size_t>(window_, 1)}
+    {}
+    //!\}
+
+    //!\brief Appends a value; the value `window` positions before leaves the window.
+    void push(value_t const value)
+    {
+        while (!candidates.empty() && !(candidates.back().first < value))
+            candidates.pop_back();
+
+        candidates.emplace_back(value, next_position++);
+
+        // only the front can have left the window, since the positions of the candidates increase
+        if (candidates.front().second + window < next_position)
+            candidates.pop_front();
+    }
+
+    //!\brief Whether at least `window` values have been pushed.
+    bool full() const noexcept
+    {
+        return next_position >= window;
+    }
+
+    //!\brief The minimum of the window and its position in the sequence; the window must not be empty.
+    std::pair<value_t, size_t> const & minimum() const noexcept
+    {
+        assert(!candidates.empty());
+        return candidates.front();
+    }
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// minimiser_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by seqan3::views::minimiser.
+ * \tparam urng1_t The type of the underlying range; must model std::ranges::forward_range over
+ *                 std::totally_ordered values.
+ * \tparam urng2_t The type of the second underlying range (optional); the minimum of both ranges is taken at each
+ *                 position.
+ * \implements std::ranges::view
+ * \implements std::ranges::forward_range
+ * \ingroup views
+ *
+ * \details
+ *
+ * Note that most members of this class are generated by ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng1_t, std::ranges::view urng2_t = std::ranges::empty_view<value_type_t<urng1_t>>>
+class minimiser_view : public std::ranges::view_interface<minimiser_view<urng1_t, urng2_t>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng1_t>, "The minimiser_view only works on forward_ranges.");
+    static_assert(std::ranges::forward_range<urng2_t>, "The minimiser_view only works on forward_ranges.");
+    static_assert(std::totally_ordered<value_type_t<urng1_t>>,
+                  "The values of the underlying range of the minimiser_view must be totally ordered.");
+
+    //!\brief Whether the minimum of two ranges is taken at each position.
+    static constexpr bool two_ranges = !std::same_as<urng2_t, std::ranges::empty_view<value_type_t<urng1_t>>>;
+
+    //!\brief The underlying range.
+    urng1_t urange1{};
+    //!\brief The second underlying range.
+    urng2_t urange2{};
+    //!\brief The number of values in a window.
+    size_t window_values{1};
+
+    /*!\brief Iterator over the minimisers of the windows.
+     * \tparam rng1_t The type of the first range, possibly const-qualified.
+     * \tparam rng2_t The type of the second range, possibly const-qualified.
+     *
+     * \details
+     *
+     * The iterator stores the state of the sliding window. It points to the minimum of a window and is incremented to
+     * the next window with a different minimiser, i.e. a minimiser is reported once even if it is the minimum of
+     * several consecutive windows.
+     */
+    template <typename rng1_t, typename rng2_t>
+    class basic_iterator
+    {
+    private:
+        //!\brief Iterator over the first range.
+        std::ranges::iterator_t<rng1_t> it1{};
+        //!\brief Sentinel of the first range.
+        std::ranges::sentinel_t<rng1_t> end1{};
+        //!\brief Iterator over the second range.
+        std::ranges::iterator_t<rng2_t> it2{};
+        //!\brief The minimum of the current window.
+        sliding_window_minimum<value_type_t<urng1_t>> window{};
+        //!\brief The minimiser the iterator points to.
+        std::pair<value_type_t<urng1_t>, size_t> current{};
+        //!\brief Whether all windows have been processed.
+        bool at_end{true};
+
+        //!\brief Pushes the next value into the window.
+        void push_next()
+        {
+            if constexpr (two_ranges)
+            {
+                window.push(std::min<value_type_t<urng1_t>>(*it1, *it2));
+                ++it2;
+            }
+            else
+            {
+                window.push(*it1);
+            }
+            ++it1;
+        }
+
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using difference_type = std::ptrdiff_t;            //!< Type for distances between iterators.
+        using value_type = value_type_t<urng1_t>;          //!< Value type of this iterator.
+        using pointer = void;                              //!< The pointer type.
+        using reference = value_type;                      //!< Reference to `value_type`.
+        using iterator_category = std::forward_iterator_tag; //!< Tag this class as a forward iterator.
+        using iterator_concept = iterator_category;        //!< Tag this class as a forward iterator.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        basic_iterator() = default;                                   //!< Defaulted.
+        basic_iterator(basic_iterator const &) = default;             //!< Defaulted.
+        basic_iterator(basic_iterator &&) = default;                  //!< Defaulted.
+        basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+        basic_iterator & operator=(basic_iterator &&) = default;      //!< Defaulted.
+        ~basic_iterator() = default;                                  //!< Defaulted.
+
+        /*!\brief Constructs an iterator pointing to the minimiser of the first window.
+         * \param[in] rng1          The first range.
+         * \param[in] rng2          The second range.
+         * \param[in] window_values The number of values in a window.
+         *
+         * \details
+         *
+         * If the ranges are shorter than a window, the iterator is at the end.
+         */
+        basic_iterator(rng1_t & rng1, rng2_t & rng2, size_t const window_values) :
+            it1{std::ranges::begin(rng1)}, end1{std::ranges::end(rng1)}, it2{std::ranges::begin(rng2)},
+            window{window_values}
+        {
+            while (!window.full() && it1 != end1)
+                push_next();
+
+            at_end = !window.full();
+            if (!at_end)
+                current = window.minimum();
+        }
+        //!\}
+
+        /*!\name Comparison operators
+         * \{
+         */
+        //!\brief Compare to another iterator.
+        friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+        {
+            return lhs.at_end == rhs.at_end && (lhs.at_end || lhs.it1 == rhs.it1);
+        }
+
+        //!\brief Compare to another iterator.
+        friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        //!\brief Compare to the end of the range.
+        friend bool operator==(basic_iterator const & lhs, std::ranges::default_sentinel_t const &) noexcept
+        {
+            return lhs.at_end;
+        }
+
+        //!\brief Compare to the end of the range.
+        friend bool operator==(std::ranges::default_sentinel_t const &, basic_iterator const & rhs) noexcept
+        {
+            return rhs.at_end;
+        }
+
+        //!\brief Compare to the end of the range.
+        friend bool operator!=(basic_iterator const & lhs, std::ranges::default_sentinel_t const &) noexcept
+        {
+            return !lhs.at_end;
+        }
+
+        //!\brief Compare to the end of the range.
+        friend bool operator!=(std::ranges::default_sentinel_t const &, basic_iterator const & rhs) noexcept
+        {
+            return !rhs.at_end;
+        }
+        //!\}
+
+        //!\brief Advances to the next window with a different minimiser.
+        basic_iterator & operator++()
+        {
+            while (it1 != end1)
+            {
+                push_next();
+                if (window.minimum().second != current.second)
+                {
+                    current = window.minimum();
+                    return *this;
+                }
+            }
+
+            at_end = true;
+            return *this;
+        }
+
+        //!\brief Post-increment.
+        basic_iterator operator++(int)
+        {
+            basic_iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+
+        //!\brief Returns the minimiser.
+        value_type operator*() const noexcept
+        {
+            return current.first;
+        }
+
+        //!\brief Returns the position of the minimiser in the underlying range.
+        size_t position() const noexcept
+        {
+            return current.second;
+        }
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    minimiser_view() = default;                                   //!< Defaulted.
+    minimiser_view(minimiser_view const &) = default;             //!< Defaulted.
+    minimiser_view(minimiser_view &&) = default;                  //!< Defaulted.
+    minimiser_view & operator=(minimiser_view const &) = default; //!< Defaulted.
+    minimiser_view & operator=(minimiser_view &&) = default;      //!< Defaulted.
+    ~minimiser_view() = default;                                  //!< Defaulted.
+
+    /*!\brief Constructs from a view and the number of values in a window.
+     * \throws std::invalid_argument if `window_values_` is 0.
+     */
+    minimiser_view(urng1_t urange1_, size_t const window_values_) :
+        minimiser_view{std::move(urange1_), urng2_t{}, window_values_}
+    {}
+
+    /*!\brief Constructs from two views of the same length and the number of values in a window.
+     * \throws std::invalid_argument if `window_values_` is 0.
+     */
+    minimiser_view(urng1_t urange1_, urng2_t urange2_, size_t const window_values_) :
+        urange1{std::move(urange1_)}, urange2{std::move(urange2_)}, window_values{window_values_}
+    {
+        if (window_values == 0)
+            throw std::invalid_argument{"The window of a minimiser must contain at least one value."};
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first minimiser.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of values in a window.
+     */
+    auto begin()
+    {
+        return basic_iterator<urng1_t, urng2_t>{urange1, urange2, window_values};
+    }
+
+    //!\copydoc begin()
+    auto begin() const
+    //!\cond
+        requires const_iterable_range<urng1_t> && const_iterable_range<urng2_t>
+    //!\endcond
+    {
+        return basic_iterator<urng1_t const, urng2_t const>{urange1, urange2, window_values};
+    }
+
+    //!\brief Returns the end of the range.
+    auto end() const noexcept
+    {
+        return std::ranges::default_sentinel;
+    }
+    //!\}
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+minimiser_view(rng_t &&, size_t const) -> minimiser_view<std::ranges::all_view<rng_t>>;
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng1_t, std::ranges::viewable_range rng2_t>
+minimiser_view(rng1_t &&, rng2_t &&, size_t const) ->
+    minimiser_view<std::ranges::all_view<rng1_t>, std::ranges::all_view<rng2_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// minimiser_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief views::minimiser's range adaptor object type (non-closure).
+struct minimiser_fn
+{
+    //!\brief Store the number of values in a window and return a range adaptor closure object.
+    constexpr auto operator()(size_t const window_values) const
+    {
+        return adaptor_from_functor{*this, window_values};
+    }
+
+    /*!\brief Call the view's constructor with the underlying view and the number of values in a window.
+     * \param[in] urange        The input range to process. Must model std::ranges::viewable_range and
+     *                          std::ranges::forward_range over std::totally_ordered values.
+     * \param[in] window_values The number of values in a window.
+     * \throws std::invalid_argument if `window_values` is 0.
+     * \returns A range of the minimisers.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, size_t const window_values) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+            "The range parameter to views::minimiser cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+            "The range parameter to views::minimiser must model std::ranges::forward_range.");
+        static_assert(std::totally_ordered<value_type_t<urng_t>>,
+            "The range parameter to views::minimiser must be over totally ordered values.");
+
+        return minimiser_view{std::forward<urng_t>(urange), window_values};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+
+/*!\name General purpose views
+ * \{
+ */
+
+/*!\brief               Computes the minimum of each window of a range of values, reporting each minimiser once.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] window_values The number of consecutive values in a window.
+ * \returns             A range of the minimisers. See below for the properties of the returned range.
+ * \throws std::invalid_argument if `window_values` is 0.
+ * \ingroup views
+ *
+ * \details
+ *
+ * A minimiser is the minimum of `window_values` consecutive values, e.g. of k-mer hash values computed by
+ * seqan3::views::kmer_hash. Consecutive windows often share their minimum; the view reports such a minimiser only
+ * once. Two texts that share a substring of `window_values` k-mers therefore share its minimiser, while only a
+ * fraction of about \f$2 / (w + 1)\f$ of the k-mers are reported for a window of w values. If several values of a
+ * window are minimal, the last of them is the minimiser.
+ *
+ * The window is maintained by a monotone deque, so each value is processed in amortised constant time, independent
+ * of the window size. If the range is shorter than a window, the view is empty.
+ *
+ * To compute the minimisers of the k-mers of a text, possibly over both strands, see seqan3::views::minimiser_hash.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | std::totally_ordered               | seqan3::value_type_t<urng_t>     |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/views/minimiser.cpp
+ *
+ * \hideinitializer
+ */
+inline constexpr auto minimiser = detail::minimiser_fn{};
+
+//!\}
+
+} // namespace seqan3::views
@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::views::minimiser_hash.
+ */
+
+#pragma once
+
+#include <stdexcept>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/detail.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/range/views/minimiser.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+//!\brief Strong type for the number of characters of a window of seqan3::views::minimiser_hash.
+//!\ingroup views
+struct window_size : detail::strong_type<uint32_t, window_size>
+{
+    //!\brief Import the base constructors.
+    using detail::strong_type<uint32_t, window_size>::strong_type;
+};
+
+//!\brief Strong type for the value the k-mer hash values of seqan3::views::minimiser_hash are XOR-ed with.
+//!\ingroup views
+struct seed : detail::strong_type<uint64_t, seed>
+{
+    //!\brief Import the base constructors.
+    using detail::strong_type<uint64_t, seed>::strong_type;
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\brief Returns the shape that hashes the reverse of a k-mer like `kmer_shape` hashes the k-mer.
+//!\ingroup views
+inline shape reverse_shape(shape const & kmer_shape) noexcept
+{
+    shape reversed{kmer_shape};
+    for (size_t i = 0; i < kmer_shape.size(); ++i)
+        reversed[i] = kmer_shape[kmer_shape.size() - 1 - i];
+    return reversed;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// minimiser_hash_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief views::minimiser_hash's range adaptor object type (non-closure).
+struct minimiser_hash_fn
+{
+    //!\brief The default seed.
+    static constexpr uint64_t default_seed = 0x8F3F73B5CF1C9ADEULL;
+
+    //!\brief Store the arguments and return a range adaptor closure object.
+    constexpr auto operator()(shape const & kmer_shape,
+                              window_size const window,
+                              seed const seed_ = seed{default_seed}) const
+    {
+        return seqan3::detail::adaptor_from_functor{*this, kmer_shape, window, seed_};
+    }
+
+    /*!\brief Computes the minimisers of the k-mer hash values of a range.
+     * \param[in] urange     The input range to process. Must model std::ranges::viewable_range and
+     *                       std::ranges::forward_range over a seqan3::semialphabet.
+     * \param[in] kmer_shape The seqan3::shape of the k-mers.
+     * \param[in] window     The number of characters of a window; must not be less than the size of the shape.
+     * \param[in] seed_      The value the hash values are XOR-ed with.
+     * \throws std::invalid_argument if the window is smaller than the shape or the hash values of the shape/alphabet
+     *         combination cannot be represented in `uint64_t`.
+     * \returns A range of the minimisers.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange,
+                              shape const & kmer_shape,
+                              window_size const window,
+                              seed const seed_ = seed{default_seed}) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+            "The range parameter to views::minimiser_hash cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+            "The range parameter to views::minimiser_hash must model std::ranges::forward_range.");
+        static_assert(semialphabet<reference_t<urng_t>>,
+            "The range parameter to views::minimiser_hash must be over elements of seqan3::semialphabet.");
+
+        if (window.get() < kmer_shape.size())
+            throw std::invalid_argument{"The window of views::minimiser_hash must not be smaller than the shape."};
+
+        size_t const window_values = window.get() - kmer_shape.size() + 1;
+        auto text = std::views::all(std::forward<urng_t>(urange));
+        auto scramble = std::views::transform([value = seed_.get()] (uint64_t const hash) { return hash ^ value; });
+
+        if constexpr (nucleotide_alphabet<reference_t<urng_t>> && std::ranges::bidirectional_range<urng_t>)
+        {
+            // the hash of the reverse complement of the i-th k-mer is the i-th last hash of the reverse complement
+            auto forward_strand = text | views::kmer_hash(kmer_shape) | scramble;
+            auto reverse_strand = text
+                                | views::complement
+                                | std::views::reverse
+                                | views::kmer_hash(reverse_shape(kmer_shape))
+                                | scramble
+                                | std::views::reverse;
+
+            return minimiser_view{forward_strand, reverse_strand, window_values};
+        }
+        else
+        {
+            return minimiser_view{text | views::kmer_hash(kmer_shape) | scramble, window_values};
+        }
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+
+/*!\name Alphabet related views
+ * \{
+ */
+
+/*!\brief               Computes the minimisers of the k-mer hash values of a range, on both strands for nucleotides.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how to compute the hash values of the k-mers.
+ * \param[in] window_size The number of characters of a window; must not be less than the size of the shape.
+ * \param[in] seed      The value the hash values are XOR-ed with (optional).
+ * \returns             A range of `uint64_t` where each value is a minimiser.
+ *                      See below for the properties of the returned range.
+ * \throws std::invalid_argument if the window is smaller than the shape or the hash values of the shape/alphabet
+ *         combination cannot be represented in `uint64_t`.
+ * \ingroup views
+ *
+ * \details
+ *
+ * The k-mer hash values are computed by seqan3::views::kmer_hash and their minimisers by seqan3::views::minimiser
+ * with windows of `window_size - shape.size() + 1` k-mers, i.e. each window covers `window_size` characters.
+ *
+ * For nucleotide ranges, the hash value of each k-mer is the smaller of the hash values of the k-mer and of its
+ * reverse complement (canonical k-mers); the reverse complement is hashed with the reversed shape, so both hash values
+ * cover the same characters. For symmetric shapes, a text and its reverse complement therefore have the same
+ * minimisers.
+ *
+ * The lexicographically smallest k-mers (e.g. poly-A) would be the minimisers of many windows. XOR-ing the hash
+ * values with `seed` randomises the order of the k-mers; use the same seed for the text and the queries.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::semialphabet               | `uint64_t`                       |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/views/minimiser_hash.cpp
+ *
+ * \hideinitializer
+ */
+inline constexpr auto minimiser_hash = detail::minimiser_hash_fn{};
+
+//!\}
+
+} // namespace seqan3::views
@@ -12,11 +12,17 @@
 
 #pragma once
 
+#include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/core/type_traits/pre.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/search/algorithm/detail/search_batch.hpp>
 #include <seqan3/search/algorithm/detail/search_scheme_algorithm.hpp>
 #include <seqan3/search/algorithm/detail/search_trivial.hpp>
 #include <seqan3/search/configuration/all.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
 
 namespace seqan3::detail
 {
@@ -25,6 +31,215 @@ namespace seqan3::detail
  * \{
  */
 
+/*!\brief Converts the cursors found for a query into the output requested by the configuration.
+ * \tparam configuration_t The search configuration type.
+ * \tparam cursor_t        The cursor type of the index.
+ * \param[in] internal_hits The cursors found for the query.
+ * \returns The cursors or the sorted and unique text positions of the hits.
+ */
+template <typename configuration_t, typename cursor_t>
+inline auto search_hits(std::vector<cursor_t> internal_hits)
+{
+    using cfg_t = remove_cvref_t<configuration_t>;
+    using index_t = typename cursor_t::index_type;
+
+    // output cursors or text_positions
+    if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
+    {
+        return internal_hits;
+    }
+    else
+    {
+        using hit_t = std::conditional_t<index_t::text_layout_mode == text_layout::collection,
+                                         std::pair<typename index_t::size_type, typename index_t::size_type>,
+                                         typename index_t::size_type>;
+        std::vector<hit_t> hits;
+
+        if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
+        {
+            // only one cursor is reported but it might contain more than one text position
+            if (!internal_hits.empty())
+            {
+                auto text_pos = internal_hits[0].lazy_locate();
+                hits.push_back(text_pos[0]);
+            }
+        }
+        else
+        {
+            // the occurrences of all cursors are located together
+            for (auto const & occurrences : cursor_t::locate(internal_hits))
+                hits.insert(hits.end(), occurrences.begin(), occurrences.end());
+            std::sort(hits.begin(), hits.end());
+            hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+        }
+        return hits;
+    }
+}
+
+/*!\brief Converts the cursors and edit transcripts found for a query into seqan3::search_alignment hits.
+ * \tparam configuration_t The search configuration type.
+ * \tparam cursor_t        The cursor type of the index.
+ * \param[in] internal_hits The cursors found for the query with the edit operations of their paths.
+ * \returns The hits sorted by text position; each text position is reported once with the fewest errors.
+ */
+template <typename configuration_t, typename cursor_t>
+inline auto search_hits(std::vector<std::pair<cursor_t, search_transcript>> internal_hits)
+{
+    using cfg_t = remove_cvref_t<configuration_t>;
+    using index_t = typename cursor_t::index_type;
+    using text_pos_t = std::conditional_t<index_t::text_layout_mode == text_layout::collection,
+                                          std::pair<typename index_t::size_type, typename index_t::size_type>,
+                                          typename index_t::size_type>;
+
+    std::vector<search_alignment<text_pos_t>> hits;
+
+    if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
+    {
+        if (!internal_hits.empty())
+        {
+            auto const & [cur, transcript] = internal_hits[0];
+            hits.push_back({cur.lazy_locate()[0], transcript.errors(), transcript.cigar_vector()});
+        }
+    }
+    else
+    {
+        // the occurrences of all cursors are located together
+        auto cursors = internal_hits | std::views::transform([] (auto const & hit) -> cursor_t const &
+        {
+            return hit.first;
+        });
+        auto const occurrences = cursor_t::locate(cursors);
+
+        for (size_t i = 0; i < internal_hits.size(); ++i)
+        {
+            search_transcript const & transcript = internal_hits[i].second;
+            uint8_t const errors = transcript.errors();
+            std::vector<cigar> const cigar_vector = transcript.cigar_vector();
+            for (auto const & text_pos : occurrences[i])
+                hits.push_back({text_pos, errors, cigar_vector});
+        }
+
+        // keep the first hit with the fewest errors for each text position
+        std::stable_sort(hits.begin(), hits.end(), [] (auto const & lhs, auto const & rhs)
+        {
+            return std::tie(lhs.position, lhs.errors) < std::tie(rhs.position, rhs.errors);
+        });
+        hits.erase(std::unique(hits.begin(), hits.end(), [] (auto const & lhs, auto const & rhs)
+        {
+            return lhs.position == rhs.position;
+        }), hits.end());
+    }
+    return hits;
+}
+
+/*!\brief Converts the cursors found for a query and its reverse complement into the output requested by the
+ *        configuration and tags each hit with its strand.
+ * \tparam configuration_t The search configuration type.
+ * \tparam cursor_t        The cursor type of the index.
+ * \param[in] internal_hits    The cursors found for the query.
+ * \param[in] internal_hits_rc The cursors found for the reverse complement of the query.
+ * \returns The hits of seqan3::detail::search_hits paired with their seqan3::search_strand, forward hits first.
+ */
+template <typename configuration_t, typename cursor_t>
+inline auto search_hits_both_strands(std::vector<cursor_t> internal_hits, std::vector<cursor_t> internal_hits_rc)
+{
+    using cfg_t = remove_cvref_t<configuration_t>;
+    using hit_t = typename decltype(search_hits<cfg_t>(std::vector<cursor_t>{}))::value_type;
+
+    std::vector<std::pair<hit_t, search_strand>> hits;
+
+    for (auto & hit : search_hits<cfg_t>(std::move(internal_hits)))
+        hits.emplace_back(std::move(hit), search_strand::forward);
+    for (auto & hit : search_hits<cfg_t>(std::move(internal_hits_rc)))
+        hits.emplace_back(std::move(hit), search_strand::reverse_complement);
+
+    // the best hit of both strands (the forward strand is searched first)
+    if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
+    {
+        if (hits.size() > 1)
+            hits.resize(1);
+    }
+
+    return hits;
+}
+
+/*!\brief Searches a query and its reverse complement without errors in a bidirectional index in a single pass.
+ * \tparam index_t    Must model seqan3::bi_fm_index_specialisation over a seqan3::nucleotide_alphabet.
+ * \tparam query_t    Must model std::ranges::random_access_range over the index's alphabet.
+ * \tparam delegate_t Takes `index_t::cursor_type` as argument.
+ * \param[in] index       String index to be searched.
+ * \param[in] query       The query.
+ * \param[in] delegate    Function that is called if the query occurs in the text.
+ * \param[in] delegate_rc Function that is called if the reverse complement of the query occurs in the text.
+ *
+ * \details
+ *
+ * The reverse complement of the query read from left to right is the complement of the query read from right to left.
+ * Hence, the cursor of the reverse complement is extended to the left by the complement of each character while the
+ * cursor of the query is extended to the right by the character itself. Both cursors are advanced in lock-step and
+ * the query is only read once. The search stops as soon as neither string occurs in the text.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|)\f$ extensions of each cursor.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking the delegates also has
+ * a strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <typename index_t, typename query_t, typename delegate_t, typename delegate_rc_t>
+inline void search_both_strands_exact(index_t const & index,
+                                      query_t & query,
+                                      delegate_t && delegate,
+                                      delegate_rc_t && delegate_rc)
+{
+    auto cursor = index.begin();
+    auto cursor_rc = index.begin();
+    bool found{true};
+    bool found_rc{true};
+
+    auto it = std::ranges::begin(query);
+
+    // the first characters are looked up in the k-mer lookup table of the index (if any)
+    size_t const seed_length = index.kmer_lookup_length();
+    if (seed_length > 0 && static_cast<size_t>(std::ranges::size(query)) >= seed_length)
+    {
+        auto seed = query | views::slice(0, seed_length);
+        found = cursor.extend_right(seed);
+        found_rc = cursor_rc.extend_left(seed | std::views::reverse | views::complement);
+        std::ranges::advance(it, seed_length);
+    }
+
+    for (; it != std::ranges::end(query) && (found || found_rc); ++it)
+    {
+        if (found)
+            found = cursor.extend_right(*it);
+        if (found_rc)
+            found_rc = cursor_rc.extend_left(seqan3::complement(*it));
+    }
+
+    if (found)
+        delegate(cursor);
+    if (found_rc)
+        delegate_rc(cursor_rc);
+}
+
+/*!\brief Returns whether the configuration allows no errors at all.
+ * \tparam configuration_t The search configuration type.
+ * \param[in] cfg A configuration object specifying the search parameters.
+ */
+template <typename configuration_t>
+inline bool search_without_errors(configuration_t const & cfg)
+{
+    if constexpr (configuration_t::template exists<search_cfg::max_error>())
+        return get<search_cfg::max_error>(cfg).value[0] == 0;
+    else if constexpr (configuration_t::template exists<search_cfg::max_error_rate>())
+        return get<search_cfg::max_error_rate>(cfg).value[0] == 0;
+    else
+        return true;
+}
+
 /*!\brief Search a single query in an index.
  * \tparam index_t   Must model seqan3::fm_index_specialisation.
  * \tparam queries_t Must model std::ranges::random_access_range over the index's alphabet.
@@ -71,21 +286,86 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     // throw std::invalid_argument("The total number of errors is set to zero while there is a positive number"
     //                             " of errors for a specific error type.");
 
+    constexpr bool both_strands = cfg_t::template exists<search_cfg::strand<detail::search_strand_both>>();
+    constexpr bool output_alignment = cfg_t::template exists<search_cfg::output<detail::search_output_alignment>>();
+
+    // with alignment output, each cursor is collected with the edit operations of its path
+    using cursor_t = typename index_t::cursor_type;
+    using internal_hit_t = std::conditional_t<output_alignment, std::pair<cursor_t, search_transcript>, cursor_t>;
+
     // construct internal delegate for collecting hits for later filtering (if necessary)
-    std::vector<typename index_t::cursor_type> internal_hits;
-    auto internal_delegate = [&internal_hits, &max_error] (auto const & it)
+    auto collecting_delegate = [&] (std::vector<internal_hit_t> & hits)
     {
-        internal_hits.push_back(it);
+        if constexpr (output_alignment)
+        {
+            auto collect = [&hits] (cursor_t const & it, search_transcript const & transcript)
+            {
+                hits.emplace_back(it, transcript);
+            };
+            return search_transcript_delegate<decltype(collect)>{collect, search_transcript{std::ranges::size(query),
+                                                                                             max_error.total}};
+        }
+        else
+        {
+            return [&hits] (cursor_t const & it)
+            {
+                hits.push_back(it);
+            };
+        }
+    };
+
+    std::vector<internal_hit_t> internal_hits;
+    auto internal_delegate = collecting_delegate(internal_hits);
+
+    // the hits of the reverse complement of the query
+    std::vector<internal_hit_t> internal_hits_rc;
+    auto internal_delegate_rc = collecting_delegate(internal_hits_rc);
+
+    // a query that is its own reverse complement has the same hits on both strands
+    bool palindrome{false};
+    if constexpr (both_strands)
+    {
+        static_assert(nucleotide_alphabet<typename index_t::char_type>,
+                      "Searching both strands requires an index over a nucleotide alphabet.");
+        palindrome = std::ranges::equal(query, query | std::views::reverse | views::complement);
+    }
+
+    // searches the query (and its reverse complement) with the given error bounds
+    auto search_strands = [&] (auto const abort_on_hit, detail::search_param const error)
+    {
+        constexpr bool abort_at_hit = decltype(abort_on_hit)::value;
+        detail::search_algo<abort_at_hit>(index, query, error, internal_delegate);
+
+        if constexpr (both_strands)
+        {
+            if (!palindrome && !(abort_at_hit && !internal_hits.empty()))
+            {
+                auto query_rc = query | std::views::reverse | views::complement;
+                detail::search_algo<abort_at_hit>(index, query_rc, error, internal_delegate_rc);
+            }
+        }
     };
+    auto no_hits = [&] () { return internal_hits.empty() && internal_hits_rc.empty(); };
 
     // choose mode
+    if constexpr (both_strands && bi_fm_index_specialisation<index_t> && !output_alignment &&
+                  !cfg_t::template exists<search_cfg::mode<search_cfg::strata>>())
+    {
+        // without errors, both strands are searched in a single pass using the bidirectional index
+        if (max_error.total == 0 && !palindrome)
+        {
+            search_both_strands_exact(index, query, internal_delegate, internal_delegate_rc);
+            return search_hits_both_strands<cfg_t>(std::move(internal_hits), std::move(internal_hits_rc));
+        }
+    }
+
     if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
+        while (no_hits() && max_error2.total <= max_error.total)
         {
-            detail::search_algo<true>(index, query, max_error2, internal_delegate);
+            search_strands(std::true_type{}, max_error2);
             max_error2.total++;
         }
     }
@@ -93,9 +373,9 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
+        while (no_hits() && max_error2.total <= max_error.total)
         {
-            detail::search_algo<false>(index, query, max_error2, internal_delegate);
+            search_strands(std::false_type{}, max_error2);
             max_error2.total++;
         }
     }
@@ -103,58 +383,37 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
+        while (no_hits() && max_error2.total <= max_error.total)
         {
-            detail::search_algo<true>(index, query, max_error2, internal_delegate);
+            search_strands(std::true_type{}, max_error2);
             max_error2.total++;
         }
-        if (!internal_hits.empty())
+        if (!no_hits())
         {
-            internal_hits.clear(); // TODO: don't clear when using Optimum Search Schemes with lower error bounds
+            // TODO: don't clear when using Optimum Search Schemes with lower error bounds
+            internal_hits.clear();
+            internal_hits_rc.clear();
             uint8_t const s = get<search_cfg::mode>(cfg).value;
             max_error2.total += s - 1;
-            detail::search_algo<false>(index, query, max_error2, internal_delegate);
+            search_strands(std::false_type{}, max_error2);
         }
     }
     else // detail::search_mode_all
     {
-        detail::search_algo<false>(index, query, max_error, internal_delegate);
+        search_strands(std::false_type{}, max_error);
     }
 
     // TODO: filter hits and only do it when necessary (depending on error types)
 
-    // output cursors or text_positions
-    if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
+    if constexpr (both_strands)
     {
-        return internal_hits;
+        if (palindrome)
+            internal_hits_rc = internal_hits;
+        return search_hits_both_strands<cfg_t>(std::move(internal_hits), std::move(internal_hits_rc));
     }
     else
     {
-        using hit_t = std::conditional_t<index_t::text_layout_mode == text_layout::collection,
-                                         std::pair<typename index_t::size_type, typename index_t::size_type>,
-                                         typename index_t::size_type>;
-        std::vector<hit_t> hits;
-
-        if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
-        {
-            // only one cursor is reported but it might contain more than one text position
-            if (!internal_hits.empty())
-            {
-                auto text_pos = internal_hits[0].lazy_locate();
-                hits.push_back(text_pos[0]);
-            }
-        }
-        else
-        {
-            for (auto const & cur : internal_hits)
-            {
-                for (auto const & text_pos : cur.locate())
-                    hits.push_back(text_pos);
-                std::sort(hits.begin(), hits.end());
-                hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
-            }
-        }
-        return hits;
+        return search_hits<cfg_t>(std::move(internal_hits));
     }
 }
 
@@ -187,14 +446,65 @@ inline auto search_all(index_t const & index, queries_t & queries, configuration
     using text_pos_t = std::conditional_t<index_t::text_layout_mode == text_layout::collection,
                                           std::pair<typename index_t::size_type, typename index_t::size_type>,
                                           typename index_t::size_type>;
-    using hit_t = std::conditional_t<cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>(),
-                                     typename index_t::cursor_type,
-                                     text_pos_t>;
+    constexpr bool output_cursor = cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>();
+    constexpr bool output_alignment = cfg_t::template exists<search_cfg::output<detail::search_output_alignment>>();
+    using single_hit_t = std::conditional_t<output_cursor,
+                                            typename index_t::cursor_type,
+                                            std::conditional_t<output_alignment,
+                                                               search_alignment<text_pos_t>,
+                                                               text_pos_t>>;
+    constexpr bool both_strands = cfg_t::template exists<search_cfg::strand<detail::search_strand_both>>();
+    using hit_t = std::conditional_t<both_strands, std::pair<single_hit_t, search_strand>, single_hit_t>;
 
     if constexpr (std::ranges::forward_range<queries_t> && std::ranges::random_access_range<value_type_t<queries_t>>)
     {
         // TODO: if constexpr (contains<search_cfg::id::on_hit>(cfg))
         std::vector<std::vector<hit_t>> hits;
+
+        // Without errors, all modes except best and strata report all occurrences of a query. Searching many queries
+        // in lock-step hides the memory latency of the index. Alignments are reported by the backtracking searches.
+        if constexpr (!output_alignment &&
+                      (cfg_t::template exists<search_cfg::mode<detail::search_mode_all>>() ||
+                       cfg_t::template exists<search_cfg::mode<detail::search_mode_all_best>>()))
+        {
+            if (search_without_errors(cfg))
+            {
+                hits.resize(std::distance(queries.begin(), queries.end()));
+                if constexpr (both_strands)
+                {
+                    using cursor_t = typename index_t::cursor_type;
+                    std::vector<std::vector<cursor_t>> cursors(hits.size());
+                    std::vector<std::vector<cursor_t>> cursors_rc(hits.size());
+
+                    search_batch_exact(index, queries, [&cursors] (size_t const query_id, auto const & cursor)
+                    {
+                        cursors[query_id].push_back(cursor);
+                    });
+
+                    // the reverse complements are searched as views on the queries
+                    auto queries_rc = queries | std::views::transform([] (auto && query)
+                    {
+                        return query | std::views::reverse | views::complement;
+                    });
+                    search_batch_exact(index, queries_rc, [&cursors_rc] (size_t const query_id, auto const & cursor)
+                    {
+                        cursors_rc[query_id].push_back(cursor);
+                    });
+
+                    for (size_t i = 0; i < hits.size(); ++i)
+                        hits[i] = search_hits_both_strands<cfg_t>(std::move(cursors[i]), std::move(cursors_rc[i]));
+                }
+                else
+                {
+                    search_batch_exact(index, queries, [&hits] (size_t const query_id, auto const & cursor)
+                    {
+                        hits[query_id] = search_hits<cfg_t>(std::vector{cursor});
+                    });
+                }
+                return hits;
+            }
+        }
+
         hits.reserve(std::distance(queries.begin(), queries.end()));
         for (auto const query : queries)
         {
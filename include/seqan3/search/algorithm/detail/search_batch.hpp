@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides a search algorithm that advances the cursors of many queries in lock-step.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_search_algorithm
+ * \{
+ */
+
+//!\brief The default number of queries that are searched in lock-step by seqan3::detail::search_batch_exact.
+inline constexpr size_t search_batch_size = 32;
+
+/*!\brief Searches a range of queries without errors, advancing the cursors of a batch of queries in lock-step.
+ * \tparam batch_size The number of queries searched concurrently.
+ * \tparam index_t    Must model seqan3::fm_index_specialisation.
+ * \tparam queries_t  Must model std::ranges::forward_range over std::ranges::random_access_range.
+ * \tparam delegate_t Takes the position of the query in `queries` and a `index_t::cursor_type` as arguments.
+ * \param[in] index    String index to be searched.
+ * \param[in] queries  The queries to search.
+ * \param[in] delegate Function that is called for every query that occurs in the text.
+ *
+ * \details
+ *
+ * Each extension of a cursor depends on the result of the previous one, so searching a single query is bound by the
+ * memory latency of the rank queries. This algorithm extends the cursors of up to `batch_size` queries by one
+ * character in a round-robin fashion and prefetches the data needed for the next extension of a cursor right after
+ * extending it. By the time the cursor is extended again, the data has been loaded while the other cursors of the
+ * batch were extended. A query that is finished or has no occurrences is replaced by the next query.
+ *
+ * If the index has a k-mer lookup table (see seqan3::fm_index_construction_options::kmer_lookup_length), the first
+ * k characters of each query are looked up when the query enters the batch.
+ *
+ * Prefetching requires an index whose occurrence table models seqan3::detail::prefetchable_occurrence_table, which
+ * currently only seqan3::sdsl_epr_index_type does. The default seqan3::sdsl_wt_index_type prefetches nothing: a rank
+ * query on a wavelet tree descends its levels and the position on each level depends on the rank on the previous
+ * one. For such indices, only the interleaving remains, which allows the processor to overlap the independent memory
+ * accesses of different queries.
+ *
+ * The delegate is not called in the order of the queries.
+ *
+ * ### Complexity
+ *
+ * \f$O(\sum |query|)\f$ extensions.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the queries does not change their state and if invoking the delegate
+ * also has a strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <size_t batch_size = search_batch_size, typename index_t, typename queries_t, typename delegate_t>
+inline void search_batch_exact(index_t const & index, queries_t & queries, delegate_t && delegate)
+{
+    static_assert(batch_size > 0, "The batch size must be positive.");
+
+    using cursor_t = typename index_t::cursor_type;
+
+    // the state of a query in the batch
+    struct slot_type
+    {
+        cursor_t cursor;
+        std::ranges::iterator_t<queries_t> query;
+        size_t query_id;
+        size_t position;
+    };
+
+    std::vector<slot_type> batch;
+    batch.reserve(batch_size);
+
+    auto next_query = std::ranges::begin(queries);
+    size_t next_query_id = 0;
+
+    size_t const seed_length = index.kmer_lookup_length();
+
+    auto refill = [&] ()
+    {
+        for (; batch.size() < batch_size && next_query != std::ranges::end(queries); ++next_query, ++next_query_id)
+        {
+            slot_type slot{index.begin(), next_query, next_query_id, 0};
+
+            // the cursor is seeded from the k-mer lookup table of the index (if any)
+            if (seed_length > 0 && std::ranges::size(*next_query) >= seed_length)
+            {
+                if (!slot.cursor.extend_right(*next_query | views::slice(0, seed_length)))
+                    continue;
+                slot.position = seed_length;
+            }
+
+            batch.push_back(std::move(slot));
+        }
+    };
+
+    refill();
+
+    while (!batch.empty())
+    {
+        for (size_t i = 0; i < batch.size();)
+        {
+            slot_type & slot = batch[i];
+            auto && query = *slot.query;
+
+            bool const finished = slot.position == std::ranges::size(query);
+
+            if (finished || !slot.cursor.extend_right(query[slot.position]))
+            {
+                if (finished)
+                    delegate(slot.query_id, slot.cursor);
+
+                // replace the slot by the last one, which is then processed next
+                if (i + 1 != batch.size())
+                    slot = std::move(batch.back());
+                batch.pop_back();
+                continue;
+            }
+
+            ++slot.position;
+            slot.cursor.prefetch_extend_right();
+            ++i;
+        }
+
+        refill();
+    }
+}
+
+//!\}
+
+} // namespace seqan3::detail
@@ -12,9 +12,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/core/platform.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/core/type_traits/template_inspection.hpp>
 
 namespace seqan3::detail
 {
@@ -32,4 +37,157 @@ struct search_param
     uint8_t deletion;
 };
 
+/*!\brief The edit operations on the current path of a backtracking search.
+ * \ingroup submodule_search_algorithm
+ *
+ * \details
+ *
+ * The searches extend the matched part of the query to the right and, in a bidirectional index, to the left. The
+ * operations of both directions are kept on separate stacks; the transcript of a hit is the reversed left stack
+ * followed by the right stack. The operations are `=` (match), `X` (mismatch), `I` (a character of the query that is
+ * not in the text) and `D` (a character of the text that is not in the query).
+ */
+class search_transcript
+{
+private:
+    //!\brief The operations added while extending to the left, the last one is the leftmost.
+    std::vector<char> left{};
+    //!\brief The operations added while extending to the right, the last one is the rightmost.
+    std::vector<char> right{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    search_transcript() = default;                                      //!< Defaulted.
+    search_transcript(search_transcript const &) = default;             //!< Defaulted.
+    search_transcript(search_transcript &&) = default;                  //!< Defaulted.
+    search_transcript & operator=(search_transcript const &) = default; //!< Defaulted.
+    search_transcript & operator=(search_transcript &&) = default;      //!< Defaulted.
+    ~search_transcript() = default;                                     //!< Defaulted.
+
+    /*!\brief Reserves space for the operations of a query, s.t. recording does not allocate during the search.
+     * \param[in] query_length The length of the query.
+     * \param[in] max_errors   The maximum number of errors.
+     */
+    search_transcript(size_t const query_length, size_t const max_errors)
+    {
+        left.reserve(query_length + max_errors);
+        right.reserve(query_length + max_errors);
+    }
+    //!\}
+
+    //!\brief Adds `count` operations `op` in the given direction.
+    void push(bool const go_right, char const op, size_t const count)
+    {
+        auto & ops = go_right ? right : left;
+        ops.insert(ops.end(), count, op);
+    }
+
+    //!\brief Removes the last `count` operations in the given direction.
+    void pop(bool const go_right, size_t const count) noexcept
+    {
+        auto & ops = go_right ? right : left;
+        ops.resize(ops.size() - count);
+    }
+
+    //!\brief Returns the number of errors, i.e. of operations other than matches.
+    uint8_t errors() const noexcept
+    {
+        auto is_error = [] (char const op) { return op != '='; };
+        return static_cast<uint8_t>(std::count_if(left.begin(), left.end(), is_error) +
+                                    std::count_if(right.begin(), right.end(), is_error));
+    }
+
+    //!\brief Returns the run-length encoded operations from left to right.
+    std::vector<cigar> cigar_vector() const
+    {
+        std::vector<char> ops{left.rbegin(), left.rend()};
+        ops.insert(ops.end(), right.begin(), right.end());
+
+        std::vector<cigar> result;
+        for (auto run_begin = ops.begin(); run_begin != ops.end();)
+        {
+            auto run_end = std::find_if(run_begin, ops.end(), [op = *run_begin] (char const c) { return c != op; });
+            result.push_back(cigar{static_cast<uint32_t>(run_end - run_begin), cigar_op{}.assign_char(*run_begin)});
+            run_begin = run_end;
+        }
+        return result;
+    }
+};
+
+/*!\brief A delegate for the backtracking searches that records the edit operations of the hits.
+ * \ingroup submodule_search_algorithm
+ * \tparam delegate_t The type of the wrapped delegate; invoked with the cursor and the seqan3::detail::search_transcript
+ *                    of each hit.
+ *
+ * \details
+ *
+ * The searches record their edit operations via seqan3::detail::search_record_edit if their delegate is of this type.
+ * For any other delegate, recording is a no-op.
+ */
+template <typename delegate_t>
+struct search_transcript_delegate
+{
+    //!\brief The wrapped delegate.
+    delegate_t delegate;
+    //!\brief The operations of the current path.
+    search_transcript transcript;
+
+    //!\brief Reports a hit with the operations of the current path.
+    template <typename cursor_t>
+    void operator()(cursor_t const & cursor)
+    {
+        delegate(cursor, transcript);
+    }
+};
+
+//!\brief Removes the operations added by seqan3::detail::search_record_edit when leaving the scope.
+//!\ingroup submodule_search_algorithm
+class search_scoped_edit
+{
+private:
+    //!\brief The transcript the operations were added to.
+    search_transcript & transcript;
+    //!\brief The direction the operations were added in.
+    bool go_right;
+    //!\brief The number of operations.
+    size_t count;
+
+public:
+    //!\brief Adds the operations.
+    search_scoped_edit(search_transcript & transcript_, bool const go_right_, char const op, size_t const count_) :
+        transcript{transcript_}, go_right{go_right_}, count{count_}
+    {
+        transcript.push(go_right, op, count);
+    }
+
+    search_scoped_edit(search_scoped_edit const &) = delete;             //!< Deleted.
+    search_scoped_edit & operator=(search_scoped_edit const &) = delete; //!< Deleted.
+
+    //!\brief Removes the operations.
+    ~search_scoped_edit()
+    {
+        transcript.pop(go_right, count);
+    }
+};
+
+/*!\brief Records `count` edit operations `op` of a backtracking search for the rest of the enclosing scope.
+ * \ingroup submodule_search_algorithm
+ * \param[in] delegate The delegate of the search; the operations are only recorded for a
+ *                     seqan3::detail::search_transcript_delegate.
+ * \param[in] go_right Whether the operations extend the matched part of the query to the right.
+ * \param[in] op       The operation, one of `=`, `X`, `I` and `D`.
+ * \param[in] count    The number of operations.
+ * \returns An object that removes the operations when it is destroyed.
+ */
+template <typename delegate_t>
+inline auto search_record_edit(delegate_t & delegate, bool const go_right, char const op, size_t const count = 1)
+{
+    if constexpr (is_type_specialisation_of_v<remove_cvref_t<delegate_t>, search_transcript_delegate>)
+        return search_scoped_edit{delegate.transcript, go_right, op, count};
+    else
+        return std::false_type{};
+}
+
 } // namespace seqan3::detail
@@ -14,9 +14,11 @@
 
 #include <type_traits>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/type_traits/transformation_trait_or.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/search/algorithm/detail/search_common.hpp>
+#include <seqan3/search/algorithm/detail/search_scheme_optimiser.hpp>
 #include <seqan3/search/algorithm/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/algorithm/detail/search_trivial.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
@@ -28,34 +30,12 @@ namespace seqan3::detail
  * \{
  */
 
-/*!\brief Computes a (non-optimal) search scheme. Currently the generated search scheme represents trivial backtracking.
- * \param[in] min_error Minimum number of errors allowed.
- * \param[in] max_error Maximum number of errors allowed.
- *
- * ### Complexity
- *
- * Constant.
- *
- * ### Exceptions
- *
- * Strong exception guarantee.
- */
-inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const max_error)
-{
-    // TODO: Replace this at least by the pigeonhole principle or even better by 01*0 schemes.
-    // NOTE: Make sure that the searches are sorted by their asymptotical running time (i.e. upper error bound string),
-    //       s.t. easy to compute searches come first. This improves the running time of algorithms that abort after the
-    //       first hit (e.g. search mode: best). Even though it is not guaranteed, this seems to be a good greedy
-    //       approach.
-    std::vector<search_dyn> scheme{{{1}, {min_error}, {max_error}}};
-    return scheme;
-}
-
 /*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
  *        starting position of the first block in the query sequence.
  * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam blocks_length_t  Must model std::ranges::random_access_range over unsigned integers.
  * \param[in] search_scheme Search scheme that will be used for searching.
- * \param[in] query_length  Length of the query that will be searched in an index.
+ * \param[in] blocks_length The length of each block in the order of the blocks in the query.
  * \returns A range of pairs containing for each search the cumulative lengths of blocks and the starting position
  *          in the query.
  *
@@ -67,8 +47,8 @@ inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const
  *
  * Strong exception guarantee.
  */
-template <typename search_scheme_t>
-inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size_t const query_length)
+template <typename search_scheme_t, std::ranges::random_access_range blocks_length_t>
+inline auto search_scheme_block_info(search_scheme_t const & search_scheme, blocks_length_t const & blocks_length)
 {
     using blocks_length_type = typename search_scheme_t::value_type::blocks_length_type;
 
@@ -85,20 +65,7 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
     if constexpr (is_dyn_scheme)
         result.resize(search_scheme.size());
 
-    uint8_t const blocks      {search_scheme[0].blocks()};
-    size_t  const block_length{query_length / blocks};
-    uint8_t const rest        {static_cast<uint8_t>(query_length % blocks)};
-
-    blocks_length_type blocks_length;
-    // set all blocks_length values to block_length
-    // resp. block_length + 1 for the first `rest = block_length % blocks` values
-    if constexpr (is_dyn_scheme)
-        blocks_length.resize(blocks, block_length);
-    else
-        blocks_length.fill(block_length);
-
-    for (uint8_t block_id = 0; block_id < rest; ++block_id)
-        ++blocks_length[block_id];
+    uint8_t const blocks{search_scheme[0].blocks()};
 
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
@@ -122,6 +89,47 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
     return result;
 }
 
+/*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
+ *        starting position of the first block in the query sequence. All blocks have the same length (+/- 1).
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \param[in] search_scheme Search scheme that will be used for searching.
+ * \param[in] query_length  Length of the query that will be searched in an index.
+ * \returns A range of pairs containing for each search the cumulative lengths of blocks and the starting position
+ *          in the query.
+ *
+ * ### Complexity
+ *
+ * Constant.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+template <typename search_scheme_t>
+inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size_t const query_length)
+{
+    using blocks_length_type = typename search_scheme_t::value_type::blocks_length_type;
+
+    bool constexpr is_dyn_scheme = std::same_as<search_scheme_t, search_scheme_dyn_type>;
+
+    uint8_t const blocks      {search_scheme[0].blocks()};
+    size_t  const block_length{query_length / blocks};
+    uint8_t const rest        {static_cast<uint8_t>(query_length % blocks)};
+
+    blocks_length_type blocks_length;
+    // set all blocks_length values to block_length
+    // resp. block_length + 1 for the first `rest = block_length % blocks` values
+    if constexpr (is_dyn_scheme)
+        blocks_length.resize(blocks, block_length);
+    else
+        blocks_length.fill(block_length);
+
+    for (uint8_t block_id = 0; block_id < rest; ++block_id)
+        ++blocks_length[block_id];
+
+    return search_scheme_block_info(search_scheme, blocks_length);
+}
+
 //!\cond
 // forward declaration
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t, typename blocks_length_t,
@@ -183,6 +191,8 @@ inline bool search_ss_exact(cursor_t cur, query_t & query,
         if (!cur.extend_right(query | views::slice(infix_lb, infix_rb + 1)))
             return false;
 
+        [[maybe_unused]] auto const edit = search_record_edit(delegate, true, '=', infix_rb + 1 - infix_lb);
+
         if (search_ss<abort_on_hit>(cur, query, lb, infix_rb + 2, errors_spent, block_id2, go_right2, search,
                                     blocks_length, error_left, delegate) && abort_on_hit)
         {
@@ -197,6 +207,8 @@ inline bool search_ss_exact(cursor_t cur, query_t & query,
         if (!cur.extend_left(query | views::slice(infix_lb, infix_rb + 1)))
             return false;
 
+        [[maybe_unused]] auto const edit = search_record_edit(delegate, false, '=', infix_rb + 1 - infix_lb);
+
         if (search_ss<abort_on_hit>(cur, query, infix_lb, rb, errors_spent, block_id2, go_right2, search, blocks_length,
                                     error_left, delegate) && abort_on_hit)
         {
@@ -248,6 +260,7 @@ inline bool search_ss_deletion(cursor_t cur, query_t & query,
         error_left2.deletion--;
         do
         {
+            [[maybe_unused]] auto const edit = search_record_edit(delegate, go_right, 'D');
             if (search_ss_deletion<abort_on_hit>(cur, query, lb, rb, errors_spent + 1, block_id, go_right, search,
                                                  blocks_length, error_left2, delegate) && abort_on_hit)
             {
@@ -298,6 +311,7 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
                 search_param error_left2{error_left};
                 error_left2.total -= delta;
                 error_left2.substitution -= delta;
+                [[maybe_unused]] auto const edit = search_record_edit(delegate, go_right, delta ? 'X' : '=');
 
                 // At the end of the current block
                 if (rb - lb == blocks_length[block_id])
@@ -347,6 +361,7 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
                 search_param error_left3{error_left};
                 error_left3.total--;
                 error_left3.deletion--;
+                [[maybe_unused]] auto const edit = search_record_edit(delegate, go_right, 'D');
                 search_ss<abort_on_hit>(cur, query, lb, rb, errors_spent + 1, block_id, go_right, search, blocks_length,
                                         error_left3, delegate);
             }
@@ -400,6 +415,7 @@ inline bool search_ss(cursor_t cur, query_t & query,
             search_param error_left2{error_left};
             error_left2.total--;
             error_left2.insertion--;
+            [[maybe_unused]] auto const edit = search_record_edit(delegate, go_right, 'I');
             // At the end of the current block
             if (rb - lb == blocks_length[block_id])
             {
@@ -433,16 +449,18 @@ inline bool search_ss(cursor_t cur, query_t & query,
     return false;
 }
 
-/*!\brief Searches a query sequence in a bidirectional index using search schemes.
+/*!\brief Searches a query sequence in a bidirectional index using search schemes with given block lengths.
  * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
  * \tparam index_t          Must model seqan3::bi_fm_index_specialisation.
  * \tparam query_t          Must model std::ranges::random_access_range over the index's alphabet.
  * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam block_info_t     The result type of seqan3::detail::search_scheme_block_info.
  * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
  * \param[in] index         String index built on the text that will be searched.
  * \param[in] query         Query sequence to be searched in the index.
  * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
  * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] block_info    Cumulative block lengths and starting position of each search for the length of `query`.
  * \param[in] delegate      Function that is called on every hit.
  *
  * ### Complexity
@@ -454,13 +472,11 @@ inline bool search_ss(cursor_t cur, query_t & query,
  * Strong exception guarantee if iterating the query does not change its state and if invoking the delegate also has a
  * strong exception guarantee; basic exception guarantee otherwise.
  */
-template <bool abort_on_hit, typename index_t, typename query_t, typename search_scheme_t, typename delegate_t>
+template <bool abort_on_hit, typename index_t, typename query_t, typename search_scheme_t, typename block_info_t,
+          typename delegate_t>
 inline void search_ss(index_t const & index, query_t & query, search_param const error_left,
-                      search_scheme_t const & search_scheme, delegate_t && delegate)
+                      search_scheme_t const & search_scheme, block_info_t const & block_info, delegate_t && delegate)
 {
-    // retrieve cumulative block lengths and starting position
-    auto const block_info = search_scheme_block_info(search_scheme, std::ranges::size(query));
-
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
         auto const & search = search_scheme[search_id];
@@ -484,6 +500,36 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
     }
 }
 
+/*!\brief Searches a query sequence in a bidirectional index using search schemes.
+ * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
+ * \tparam index_t          Must model seqan3::bi_fm_index_specialisation.
+ * \tparam query_t          Must model std::ranges::random_access_range over the index's alphabet.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index         String index built on the text that will be searched.
+ * \param[in] query         Query sequence to be searched in the index.
+ * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] delegate      Function that is called on every hit.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking the delegate also has a
+ * strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename search_scheme_t, typename delegate_t>
+inline void search_ss(index_t const & index, query_t & query, search_param const error_left,
+                      search_scheme_t const & search_scheme, delegate_t && delegate)
+{
+    // retrieve cumulative block lengths and starting position
+    search_ss<abort_on_hit>(index, query, error_left, search_scheme,
+                            search_scheme_block_info(search_scheme, std::ranges::size(query)), delegate);
+}
+
 /*!\brief Searches a query sequence in a bidirectional index.
  * \tparam abort_on_hit    If the flag is set, the search aborts on the first hit.
  * \tparam index_t         Must model seqan3::bi_fm_index_specialisation.
@@ -522,9 +568,14 @@ inline void search_algo_bi(index_t const & index, query_t & query, search_param
             search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 3>, delegate);
             break;
         default:
-            auto const & search_scheme{compute_ss(0, error_left.total)};
-            search_ss<abort_on_hit>(index, query, error_left, search_scheme, delegate);
+        {
+            auto const scheme = optimised_search_scheme(0, error_left.total, std::ranges::size(query),
+                                                        alphabet_size<typename index_t::char_type>, index.size());
+            auto const & [search_scheme, blocks_length] = *scheme;
+            search_ss<abort_on_hit>(index, query, error_left, search_scheme,
+                                    search_scheme_block_info(search_scheme, blocks_length), delegate);
             break;
+        }
     }
 }
 
@@ -0,0 +1,360 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the generation of search schemes and block lengths for an arbitrary number of errors.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/search/algorithm/detail/search_scheme_precomputed.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_search_algorithm
+ * \{
+ */
+
+//!\brief A search scheme together with the lengths of its blocks, tuned for a certain query length.
+struct optimised_search_scheme_type
+{
+    //!\brief The searches.
+    search_scheme_dyn_type search_scheme;
+    //!\brief The length of each block in the order of the blocks in the query (not in the order of a search).
+    std::vector<size_t> blocks_length;
+};
+
+/*!\brief Computes a search scheme that consists of a single search, i.e. trivial backtracking.
+ * \param[in] min_error Minimum number of errors allowed.
+ * \param[in] max_error Maximum number of errors allowed.
+ *
+ * \details
+ *
+ * The trivial search scheme is the fallback for queries that are too short to be split into more blocks than
+ * errors. Use seqan3::detail::optimised_search_scheme for all other queries.
+ *
+ * ### Complexity
+ *
+ * Constant.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const max_error)
+{
+    std::vector<search_dyn> scheme{{{1}, {min_error}, {max_error}}};
+    return scheme;
+}
+
+/*!\brief Computes a search scheme with one search starting at each block.
+ * \param[in] min_error Minimum number of errors allowed.
+ * \param[in] max_error Maximum number of errors allowed.
+ * \param[in] blocks    The number of blocks; must be greater than `max_error` and at most 255.
+ *
+ * \details
+ *
+ * The i-th search matches the i-th block without errors and extends to the right. The m-th block to the right of the
+ * starting block may have at most m errors in total, i.e. the search only spends more than one error per block if
+ * it has been saved up before. Afterwards, the search extends to the left allowing all remaining errors.
+ *
+ * The search scheme covers every error distribution: Let \f$d_j = e_j - 1\f$ be the errors in block j minus one.
+ * Since there are less errors than blocks, the sum over all \f$d_j\f$ is negative. For the starting block i
+ * following the last maximum of the prefix sums of \f$d\f$, every sum of \f$d_i, \ldots, d_{i + m}\f$ is negative,
+ * i.e. block i has no errors and the blocks i to i + m have at most m errors.
+ *
+ * The searches are sorted by their upper error bound strings, s.t. easy to compute searches come first.
+ *
+ * ### Complexity
+ *
+ * Quadratic in the number of blocks.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline search_scheme_dyn_type prefix_bounded_search_scheme(uint8_t const min_error,
+                                                           uint8_t const max_error,
+                                                           size_t const blocks)
+{
+    assert(blocks > max_error);
+    assert(blocks <= std::numeric_limits<uint8_t>::max());
+
+    search_scheme_dyn_type search_scheme(blocks);
+
+    // the counters are wider than the block numbers, s.t. the loops terminate for 255 blocks
+    for (size_t first = 1; first <= blocks; ++first)
+    {
+        search_dyn & search = search_scheme[first - 1];
+
+        for (size_t block = first; block <= blocks; ++block)
+        {
+            search.pi.push_back(static_cast<uint8_t>(block));
+            search.u.push_back(static_cast<uint8_t>(std::min<size_t>(block - first, max_error)));
+        }
+
+        for (size_t block = first - 1; block > 0; --block)
+        {
+            search.pi.push_back(static_cast<uint8_t>(block));
+            search.u.push_back(max_error);
+        }
+
+        search.l.resize(blocks, 0);
+        search.l.back() = min_error;
+    }
+
+    return search_scheme;
+}
+
+/*!\brief Estimates the number of cursor extensions of a search scheme when searching with substitutions.
+ * \param[in] search_scheme The search scheme.
+ * \param[in] blocks_length The length of each block in the order of the blocks in the query.
+ * \param[in] sigma         The size of the alphabet.
+ * \param[in] text_length   The length of the text that is searched.
+ *
+ * \details
+ *
+ * Each node of the backtracking tree of a search corresponds to a string that has been matched so far. The number of
+ * strings of depth d with e substitutions that are allowed by the error bounds of the search is counted by dynamic
+ * programming. Each of them occurs in a random text of length n with probability \f$\min(1, n / \sigma^d)\f$.
+ *
+ * Below the depth at which a string is expected to occur less than once, the expected number of nodes per depth
+ * cannot grow anymore. The estimation stops as soon as the remaining depths cannot change the result noticeably.
+ *
+ * ### Complexity
+ *
+ * \f$O(|search\_scheme| \cdot (\log_{\sigma}(n) + |query|) \cdot e)\f$, usually much less.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline double search_scheme_cost(search_scheme_dyn_type const & search_scheme,
+                                 std::vector<size_t> const & blocks_length,
+                                 size_t const sigma,
+                                 double const text_length)
+{
+    size_t query_length{0};
+    for (size_t const length : blocks_length)
+        query_length += length;
+
+    double cost{0};
+
+    for (search_dyn const & search : search_scheme)
+    {
+        std::vector<double> paths(search.u.back() + 1, 0.0);
+        paths[0] = 1.0;
+
+        double occurrences{text_length};
+        size_t remaining{query_length};
+
+        for (uint8_t i = 0; i < search.blocks() && remaining > 0; ++i)
+        {
+            size_t const length = blocks_length[search.pi[i] - 1];
+
+            for (size_t j = 1; j <= length; ++j)
+            {
+                --remaining;
+                for (uint8_t e = search.u[i]; e > 0; --e)
+                    paths[e] += (sigma - 1) * paths[e - 1];
+
+                // paths that cannot reach the lower bound at the end of the block are abandoned
+                for (uint8_t e = 0; e < search.l[i] && e + length - j < search.l[i]; ++e)
+                    paths[e] = 0.0;
+
+                occurrences /= sigma;
+
+                double nodes{0};
+                for (double const p : paths)
+                    nodes += p;
+
+                double const contribution = nodes * std::min(1.0, occurrences);
+                cost += contribution;
+
+                if (occurrences < 1.0 && contribution * remaining < 1e-9 * cost)
+                {
+                    remaining = 0;
+                    break;
+                }
+            }
+        }
+    }
+
+    return cost;
+}
+
+/*!\brief Computes a search scheme and block lengths with a low expected running time.
+ * \param[in] min_error    Minimum number of errors allowed.
+ * \param[in] max_error    Maximum number of errors allowed.
+ * \param[in] query_length The length of the queries.
+ * \param[in] sigma        The size of the alphabet.
+ * \param[in] text_length  The length of the text that is searched.
+ *
+ * \details
+ *
+ * The candidates are the trivial search scheme and seqan3::detail::prefix_bounded_search_scheme with
+ * `max_error + 1` to `max_error + 3` blocks. Starting from blocks of equal length, the block lengths of each
+ * candidate are improved by moving characters from one block to another as long as this lowers the
+ * seqan3::detail::search_scheme_cost. The step size is halved whenever no move improves the cost anymore.
+ *
+ * ### Complexity
+ *
+ * Depends on the number of improving moves; intended to be computed once per parameter set (see
+ * seqan3::detail::optimised_search_scheme).
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline optimised_search_scheme_type optimise_search_scheme(uint8_t const min_error,
+                                                           uint8_t const max_error,
+                                                           size_t const query_length,
+                                                           size_t const sigma,
+                                                           double const text_length)
+{
+    optimised_search_scheme_type best{compute_ss(min_error, max_error), {query_length}};
+    double best_cost = search_scheme_cost(best.search_scheme, best.blocks_length, sigma, text_length);
+
+    size_t const max_blocks = std::min<size_t>({max_error + 3u, query_length, 255u});
+
+    for (size_t blocks = max_error + 1u; blocks <= max_blocks; ++blocks)
+    {
+        optimised_search_scheme_type candidate{prefix_bounded_search_scheme(min_error, max_error, blocks),
+                                               std::vector<size_t>(blocks, query_length / blocks)};
+        for (size_t block = 0; block < query_length % blocks; ++block)
+            ++candidate.blocks_length[block];
+
+        double cost = search_scheme_cost(candidate.search_scheme, candidate.blocks_length, sigma, text_length);
+
+        for (size_t step = std::max<size_t>(1, query_length / (2 * blocks)); step > 0; step /= 2)
+        {
+            for (bool improved = true; improved;)
+            {
+                improved = false;
+                for (size_t from = 0; from < blocks; ++from)
+                {
+                    for (size_t to = 0; to < blocks; ++to)
+                    {
+                        if (from == to || candidate.blocks_length[from] <= step)
+                            continue;
+
+                        candidate.blocks_length[from] -= step;
+                        candidate.blocks_length[to] += step;
+
+                        double const new_cost = search_scheme_cost(candidate.search_scheme,
+                                                                   candidate.blocks_length,
+                                                                   sigma,
+                                                                   text_length);
+                        if (new_cost < cost * (1.0 - 1e-9))
+                        {
+                            cost = new_cost;
+                            improved = true;
+                        }
+                        else
+                        {
+                            candidate.blocks_length[from] += step;
+                            candidate.blocks_length[to] -= step;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (cost < best_cost)
+        {
+            best_cost = cost;
+            best = std::move(candidate);
+        }
+    }
+
+    return best;
+}
+
+//!\brief The maximum number of search schemes kept by seqan3::detail::optimised_search_scheme.
+inline constexpr size_t optimised_search_scheme_cache_size = 1024;
+
+/*!\brief Returns a search scheme and block lengths for the given parameters, computing them on first use.
+ * \param[in] min_error    Minimum number of errors allowed.
+ * \param[in] max_error    Maximum number of errors allowed.
+ * \param[in] query_length The length of the queries.
+ * \param[in] sigma        The size of the alphabet.
+ * \param[in] text_length  The length of the text that is searched.
+ * \returns The result of seqan3::detail::optimise_search_scheme, shared with the cache.
+ *
+ * \details
+ *
+ * The text length only influences the depth below which strings are expected to occur less than once. It is
+ * rounded up to the next power of `sigma`, s.t. indices of similar size share the cached search schemes.
+ *
+ * The cache keeps at most seqan3::detail::optimised_search_scheme_cache_size search schemes. If it is full, an
+ * arbitrary entry is evicted; search schemes that are still in use stay valid through the returned pointer.
+ *
+ * ### Thread safety
+ *
+ * This function may be called concurrently. Cached search schemes are looked up under a shared lock. A missing one
+ * is computed without holding the lock, s.t. concurrent searches with other parameters are not blocked; if several
+ * threads compute the same search scheme, the first one that is inserted is returned to all of them.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline std::shared_ptr<optimised_search_scheme_type const> optimised_search_scheme(uint8_t const min_error,
+                                                                                   uint8_t const max_error,
+                                                                                   size_t const query_length,
+                                                                                   size_t const sigma,
+                                                                                   size_t const text_length)
+{
+    using key_type = std::tuple<uint8_t, uint8_t, size_t, size_t, size_t>;
+    using value_type = std::shared_ptr<optimised_search_scheme_type const>;
+
+    static std::map<key_type, value_type> cache;
+    static std::shared_mutex cache_mutex;
+
+    size_t depth{0};
+    for (double n{1}; n < text_length; n *= sigma)
+        ++depth;
+
+    key_type const key{min_error, max_error, query_length, sigma, depth};
+
+    {
+        std::shared_lock lock{cache_mutex};
+
+        if (auto it = cache.find(key); it != cache.end())
+            return it->second;
+    }
+
+    value_type scheme = std::make_shared<optimised_search_scheme_type const>(
+        optimise_search_scheme(min_error, max_error, query_length, sigma, std::pow(sigma, depth)));
+
+    std::unique_lock lock{cache_mutex};
+
+    if (auto it = cache.find(key); it != cache.end()) // computed by another thread in the meantime
+        return it->second;
+
+    if (cache.size() >= optimised_search_scheme_cache_size)
+        cache.erase(cache.begin());
+
+    cache.emplace(key, scheme);
+    return scheme;
+}
+
+//!\}
+
+} // namespace seqan3::detail
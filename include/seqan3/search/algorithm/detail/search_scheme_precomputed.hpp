@@ -168,8 +168,7 @@ inline search_scheme_type<4, 5> constexpr optimum_search_scheme<3, 3>
     {{1, 2, 3, 4, 5}, {0, 0, 0, 0, 3}, {0, 2, 2, 3, 3}}
 }};
 
-// TODO: add the following missing optimum search schemes (computation has not finished yet)
-// optimum_search_scheme<i, 4>, 0 < i <= 4
+// NOTE: Search schemes for more than 3 errors are generated by seqan3::detail::optimised_search_scheme.
 
 //!\endcond
 
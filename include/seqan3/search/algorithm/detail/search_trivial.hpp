@@ -56,7 +56,8 @@ enum class error_type : uint8_t
  *
  * ### Exceptions
  *
- * No-throw guarantee if invoking the delegate also guarantees no-throw.
+ * Basic exception guarantee. Exceptions thrown by the delegate, e.g. when collecting the hits allocates, are
+ * propagated.
  */
 template <bool abort_on_hit, typename query_t, typename cursor_t, typename delegate_t>
 inline bool search_trivial(cursor_t cur,
@@ -64,7 +65,7 @@ inline bool search_trivial(cursor_t cur,
                            typename cursor_t::size_type const query_pos,
                            search_param const error_left,
                            error_type const prev_error,
-                           delegate_t && delegate) noexcept(noexcept(delegate))
+                           delegate_t && delegate)
 {
     // Exact case (end of query sequence or no errors left)
     if (query_pos == std::ranges::size(query) || error_left.total == 0)
@@ -72,6 +73,8 @@ inline bool search_trivial(cursor_t cur,
         // If not at end of query sequence, try searching the remaining suffix without any errors.
         if (query_pos == std::ranges::size(query) || cur.extend_right(views::drop(query, query_pos)))
         {
+            [[maybe_unused]] auto const edit = search_record_edit(delegate, true, '=',
+                                                                  std::ranges::size(query) - query_pos);
             delegate(cur);
             return true;
         }
@@ -89,6 +92,7 @@ inline bool search_trivial(cursor_t cur,
             search_param error_left2{error_left};
             error_left2.insertion--;
             error_left2.total--;
+            [[maybe_unused]] auto const edit = search_record_edit(delegate, true, 'I');
 
             // Always perform a recursive call. Abort recursion if and only if recursive call found a hit and
             // abort_on_hit is set to true.
@@ -115,6 +119,7 @@ inline bool search_trivial(cursor_t cur,
                     search_param error_left2{error_left};
                     error_left2.total -= delta;
                     error_left2.substitution -= delta;
+                    [[maybe_unused]] auto const edit = search_record_edit(delegate, true, delta ? 'X' : '=');
 
                     if (search_trivial<abort_on_hit>(cur,
                                                      query,
@@ -134,6 +139,7 @@ inline bool search_trivial(cursor_t cur,
                     // Match (when error_left.substitution == 0)
                     if (error_left.substitution == 0 && cur.last_rank() == seqan3::to_rank(query[query_pos]))
                     {
+                        [[maybe_unused]] auto const edit = search_record_edit(delegate, true, '=');
                         if (search_trivial<abort_on_hit>(cur,
                                                          query,
                                                          query_pos + 1,
@@ -160,6 +166,7 @@ inline bool search_trivial(cursor_t cur,
                         // (Same character is covered by a match.)
                         if (cur.last_rank() != seqan3::to_rank(query[query_pos]))
                         {
+                            [[maybe_unused]] auto const edit = search_record_edit(delegate, true, 'D');
                             if (search_trivial<abort_on_hit>(cur,
                                                              query,
                                                              query_pos,
@@ -180,6 +187,7 @@ inline bool search_trivial(cursor_t cur,
             // Match (when error_left.substitution == 0)
             if (cur.extend_right(query[query_pos]))
             {
+                [[maybe_unused]] auto const edit = search_record_edit(delegate, true, '=');
                 if (search_trivial<abort_on_hit>(cur,
                                                  query,
                                                  query_pos + 1,
@@ -213,13 +221,14 @@ inline bool search_trivial(cursor_t cur,
  *
  * ### Exceptions
  *
- * No-throw guarantee if invoking the delegate also guarantees no-throw.
+ * Basic exception guarantee. Exceptions thrown by the delegate, e.g. when collecting the hits allocates, are
+ * propagated.
  */
 template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
 inline void search_trivial(index_t const & index,
                            query_t & query,
                            search_param const error_left,
-                           delegate_t && delegate) noexcept(noexcept(delegate))
+                           delegate_t && delegate)
 {
     search_trivial<abort_on_hit>(index.begin(), query, 0, error_left, error_type::none, delegate);
 }
@@ -65,8 +65,17 @@ namespace seqan3
  *     <td>A `std::vector<typename index_t::cursor_type>` containing index_cursors at the text positions where the
  *         search was successful.</td>
  *   </tr>
+ *   <tr>
+ *     <td style="text-align:center">\ref seqan3::text_layout "single" / "collection"</td>
+ *     <td style="text-align:center">\ref seqan3::search_cfg::alignment "alignment"</td>
+ *     <td>A `std::vector<seqan3::search_alignment<position_t>>` where `position_t` is the type of a text position
+ *         described above; each hit also contains the number of errors and the edit transcript.</td>
+ *   </tr>
  * </table>
  *
+ * If both strands are searched (see seqan3::search_cfg::strand), each hit is a `std::pair` of the hit described above
+ * and the seqan3::search_strand it was found on.
+ *
  * \if DEV \note Always returns `void` if an on_hit delegate has been specified.\endif
  *
  * \details
@@ -19,6 +19,7 @@
 #include <seqan3/search/configuration/max_error_rate.hpp>
 #include <seqan3/search/configuration/mode.hpp>
 #include <seqan3/search/configuration/output.hpp>
+#include <seqan3/search/configuration/strand.hpp>
 
 /*!\namespace seqan3::search_cfg
  * \brief A special sub namespace for the search configurations.
@@ -36,7 +37,7 @@
  * In SeqAn the search algorithm uses a configuration object to determine the desired
  * \ref seqan3::search_cfg::max_error "number"/\ref seqan3::search_cfg::max_error_rate "rate" of errors,
  * what hits are considered as \ref seqan3::search_cfg::mode "results", and how to
- * \ref seqan3::search_cfg::output "output" the result.
+ * \ref seqan3::search_cfg::output "output" the result and which \ref seqan3::search_cfg::strand "strands" to search.
  * These configurations exist in their own namespace, namely seqan3::search_cfg, to disambiguate them from the
  * configuration of other algorithms.
  *
@@ -51,10 +52,11 @@
  * types cannot be printed within the static assert, but the following table shows which combinations are possible.
  * In general, the same configuration element cannot occur more than once inside of a configuration specification.
  *
- * | **Config**                                                  | **0** | **1** | **2** | **3** |
- * | ------------------------------------------------------------|-------|-------|-------|-------|
- * | \ref seqan3::search_cfg::max_error  "0: Max error"          |   ❌   |   ❌   |   ✅   |  ✅    |
- * | \ref seqan3::search_cfg::max_error_rate "1: Max error rate" |   ❌   |   ❌   |   ✅   |  ✅    |
- * | \ref seqan3::search_cfg::output "2: Output"                 |   ✅    |   ✅    |   ❌   |  ✅    |
- * | \ref seqan3::search_cfg::mode "3: Mode"                     |   ✅    |   ✅    |   ✅   |  ❌    |
+ * | **Config**                                                  | **0** | **1** | **2** | **3** | **4** |
+ * | ------------------------------------------------------------|-------|-------|-------|-------|-------|
+ * | \ref seqan3::search_cfg::max_error  "0: Max error"          |   ❌   |   ❌   |   ✅   |  ✅    |  ✅    |
+ * | \ref seqan3::search_cfg::max_error_rate "1: Max error rate" |   ❌   |   ❌   |   ✅   |  ✅    |  ✅    |
+ * | \ref seqan3::search_cfg::output "2: Output"                 |   ✅    |   ✅    |   ❌   |  ✅    |  ✅    |
+ * | \ref seqan3::search_cfg::mode "3: Mode"                     |   ✅    |   ✅    |   ✅   |  ❌    |  ✅    |
+ * | \ref seqan3::search_cfg::strand "4: Strand"                 |   ✅    |   ✅    |   ✅   |  ✅    |  ❌    |
  */
@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/core/algorithm/configuration.hpp>
 #include <seqan3/core/algorithm/pipeable_config_element.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
@@ -28,9 +31,53 @@ struct search_output_index_cursor {};
 //!\brief Type for the "text_position" value for the configuration element "output".
 //!\ingroup search_configuration
 struct search_output_text_position {};
+//!\brief Type for the "alignment" value for the configuration element "output".
+//!\ingroup search_configuration
+struct search_output_alignment {};
 
 } // namespace seqan3::detail
 
+namespace seqan3
+{
+
+/*!\brief A hit reported with seqan3::search_cfg::alignment: the text position, the number of errors and the edit
+ *        transcript.
+ * \ingroup search_configuration
+ * \tparam position_t The type of the text position, i.e. the type of hits reported with
+ *                    seqan3::search_cfg::text_position.
+ *
+ * \details
+ *
+ * The transcript describes how the query is aligned to the text starting at `position`, from left to right in the
+ * text. It is a sequence of seqan3::cigar elements with the operations `=` (match), `X` (mismatch), `I` (insertion,
+ * a character of the query that is not in the text) and `D` (deletion, a character of the text that is not in the
+ * query). `errors` is the number of operations other than `=`.
+ */
+template <typename position_t>
+struct search_alignment
+{
+    //!\brief The position of the first aligned text character.
+    position_t position{};
+    //!\brief The number of errors of the alignment.
+    uint8_t errors{};
+    //!\brief The edit transcript of the alignment.
+    std::vector<cigar> transcript{};
+
+    //!\brief Compares two hits member-wise.
+    friend bool operator==(search_alignment const & lhs, search_alignment const & rhs) noexcept
+    {
+        return lhs.position == rhs.position && lhs.errors == rhs.errors && lhs.transcript == rhs.transcript;
+    }
+
+    //!\brief Compares two hits member-wise.
+    friend bool operator!=(search_alignment const & lhs, search_alignment const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+} // namespace seqan3
+
 namespace seqan3::search_cfg
 {
 
@@ -40,6 +87,9 @@ inline detail::search_output_index_cursor constexpr index_cursor;
 //!\brief Configuration element to receive all hits within the lowest number of errors.
 //!\ingroup search_configuration
 inline detail::search_output_text_position constexpr text_position;
+//!\brief Configuration element to receive the text positions of the hits with their errors and edit transcripts.
+//!\ingroup search_configuration
+inline detail::search_output_alignment constexpr alignment;
 
 /*!\brief Configuration element to determine the output type of hits.
  * \ingroup search_configuration
@@ -47,6 +97,16 @@ inline detail::search_output_text_position constexpr text_position;
  * \details
  * This configuration element can be used to determine the output type.
  *
+ * | Output                            | Hit                                                                      |
+ * |-----------------------------------|--------------------------------------------------------------------------|
+ * | seqan3::search_cfg::text_position | The text position (default).                                             |
+ * | seqan3::search_cfg::index_cursor  | The cursor of the index.                                                 |
+ * | seqan3::search_cfg::alignment     | A seqan3::search_alignment with the text position, errors and transcript. |
+ *
+ * With seqan3::search_cfg::alignment, the transcript is the one found while backtracking. A text position that is
+ * reached via several transcripts is reported once with a transcript of the fewest errors. The hits on the reverse
+ * complement strand (see seqan3::search_cfg::strand) are aligned with the reverse complement of the query.
+ *
  * ### Example
  *
  * \include test/snippet/search/configuration_output.cpp
@@ -54,7 +114,8 @@ inline detail::search_output_text_position constexpr text_position;
 template <typename output_t>
 //!\cond
     requires std::same_as<remove_cvref_t<output_t>, detail::search_output_text_position> ||
-             std::same_as<remove_cvref_t<output_t>, detail::search_output_index_cursor>
+             std::same_as<remove_cvref_t<output_t>, detail::search_output_index_cursor> ||
+             std::same_as<remove_cvref_t<output_t>, detail::search_output_alignment>
 //!\endcond
 struct output : public pipeable_config_element<output<output_t>, output_t>
 {
@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration for searching the reverse complement of the queries.
+ */
+
+#pragma once
+
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/search/configuration/detail.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The strand of the text on which a query was found.
+ * \ingroup search_configuration
+ * \sa seqan3::search_cfg::strand
+ */
+enum struct search_strand : bool
+{
+    forward,           //!< The query occurs in the text.
+    reverse_complement //!< The reverse complement of the query occurs in the text.
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\brief Type for the "forward_strand" value for the configuration element "strand".
+//!\ingroup search_configuration
+struct search_strand_forward {};
+//!\brief Type for the "both_strands" value for the configuration element "strand".
+//!\ingroup search_configuration
+struct search_strand_both {};
+
+} // namespace seqan3::detail
+
+namespace seqan3::search_cfg
+{
+
+//!\brief Configuration element to search only the queries themselves.
+//!\ingroup search_configuration
+inline detail::search_strand_forward constexpr forward_strand;
+//!\brief Configuration element to search the queries and their reverse complements.
+//!\ingroup search_configuration
+inline detail::search_strand_both constexpr both_strands;
+
+/*!\brief Configuration element to determine the strands that are searched.
+ * \ingroup search_configuration
+ *
+ * \details
+ * This configuration element can be used to search the reverse complement of each query together with the query
+ * itself, i.e. to find the query on both strands of a nucleotide text. The queries must be over a
+ * seqan3::nucleotide_alphabet.
+ *
+ * | Strand                             | Behaviour                                                         |
+ * |------------------------------------|-------------------------------------------------------------------|
+ * | seqan3::search_cfg::forward_strand | Search the queries only (default).                                |
+ * | seqan3::search_cfg::both_strands   | Search the queries and their reverse complements in a single call. |
+ *
+ * If both strands are searched, each hit is a `std::pair` of the hit as it would be reported without this
+ * configuration element (a text position or a cursor) and the seqan3::search_strand it was found on. A hit on the
+ * reverse complement strand is the position of the reverse complement of the query in the text. The hits on the
+ * forward strand are reported first. The modes seqan3::search_cfg::best, seqan3::search_cfg::all_best and
+ * seqan3::search_cfg::strata consider the hits on both strands together, e.g. seqan3::search_cfg::best reports a
+ * single hit on either strand.
+ *
+ * The reverse complements are not materialised. Queries that are their own reverse complement are only searched once
+ * and each of their hits is reported for both strands. Searching a single query without errors in a
+ * seqan3::bi_fm_index reads the query once and extends two cursors in lock-step: the query to the right and its
+ * reverse complement to the left.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_strand.cpp
+ */
+template <typename strand_t>
+//!\cond
+    requires std::same_as<remove_cvref_t<strand_t>, detail::search_strand_forward> ||
+             std::same_as<remove_cvref_t<strand_t>, detail::search_strand_both>
+//!\endcond
+struct strand : public pipeable_config_element<strand<strand_t>, strand_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::strand};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::search_cfg::strand
+ * \{
+ */
+
+//!\brief Deduces search strand type from constructor argument.
+template <typename strand_t>
+strand(strand_t) -> strand<remove_cvref_t<strand_t>>;
+//!\}
+
+} // namespace seqan3::search_cfg
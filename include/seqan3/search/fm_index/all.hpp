@@ -46,4 +46,5 @@
 #pragma once
 
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/fm_index/construction_options.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
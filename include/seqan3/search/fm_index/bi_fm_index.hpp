@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <future>
 #include <utility>
 
 #include <seqan3/core/type_traits/range.hpp>
@@ -57,6 +58,9 @@ namespace seqan3
  *
  * \attention When building an index for a **text collection** over any alphabet, the symbols with rank 254 and 255
  *            are reserved and may not be used in the text.
+ *
+ * The sampling of the suffix array can be chosen as for the seqan3::fm_index by passing a
+ * seqan3::sampled_sdsl_wt_index_type as third template parameter.
  */
 template <semialphabet alphabet_t,
           text_layout text_layout_mode_,
@@ -84,7 +88,10 @@ private:
     //!\brief The type of the underlying FM index for the original text.
     using fm_index_type = fm_index<alphabet_t, text_layout_mode_, sdsl_index_type>;
 
-    //!\brief The type of the underlying FM index for the reversed text.\if DEV \todo Change sampling behaviour. \endif
+    /*!\brief The type of the underlying FM index for the reversed text.
+     * \details The reversed index uses the same sampling as the index of the original text since cursors obtained by
+     *          rev_begin() also support locating occurrences.
+     */
     using rev_fm_index_type = fm_index<alphabet_t, text_layout_mode_, sdsl_index_type>;
     //!\}
 
@@ -97,7 +104,8 @@ private:
     /*!\brief Constructs the index given a range.
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
-     * \param[in] text The text to construct from.
+     * \param[in] text    The text to construct from.
+     * \param[in] options The construction options, see seqan3::fm_index_construction_options.
      *
      * \details
      * \if DEV
@@ -117,7 +125,7 @@ private:
     //!\cond
         requires text_layout_mode_ == text_layout::single
     //!\endcond
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options)
     {
         static_assert(std::ranges::bidirectional_range<text_t>, "The text must model bidirectional_range.");
         static_assert(alphabet_size<innermost_value_type_t<text_t>> <= 256, "The alphabet is too big.");
@@ -130,8 +138,7 @@ private:
             throw std::invalid_argument("The text that is indexed cannot be empty.");
 
         auto rev_text = std::views::reverse(text);
-        fwd_fm = fm_index_type{text};
-        rev_fm = fm_index_type{rev_text};
+        construct_fwd_and_rev(text, rev_text, options);
     }
 
     //!\overload
@@ -139,7 +146,7 @@ private:
     //!\cond
         requires text_layout_mode_ == text_layout::collection
     //!\endcond
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options)
     {
         static_assert(std::ranges::bidirectional_range<text_t>, "The text must model bidirectional_range.");
         static_assert(std::ranges::bidirectional_range<reference_t<text_t>>,
@@ -154,9 +161,44 @@ private:
             throw std::invalid_argument("The text that is indexed cannot be empty.");
 
         auto rev_text = text | views::deep{std::views::reverse} | std::views::reverse;
+        construct_fwd_and_rev(text, rev_text, options);
+    }
 
-        fwd_fm = fm_index_type{text};
-        rev_fm = fm_index_type{rev_text};
+    /*!\brief Constructs the indices of the original and the reversed text.
+     * \param[in] text     The original text.
+     * \param[in] rev_text The reversed text.
+     * \param[in] options  The construction options.
+     *
+     * \details
+     *
+     * Both indices are independent of each other. If at least two threads are available, they are built concurrently
+     * and each construction gets half of the threads.
+     * Only the index of the original text is located in, so only this one stores a document array.
+     */
+    template <typename text_t, typename rev_text_t>
+    void construct_fwd_and_rev(text_t && text, rev_text_t && rev_text, fm_index_construction_options const & options)
+    {
+        fm_index_construction_options fwd_options{options};
+        fm_index_construction_options rev_options{options};
+        rev_options.document_listing = false;
+
+        if (options.thread_count > 1)
+        {
+            rev_options.thread_count = options.thread_count / 2;
+            fwd_options.thread_count = options.thread_count - rev_options.thread_count;
+
+            auto rev_construction = std::async(std::launch::async, [&] ()
+            {
+                rev_fm = rev_fm_index_type{rev_text, rev_options};
+            });
+            fwd_fm = fm_index_type{text, fwd_options};
+            rev_construction.get(); // rethrows exceptions of the reverse construction
+        }
+        else
+        {
+            fwd_fm = fm_index_type{text, options};
+            rev_fm = rev_fm_index_type{rev_text, rev_options};
+        }
     }
 
 public:
@@ -199,16 +241,17 @@ public:
 
     /*!\brief Constructor that immediately constructs the index given a range. The range cannot be empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
-     * \param[in] text The text to construct from.
+     * \param[in] text    The text to construct from.
+     * \param[in] options The construction options, see seqan3::fm_index_construction_options.
      *
      * ### Complexity
      *
      * \if DEV \todo \endif At least linear.
      */
     template <std::ranges::range text_t>
-    bi_fm_index(text_t && text)
+    bi_fm_index(text_t && text, fm_index_construction_options const & options = {})
     {
-        construct(std::forward<text_t>(text));
+        construct(std::forward<text_t>(text), options);
     }
     //!\}
 
@@ -244,6 +287,23 @@ public:
         return size() == 0;
     }
 
+    /*!\brief Returns the length of the strings whose suffix array intervals are precomputed.
+     * \returns seqan3::fm_index_construction_options::kmer_lookup_length of the construction; 0 if there is no lookup
+     *          table.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    uint8_t kmer_lookup_length() const noexcept
+    {
+        return fwd_fm.kmer_lookup_length();
+    }
+
     /*!\brief Compares two indices.
      * \returns `true` if the indices are equal, false otherwise.
      *
@@ -353,6 +413,11 @@ public:
 //! \brief Deduces the dimensions of the text.
 template <std::ranges::range text_t>
 bi_fm_index(text_t &&) -> bi_fm_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+
+//! \brief Deduces the dimensions of the text.
+template <std::ranges::range text_t>
+bi_fm_index(text_t &&, fm_index_construction_options const &)
+    -> bi_fm_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
 //!\}
 
 //!\}
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <array>
+#include <tuple>
 
 #include <sdsl/suffix_trees.hpp>
 
@@ -478,6 +479,40 @@ public:
         return false;
     }
 
+    /*!\cond DEV
+     * \brief Prefetches the parts of the index needed by the next call of extend_right(char) into the cache.
+     *
+     * \details
+     *
+     * Has no effect if the underlying SDSL index does not support prefetching (see
+     * seqan3::detail::prefetchable_occurrence_table), in particular for the default seqan3::sdsl_wt_index_type.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void prefetch_extend_right() const noexcept
+    {
+        assert(index != nullptr);
+
+        detail::prefetch_rank(index->fwd_fm.index, fwd_lb);
+        detail::prefetch_rank(index->fwd_fm.index, fwd_rb + 1);
+    }
+
+    //!\brief Prefetches the parts of the index needed by the next call of extend_left(char) into the cache.
+    void prefetch_extend_left() const noexcept
+    {
+        assert(index != nullptr);
+
+        detail::prefetch_rank(index->rev_fm.index, rev_lb);
+        detail::prefetch_rank(index->rev_fm.index, rev_rb + 1);
+    }
+    //!\endcond
+
     /*!\brief Tries to extend the query by `seq` to the right.
      * \tparam seq_t The type of range of the sequence to search; must model std::ranges::forward_range.
      * \param[in] seq Sequence to extend the query with to the right.
@@ -486,6 +521,9 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the cursor points to the root and the index has been constructed with a k-mer lookup table (see
+     * seqan3::fm_index_construction_options::kmer_lookup_length), the first k characters are looked up at once.
+     *
      * ### Complexity
      *
      * \f$|seq| * O(T_{BACKWARD\_SEARCH})\f$
@@ -515,7 +553,25 @@ public:
         sdsl_char_type c = _last_char;
         size_t len{0};
 
-        for (auto it = first; it != last; ++len, ++it)
+        auto it = first;
+
+        // the first characters of a search from the root are looked up at once
+        if (depth == 0)
+        {
+            auto const & table = index->fwd_fm.lookup_table;
+            if (auto const hashes = table.template kmer_hash<index_char_type>(it, last))
+            {
+                len = table.kmer_length();
+                std::tie(_fwd_lb, _fwd_rb) = table.interval(len, hashes->first);
+                if (_fwd_lb > _fwd_rb)
+                    return false;
+                std::tie(_rev_lb, _rev_rb) = index->rev_fm.lookup_table.interval(len, hashes->second);
+                std::tie(new_parent_lb, new_parent_rb) = table.interval(len - 1, hashes->first / table.sigma());
+                c = hashes->first % table.sigma() + 1;
+            }
+        }
+
+        for (; it != last; ++len, ++it)
         {
             c = to_rank(static_cast<index_char_type>(*it)) + 1;
 
@@ -547,6 +603,9 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the cursor points to the root and the index has been constructed with a k-mer lookup table (see
+     * seqan3::fm_index_construction_options::kmer_lookup_length), the last k characters are looked up at once.
+     *
      * Example:
      *
      * \include test/snippet/search/bi_fm_index_cursor_extend_left_seq.cpp
@@ -582,7 +641,25 @@ public:
         sdsl_char_type c = _last_char;
         size_t len{0};
 
-        for (auto it = first; it != last; ++len, ++it)
+        auto it = first;
+
+        // the first characters of a search from the root are looked up at once (in the order they are searched)
+        if (depth == 0)
+        {
+            auto const & table = index->rev_fm.lookup_table;
+            if (auto const hashes = table.template kmer_hash<index_char_type>(it, last))
+            {
+                len = table.kmer_length();
+                std::tie(_rev_lb, _rev_rb) = table.interval(len, hashes->first);
+                if (_rev_lb > _rev_rb)
+                    return false;
+                std::tie(_fwd_lb, _fwd_rb) = index->fwd_fm.lookup_table.interval(len, hashes->second);
+                std::tie(new_parent_lb, new_parent_rb) = table.interval(len - 1, hashes->first / table.sigma());
+                c = hashes->first % table.sigma() + 1;
+            }
+        }
+
+        for (; it != last; ++len, ++it)
         {
             c = to_rank(static_cast<index_char_type>(*it)) + 1;
 
@@ -912,6 +989,61 @@ public:
         return 1 + fwd_rb - fwd_lb;
     }
 
+    /*!\brief Lists the texts of the collection the searched query occurs in.
+     * \returns The positions of the texts in the collection in ascending order.
+     *
+     * \details
+     *
+     * In contrast to locating all occurrences, only the texts are reported, e.g. to answer which genomes of a
+     * collection contain a k-mer.
+     *
+     * ### Complexity
+     *
+     * \f$O(d \cdot \log_2 D)\f$ for d reported texts out of D texts in the collection if the index stores a document
+     * array (see seqan3::fm_index_construction_options::document_listing),
+     * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$ otherwise.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    std::vector<size_type> documents() const
+    //!\cond
+        requires index_t::text_layout_mode == text_layout::collection
+    //!\endcond
+    {
+        assert(index != nullptr);
+
+        std::vector<size_type> texts;
+        for (auto const & text_count : index->fwd_fm.document_counts(fwd_lb, fwd_rb, depth))
+            texts.push_back(text_count.first);
+        return texts;
+    }
+
+    /*!\brief Counts the occurrences of the searched query per text of the collection.
+     * \returns The positions of the texts in the collection the query occurs in, in ascending order, each paired with
+     *          the number of occurrences in the text.
+     *
+     * ### Complexity
+     *
+     * \f$O(d \cdot \log_2 D)\f$ for d reported texts out of D texts in the collection if the index stores a document
+     * array (see seqan3::fm_index_construction_options::document_listing),
+     * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$ otherwise.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    std::vector<std::pair<size_type, size_type>> document_counts() const
+    //!\cond
+        requires index_t::text_layout_mode == text_layout::collection
+    //!\endcond
+    {
+        assert(index != nullptr);
+
+        return index->fwd_fm.document_counts(fwd_lb, fwd_rb, depth);
+    }
+
     /*!\brief Locates the occurrences of the searched query in the text.
      * \returns Positions in the text.
      *
@@ -931,9 +1063,10 @@ public:
         assert(index != nullptr);
 
         std::vector<size_type> occ(count());
+        detail::suffix_array_interval(index->fwd_fm.index, fwd_lb, depth, occ);
         for (size_type i = 0; i < occ.size(); ++i)
         {
-            occ[i] = offset() - index->fwd_fm.index[fwd_lb + i];
+            occ[i] = offset() - occ[i];
         }
         return occ;
     }
@@ -946,11 +1079,14 @@ public:
     {
         assert(index != nullptr);
 
+        std::vector<size_type> sa(count());
+        detail::suffix_array_interval(index->fwd_fm.index, fwd_lb, depth, sa);
+
         std::vector<std::pair<size_type, size_type>> occ;
         occ.reserve(count());
         for (size_type i = 0; i < count(); ++i)
         {
-            size_type loc = offset() - index->fwd_fm.index[fwd_lb + i];
+            size_type loc = offset() - sa[i];
             size_type sequence_rank = index->fwd_fm.text_begin_rs.rank(loc + 1);
             size_type sequence_position = loc - index->fwd_fm.text_begin_ss.select(sequence_rank);
             occ.emplace_back(sequence_rank - 1, sequence_position);
@@ -1005,6 +1141,84 @@ public:
                });
     }
 
+    /*!\brief Locates the occurrences of several cursors together.
+     * \tparam cursors_t The type of the cursors; must model std::ranges::forward_range over this cursor type.
+     * \param[in] cursors The cursors; all of them must belong to the same index.
+     * \returns For each cursor, the positions in the text as returned by its locate().
+     *
+     * \details
+     *
+     * Locating an occurrence walks the LF mapping of the index until a sampled suffix array entry is reached. Instead
+     * of resolving the occurrences one after another, the walks of all occurrences of all cursors are advanced in
+     * lock-step (see seqan3::detail::suffix_array_entries), which overlaps their random memory accesses. This pays off
+     * for queries with many occurrences and for many cursors at once, e.g. the seeds of a read.
+     *
+     * ### Complexity
+     *
+     * \f$\sum count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    template <std::ranges::forward_range cursors_t>
+    //!\cond
+        requires std::same_as<remove_cvref_t<std::ranges::range_reference_t<cursors_t>>, bi_fm_index_cursor>
+    //!\endcond
+    static auto locate(cursors_t && cursors)
+    {
+        using occurrences_type = decltype(std::declval<bi_fm_index_cursor const &>().locate());
+        std::vector<occurrences_type> occurrences;
+
+        if (std::ranges::empty(cursors))
+            return occurrences;
+
+        index_type const * const index = (*std::ranges::begin(cursors)).index;
+        auto const & csa = index->fwd_fm.index;
+
+        // an index that computes suffix array intervals directly (e.g. the r-index) locates each cursor on its own
+        if constexpr (detail::suffix_array_interval_index<remove_cvref_t<decltype(csa)>>)
+        {
+            for (auto const & cursor : cursors)
+                occurrences.push_back(cursor.locate());
+            return occurrences;
+        }
+        else
+        {
+            std::vector<size_type> sa;
+            for (auto const & cursor : cursors)
+            {
+                assert(cursor.index == index);
+                for (size_type i = 0; i < cursor.count(); ++i)
+                    sa.push_back(cursor.fwd_lb + i);
+            }
+
+            detail::suffix_array_entries(csa, sa);
+
+            auto sa_it = sa.begin();
+            for (auto const & cursor : cursors)
+            {
+                occurrences_type & occ = occurrences.emplace_back();
+                occ.reserve(cursor.count());
+                for (size_type i = 0; i < cursor.count(); ++i, ++sa_it)
+                {
+                    size_type const loc = cursor.offset() - *sa_it;
+                    if constexpr (index_t::text_layout_mode == text_layout::single)
+                    {
+                        occ.push_back(loc);
+                    }
+                    else
+                    {
+                        size_type const sequence_rank = index->fwd_fm.text_begin_rs.rank(loc + 1);
+                        size_type const sequence_position = loc - index->fwd_fm.text_begin_ss.select(sequence_rank);
+                        occ.emplace_back(sequence_rank - 1, sequence_position);
+                    }
+                }
+            }
+            return occurrences;
+        }
+    }
+
 };
 
 //!\}
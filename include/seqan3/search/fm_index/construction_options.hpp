@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fm_index_construction_options.
+ */
+
+#pragma once
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+//!\brief The algorithms available to construct a seqan3::fm_index or seqan3::bi_fm_index.
+enum class fm_index_construction : uint8_t
+{
+    //!\brief All intermediate data structures (suffix array, BWT, ...) are kept in main memory.
+    in_memory,
+    /*!\brief Intermediate data structures are written to and streamed from
+     *        seqan3::fm_index_construction_options::tmp_directory. Only the text and the final index are held in
+     *        main memory, unless seqan3::fm_index_construction_options::ram_budget allows to build the suffix array
+     *        in memory.
+     */
+    semi_external
+};
+
+/*!\brief The options type defines various option members that influence the construction of FM indices.
+ *
+ * \details
+ *
+ * By default an index is built in memory on a single thread. For large texts, e.g. collections of many genomes,
+ * the peak memory consumption of the in-memory construction (about 9 bytes per character for the suffix array alone)
+ * can be avoided by the semi-external construction:
+ *
+ * \include test/snippet/search/fm_index_construction_options.cpp
+ */
+struct fm_index_construction_options
+{
+    //!\brief The construction algorithm.
+    fm_index_construction construction = fm_index_construction::in_memory;
+
+    /*!\brief The directory used for intermediate files of the semi-external construction.
+     *
+     * \details
+     *
+     * If empty, `std::filesystem::temp_directory_path()` is used when the index is constructed.
+     */
+    std::filesystem::path tmp_directory{};
+
+    /*!\brief The amount of main memory in bytes the semi-external construction may use for the suffix array.
+     *
+     * \details
+     *
+     * If the budget suffices to build the suffix array in memory (about 9 bytes per character), the faster in-memory
+     * algorithm is used. Otherwise, in particular for the default budget of 0, the semi-external SA-IS algorithm is
+     * used that only keeps the text and a small buffer in memory. The in-memory construction ignores this option.
+     */
+    size_t ram_budget = 0;
+
+    /*!\brief The number of threads used for the construction.
+     *
+     * \details
+     *
+     * If this is at least 2, the in-memory construction sorts the suffixes in parallel by prefix doubling instead of
+     * using the sequential algorithm of the SDSL. Besides the text, it needs 16 bytes per character for texts shorter
+     * than 2^32 characters and 32 bytes per character otherwise. The seqan3::bi_fm_index builds the indices of the
+     * original and the reversed text concurrently, each on half of the threads. The semi-external construction of the
+     * suffix array is sequential.
+     */
+    uint32_t thread_count = 1;
+
+    /*!\brief The length k of the strings whose suffix array intervals are precomputed; 0 disables the lookup table.
+     *
+     * \details
+     *
+     * The first k steps of a search starting at the root of the index are the slowest ones, because the rank queries
+     * access distant parts of the index. A lookup table of the intervals of all strings up to length k replaces them
+     * by a single access. The table stores \f$2 \cdot \sum_{i=0}^{k} \sigma^i\f$ positions, e.g. about 22 MB for k = 10
+     * over seqan3::dna4.
+     */
+    uint8_t kmer_lookup_length = 0;
+
+    /*!\brief Whether to store the text of each suffix array entry of a text collection (the document array).
+     *
+     * \details
+     *
+     * The document array allows a cursor to list the texts a query occurs in, together with the number of occurrences
+     * per text, in time proportional to the number of texts instead of the number of occurrences (see
+     * seqan3::fm_index_cursor::document_counts). It takes \f$n \log_2 d\f$ bits for a collection of d texts of total
+     * length n. The option has no effect on indices over a single text.
+     *
+     * \include test/snippet/search/fm_index_document_listing.cpp
+     */
+    bool document_listing = false;
+};
+
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,520 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::epr_occurrence_table and seqan3::detail::epr_index.
+ */
+
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <sdsl/config.hpp>
+#include <sdsl/int_vector.hpp>
+#include <sdsl/int_vector_buffer.hpp>
+#include <sdsl/io.hpp>
+#include <sdsl/sdsl_concepts.hpp>
+
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
+#include <seqan3/search/fm_index/detail/suffix_array_batch.hpp>
+#include <seqan3/std/concepts>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/array.hpp>
+#include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief An interleaved occurrence table over the BWT of a small alphabet (EPR dictionary).
+ * \tparam sigma_ The number of different characters in the BWT without the sentinel.
+ *
+ * \details
+ *
+ * The BWT is divided into blocks of 64 characters. Each block stores the occurrence counts of all characters up to
+ * the beginning of the block next to the characters of the block, which are stored as
+ * \f$\lceil\log_2(\sigma)\rceil\f$ bit planes of 64 bit each. A rank query thus touches a single block: the matching
+ * positions within the block are computed by combining the bit planes and counted with a single popcount.
+ * The counts of the blocks are 32 bit values relative to superblocks of \f$2^{32}\f$ characters.
+ *
+ * The sentinel is not part of the bit planes, it is encoded as the smallest character and its position is stored
+ * separately. Character \f$c > 0\f$ of the BWT is encoded as \f$c - 1\f$.
+ *
+ * The interface models the parts of an SDSL wavelet tree that are used by the FM index cursors, i.e. `rank`,
+ * `lex_count` and random access.
+ */
+template <uint8_t sigma_>
+class epr_occurrence_table
+{
+    static_assert(sigma_ > 0 && sigma_ <= 64, "The EPR occurrence table only supports alphabets of up to 64 symbols.");
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Type for representing positions in the BWT.
+    using size_type = uint64_t;
+    //!\brief The character type of the BWT.
+    using value_type = uint8_t;
+    //!\}
+
+    //!\brief The number of different characters without the sentinel.
+    static constexpr uint8_t sigma = sigma_;
+    //!\brief The number of bits needed to encode a character.
+    static constexpr uint8_t bits_per_char = sigma_ == 1 ? 1 : most_significant_bit_set(uint8_t(sigma_ - 1)) + 1;
+    //!\brief The number of characters stored in one block.
+    static constexpr size_type block_size = 64;
+    //!\brief The number of characters covered by one superblock.
+    static constexpr size_type superblock_size = size_type{1} << 32;
+
+private:
+    //!\brief A block of 64 characters and the occurrence counts preceding it within its superblock.
+    struct block_type
+    {
+        //!\brief Occurrences of each character from the beginning of the superblock to the beginning of the block.
+        std::array<uint32_t, sigma_> counts{};
+        //!\brief Bit `i` of plane `p` is bit `p` of the code of the `i`-th character of the block.
+        std::array<uint64_t, bits_per_char> planes{};
+
+        //!\brief Returns `true` if both blocks are equal.
+        bool operator==(block_type const & rhs) const noexcept
+        {
+            return counts == rhs.counts && planes == rhs.planes;
+        }
+
+        //!\cond
+        template <cereal_archive archive_t>
+        void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+        {
+            archive(counts, planes);
+        }
+        //!\endcond
+    };
+
+    //!\brief The blocks.
+    std::vector<block_type> blocks{};
+    //!\brief Occurrences of each character before the beginning of each superblock.
+    std::vector<std::array<size_type, sigma_>> superblocks{};
+    //!\brief The length of the BWT including the sentinel.
+    size_type bwt_size{0};
+    //!\brief The position of the sentinel in the BWT.
+    size_type sentinel_position{0};
+
+    //!\brief Returns a bit mask of all positions in `b` holding the character encoded as `code`.
+    static uint64_t match(block_type const & b, uint8_t const code) noexcept
+    {
+        uint64_t mask = ~uint64_t{0};
+        for (uint8_t p = 0; p < bits_per_char; ++p)
+            mask &= ((code >> p) & 1u) ? b.planes[p] : ~b.planes[p];
+        return mask;
+    }
+
+    /*!\brief Returns the number of occurrences of `c` in `[0, i)` and the number of characters smaller than `c` in
+     *        `[0, i)`.
+     */
+    std::pair<size_type, size_type> rank_and_smaller(size_type const i, value_type const c) const noexcept
+    {
+        assert(i <= bwt_size);
+        assert(c <= sigma);
+
+        size_type const sentinel = i > sentinel_position;
+
+        if (c == 0)
+            return {sentinel, 0};
+
+        block_type const & b = blocks[i / block_size];
+        std::array<size_type, sigma_> const & sb = superblocks[i / superblock_size];
+        uint64_t const prefix = (uint64_t{1} << (i % block_size)) - 1;
+        uint8_t const code = c - 1;
+
+        // The sentinel is encoded as code 0 and is therefore part of the count of code 0.
+        size_type smaller = code == 0 ? sentinel : 0;
+        for (uint8_t k = 0; k < code; ++k)
+            smaller += sb[k] + b.counts[k] + popcount(match(b, k) & prefix);
+
+        size_type const rank = sb[code] + b.counts[code] + popcount(match(b, code) & prefix) -
+                               (code == 0 ? sentinel : 0);
+
+        return {rank, smaller};
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    epr_occurrence_table() = default;                                         //!< Defaulted.
+    epr_occurrence_table(epr_occurrence_table const &) = default;             //!< Defaulted.
+    epr_occurrence_table(epr_occurrence_table &&) = default;                  //!< Defaulted.
+    epr_occurrence_table & operator=(epr_occurrence_table const &) = default; //!< Defaulted.
+    epr_occurrence_table & operator=(epr_occurrence_table &&) = default;      //!< Defaulted.
+    ~epr_occurrence_table() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructs the table from the BWT.
+     * \tparam bwt_t The type of the BWT; must provide `size()` and random access to the characters, e.g.
+     *               sdsl::int_vector_buffer<8>.
+     * \param[in] bwt The BWT; the sentinel (character 0) must occur exactly once.
+     * \throws std::invalid_argument if the BWT contains more than `sigma` different characters besides the sentinel.
+     */
+    template <typename bwt_t>
+    //!\cond
+        requires (!std::same_as<remove_cvref_t<bwt_t>, epr_occurrence_table>)
+    //!\endcond
+    explicit epr_occurrence_table(bwt_t & bwt) :
+        blocks(bwt.size() / block_size + 1),
+        superblocks(bwt.size() / superblock_size + 1),
+        bwt_size{bwt.size()}
+    {
+        std::array<size_type, sigma_> total{};
+
+        for (size_type i = 0; i <= bwt_size; ++i)
+        {
+            if (i % superblock_size == 0)
+                superblocks[i / superblock_size] = total;
+
+            if (i % block_size == 0)
+            {
+                std::array<size_type, sigma_> const & sb = superblocks[i / superblock_size];
+                for (uint8_t k = 0; k < sigma; ++k)
+                    blocks[i / block_size].counts[k] = static_cast<uint32_t>(total[k] - sb[k]);
+            }
+
+            if (i == bwt_size)
+                break;
+
+            value_type const c = bwt[i];
+
+            if (c > sigma)
+                throw std::invalid_argument{"The text contains more than " + std::to_string(sigma) +
+                                            " different characters."};
+
+            if (c == 0)
+                sentinel_position = i;
+
+            uint8_t const code = c == 0 ? 0 : c - 1;
+            block_type & b = blocks[i / block_size];
+            for (uint8_t p = 0; p < bits_per_char; ++p)
+                b.planes[p] |= static_cast<uint64_t>((code >> p) & 1u) << (i % block_size);
+
+            ++total[code];
+        }
+    }
+    //!\}
+
+    //!\brief Returns the length of the BWT including the sentinel.
+    size_type size() const noexcept
+    {
+        return bwt_size;
+    }
+
+    //!\brief Returns the character at position `i` of the BWT.
+    value_type operator[](size_type const i) const noexcept
+    {
+        assert(i < bwt_size);
+
+        if (i == sentinel_position)
+            return 0;
+
+        block_type const & b = blocks[i / block_size];
+        uint8_t code = 0;
+        for (uint8_t p = 0; p < bits_per_char; ++p)
+            code |= ((b.planes[p] >> (i % block_size)) & 1u) << p;
+
+        return code + 1;
+    }
+
+    /*!\brief Prefetches the block needed by a rank query at position `i` into the cache.
+     *
+     * \details
+     *
+     * Issuing the prefetches for the rank queries of many independent searches before performing them hides the
+     * memory latency, see seqan3::detail::search_batch_exact.
+     */
+    void prefetch(size_type const i) const noexcept
+    {
+        assert(i <= bwt_size);
+        __builtin_prefetch(blocks.data() + i / block_size);
+    }
+
+    //!\brief Returns the number of occurrences of `c` in the BWT interval `[0, i)`.
+    size_type rank(size_type const i, value_type const c) const noexcept
+    {
+        return rank_and_smaller(i, c).first;
+    }
+
+    /*!\brief Returns the number of occurrences of `c` in `[0, i)` and the number of characters smaller and greater
+     *        than `c` in `[i, j)`.
+     *
+     * \details
+     *
+     * This is the same interface as `sdsl::wt_pc::lex_count` and used for bidirectional search.
+     */
+    std::tuple<size_type, size_type, size_type> lex_count(size_type const i,
+                                                          size_type const j,
+                                                          value_type const c) const noexcept
+    {
+        assert(i <= j);
+
+        auto const [rank_i, smaller_i] = rank_and_smaller(i, c);
+        auto const [rank_j, smaller_j] = rank_and_smaller(j, c);
+        size_type const smaller = smaller_j - smaller_i;
+
+        return {rank_i, smaller, (j - i) - smaller - (rank_j - rank_i)};
+    }
+
+    //!\brief Returns `true` if both tables are equal.
+    bool operator==(epr_occurrence_table const & rhs) const noexcept
+    {
+        return bwt_size == rhs.bwt_size && sentinel_position == rhs.sentinel_position &&
+               superblocks == rhs.superblocks && blocks == rhs.blocks;
+    }
+
+    //!\brief Returns `true` if the tables are unequal.
+    bool operator!=(epr_occurrence_table const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(blocks, superblocks, bwt_size, sentinel_position);
+    }
+    //!\endcond
+};
+
+/*!\brief A compressed suffix array using an seqan3::detail::epr_occurrence_table as rank data structure.
+ * \tparam sigma_           The number of different characters in the text without the sentinel.
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th entry of the suffix array (in suffix order) is sampled.
+ *
+ * \details
+ *
+ * This type models seqan3::detail::sdsl_index and can be used as underlying index of a seqan3::fm_index or a
+ * seqan3::bi_fm_index. It is built by the SDSL construction (sdsl::construct and sdsl::construct_im) like any
+ * other SDSL compressed suffix array. The occurrence table is exposed as `bwt` and `wavelet_tree` such that the
+ * cursors can use it without modification. Use seqan3::sdsl_epr_index_type to obtain a suitable type for an
+ * alphabet.
+ */
+template <uint8_t sigma_, uint32_t sa_sampling_rate = 16>
+class epr_index
+{
+    static_assert(sa_sampling_rate > 0, "The sampling rate must be positive.");
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the occurrence table.
+    using occurrence_table_type = epr_occurrence_table<sigma_>;
+    //!\brief The alphabet strategy. The characters are not mapped.
+    using alphabet_type = sdsl::plain_byte_alphabet;
+    //!\brief Type for representing positions in the text.
+    using size_type = typename occurrence_table_type::size_type;
+    //!\brief The character type.
+    using char_type = typename alphabet_type::char_type;
+    //!\brief The character type after the mapping of the alphabet strategy.
+    using comp_char_type = typename alphabet_type::comp_char_type;
+    //!\brief The SDSL alphabet category, used by the SDSL construction.
+    using alphabet_category = typename alphabet_type::alphabet_category;
+    //!\brief The SDSL index category, used by the SDSL construction.
+    using index_category = sdsl::csa_tag;
+    //!\}
+
+    //!\brief The sampling rate of the suffix array.
+    static constexpr uint32_t sa_sample_dens = sa_sampling_rate;
+
+private:
+    //!\brief The occurrence table over the BWT.
+    occurrence_table_type m_occ{};
+    //!\brief Stores the cumulative character counts.
+    alphabet_type m_alphabet{};
+    //!\brief The sampled suffix array.
+    sdsl::int_vector<> m_sa_samples{};
+
+public:
+    //!\brief Maps a character to its rank in the BWT (identity).
+    typename alphabet_type::char2comp_type const & char2comp;
+    //!\brief Maps a rank in the BWT to its character (identity).
+    typename alphabet_type::comp2char_type const & comp2char;
+    //!\brief Cumulative character counts.
+    typename alphabet_type::C_type const & C;
+    //!\brief The largest character of the text plus one.
+    typename alphabet_type::sigma_type const & sigma;
+    //!\brief The BWT (provides `rank` and random access).
+    occurrence_table_type const & bwt;
+    //!\brief The BWT (provides `lex_count`); an alias for `bwt`.
+    occurrence_table_type const & wavelet_tree;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Default constructor.
+    epr_index() :
+        char2comp{m_alphabet.char2comp}, comp2char{m_alphabet.comp2char}, C{m_alphabet.C}, sigma{m_alphabet.sigma},
+        bwt{m_occ}, wavelet_tree{m_occ}
+    {}
+
+    //!\brief Copy constructor; rebinds the public references.
+    epr_index(epr_index const & rhs) :
+        m_occ{rhs.m_occ}, m_alphabet{rhs.m_alphabet}, m_sa_samples{rhs.m_sa_samples},
+        char2comp{m_alphabet.char2comp}, comp2char{m_alphabet.comp2char}, C{m_alphabet.C}, sigma{m_alphabet.sigma},
+        bwt{m_occ}, wavelet_tree{m_occ}
+    {}
+
+    //!\brief Move constructor; rebinds the public references.
+    epr_index(epr_index && rhs) :
+        m_occ{std::move(rhs.m_occ)}, m_alphabet{std::move(rhs.m_alphabet)}, m_sa_samples{std::move(rhs.m_sa_samples)},
+        char2comp{m_alphabet.char2comp}, comp2char{m_alphabet.comp2char}, C{m_alphabet.C}, sigma{m_alphabet.sigma},
+        bwt{m_occ}, wavelet_tree{m_occ}
+    {}
+
+    //!\brief Copy and move assignment.
+    epr_index & operator=(epr_index rhs)
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    ~epr_index() = default; //!< Defaulted.
+
+    /*!\brief Constructs the index from the BWT and the suffix array in the SDSL cache.
+     * \param[in] config The SDSL cache configuration holding the BWT and the suffix array.
+     * \throws std::invalid_argument if the text contains more than `sigma_` different characters.
+     *
+     * \details
+     *
+     * This constructor is called by the SDSL construction, you should never need to call it directly.
+     */
+    explicit epr_index(sdsl::cache_config & config) : epr_index{}
+    {
+        {
+            sdsl::int_vector_buffer<8> bwt_buf(sdsl::cache_file_name(sdsl::conf::KEY_BWT, config));
+            m_alphabet = alphabet_type{bwt_buf, bwt_buf.size()};
+            m_occ = occurrence_table_type{bwt_buf};
+        }
+
+        sdsl::int_vector_buffer<> sa_buf(sdsl::cache_file_name(sdsl::conf::KEY_SA, config));
+        size_type const n = sa_buf.size();
+        m_sa_samples = sdsl::int_vector<>((n + sa_sample_dens - 1) / sa_sample_dens, 0, sdsl::bits::hi(n) + 1);
+
+        for (size_type i = 0; i < n; i += sa_sample_dens)
+            m_sa_samples[i / sa_sample_dens] = sa_buf[i];
+    }
+    //!\}
+
+    //!\brief Returns the length of the text including the sentinel.
+    size_type size() const noexcept
+    {
+        return m_occ.size();
+    }
+
+    //!\brief Returns `true` if the index is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the suffix array entry at position `i`.
+     *
+     * \details
+     *
+     * Walks the LF mapping until a sampled position is reached, i.e. at most `sa_sampling_rate - 1` steps on average.
+     */
+    size_type operator[](size_type i) const noexcept
+    {
+        assert(i < size());
+
+        size_type steps = 0;
+        while (i % sa_sample_dens != 0)
+        {
+            char_type const c = m_occ[i];
+            i = C[c] + m_occ.rank(i, c);
+            ++steps;
+        }
+
+        return (m_sa_samples[i / sa_sample_dens] + steps) % size();
+    }
+
+    /*!\brief Replaces suffix array positions by their suffix array entries.
+     * \param[in,out] positions The suffix array positions.
+     *
+     * \details
+     *
+     * Walks the LF mapping of many positions in lock-step and prefetches the blocks of the occurrence table needed
+     * for the next step of all walks before taking it, see seqan3::detail::suffix_array_lf_batch.
+     */
+    void suffix_array_entries(std::vector<size_type> & positions) const
+    {
+        suffix_array_lf_batch(positions, size(),
+                              [] (size_type const i) { return i % sa_sample_dens == 0; },
+                              [this] (size_type const i) { m_occ.prefetch(i); },
+                              [this] (size_type const i)
+                              {
+                                  char_type const c = m_occ[i];
+                                  return C[c] + m_occ.rank(i, c);
+                              },
+                              [this] (size_type const i) -> size_type { return m_sa_samples[i / sa_sample_dens]; });
+    }
+
+    //!\brief Swaps the content with another index.
+    void swap(epr_index & rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            std::swap(m_occ, rhs.m_occ);
+            std::swap(m_alphabet, rhs.m_alphabet);
+            m_sa_samples.swap(rhs.m_sa_samples);
+        }
+    }
+
+    //!\brief Returns `true` if both indices are equal.
+    bool operator==(epr_index const & rhs) const noexcept
+    {
+        return m_occ == rhs.m_occ && m_alphabet == rhs.m_alphabet && m_sa_samples == rhs.m_sa_samples;
+    }
+
+    //!\brief Returns `true` if the indices are unequal.
+    bool operator!=(epr_index const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(m_occ, m_alphabet, m_sa_samples);
+    }
+    //!\endcond
+};
+
+//!\}
+
+} // namespace seqan3::detail
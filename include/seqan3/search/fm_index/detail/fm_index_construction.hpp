@@ -0,0 +1,343 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the construction of the underlying SDSL indices of the FM indices.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sdsl/construct.hpp>
+
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/search/fm_index/construction_options.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+//!\brief Number of bytes per character needed to build a 64 bit suffix array with libdivsufsort (SA + text).
+inline constexpr size_t in_memory_sa_bytes_per_char = 9;
+
+/*!\brief Returns an identifier that is unique within this process.
+ *
+ * \details
+ *
+ * The SDSL names its intermediate files after the given id. Indices that are constructed concurrently (e.g. the two
+ * indices of a seqan3::bi_fm_index) must therefore not share an id.
+ */
+inline std::string unique_construction_id()
+{
+    static std::atomic<uint64_t> counter{0};
+    return "seqan3_fm_" + std::to_string(sdsl::util::pid()) + "_" + std::to_string(counter++);
+}
+
+/*!\brief Guards the global suffix array algorithm of the SDSL during a construction.
+ *
+ * \details
+ *
+ * `sdsl::construct_config::byte_algo_sa` is a process-wide setting that is read while the suffix array is built.
+ * Constructions that use the same algorithm run concurrently; a construction that needs a different one waits until
+ * all running constructions have finished.
+ */
+class sdsl_sa_algorithm_guard
+{
+public:
+    //!\brief Waits until `algo` can be set and sets it.
+    explicit sdsl_sa_algorithm_guard(sdsl::byte_sa_algo_type const algo)
+    {
+        std::unique_lock lock{state().mutex};
+        state().released.wait(lock, [&] () { return state().active == 0 || state().algo == algo; });
+
+        if (state().active++ == 0)
+        {
+            state().algo = algo;
+            sdsl::construct_config::byte_algo_sa = algo;
+        }
+    }
+
+    sdsl_sa_algorithm_guard(sdsl_sa_algorithm_guard const &) = delete;
+    sdsl_sa_algorithm_guard & operator=(sdsl_sa_algorithm_guard const &) = delete;
+
+    //!\brief Releases the algorithm for other constructions.
+    ~sdsl_sa_algorithm_guard()
+    {
+        {
+            std::lock_guard lock{state().mutex};
+            --state().active;
+        }
+        state().released.notify_all();
+    }
+
+private:
+    //!\brief The state shared by all guards.
+    struct shared_state
+    {
+        //!\brief Protects all members.
+        std::mutex mutex;
+        //!\brief Signalled when a construction has finished.
+        std::condition_variable released;
+        //!\brief The algorithm of the running constructions.
+        sdsl::byte_sa_algo_type algo{sdsl::LIBDIVSUFSORT};
+        //!\brief The number of running constructions.
+        size_t active{0};
+    };
+
+    //!\brief Returns the state shared by all guards.
+    static shared_state & state()
+    {
+        static shared_state s;
+        return s;
+    }
+};
+
+/*!\brief Sorts `values` on `thread_count` threads.
+ * \param[in,out] values       The values to sort.
+ * \param[in,out] buffer       A buffer of the same size as `values`; its content is overwritten.
+ * \param[in]     compare      The strict weak ordering of the values.
+ * \param[in]     thread_count The number of threads; at least 1.
+ *
+ * \details
+ *
+ * Each thread sorts a contiguous part of the values, then the sorted parts are merged pairwise, with all merges of a
+ * round running concurrently.
+ */
+template <typename value_t, typename compare_t>
+inline void parallel_sort(std::vector<value_t> & values,
+                          std::vector<value_t> & buffer,
+                          compare_t const & compare,
+                          uint32_t const thread_count)
+{
+    size_t const part_count = std::clamp<size_t>(thread_count, 1, std::max<size_t>(values.size(), 1));
+
+    std::vector<size_t> part_begin(part_count + 1);
+    for (size_t part = 0; part <= part_count; ++part)
+        part_begin[part] = values.size() * part / part_count;
+
+    auto run_parallel = [] (size_t const task_count, auto && task)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(task_count - 1);
+
+        for (size_t task_id = 1; task_id < task_count; ++task_id)
+            threads.emplace_back(task, task_id);
+
+        task(0u);
+
+        for (auto & thread : threads)
+            thread.join();
+    };
+
+    run_parallel(part_count, [&] (size_t const part)
+    {
+        std::sort(values.begin() + part_begin[part], values.begin() + part_begin[part + 1], compare);
+    });
+
+    // merges the sorted runs of `width` parts into runs of 2 * `width` parts
+    for (size_t width = 1; width < part_count; width *= 2)
+    {
+        run_parallel((part_count + 2 * width - 1) / (2 * width), [&] (size_t const merge)
+        {
+            size_t const first = part_begin[2 * width * merge];
+            size_t const middle = part_begin[std::min(2 * width * merge + width, part_count)];
+            size_t const last = part_begin[std::min(2 * width * merge + 2 * width, part_count)];
+
+            std::merge(values.begin() + first, values.begin() + middle,
+                       values.begin() + middle, values.begin() + last,
+                       buffer.begin() + first, compare);
+        });
+
+        std::swap(values, buffer);
+    }
+}
+
+/*!\brief Builds the suffix array of `text` and an appended sentinel by prefix doubling on several threads.
+ * \tparam size_type An unsigned integer type that can store the length of the text plus one.
+ * \param[in] text         The text in SDSL representation; must not contain 0.
+ * \param[in] thread_count The number of threads; at least 1.
+ * \returns The suffix array of `text` and the sentinel 0, as it is built by the SDSL.
+ *
+ * \details
+ *
+ * In each round, the suffixes are sorted by the ranks of their prefixes of length h and 2h, which doubles the length of
+ * the sorted prefixes, until all ranks are distinct. The sorting is done by seqan3::detail::parallel_sort; the ranks
+ * are assigned sequentially. Besides the text, the construction needs 4 arrays of `size_type` per character.
+ */
+template <typename size_type>
+inline sdsl::int_vector<> parallel_suffix_array(sdsl::int_vector<8> const & text, uint32_t const thread_count)
+{
+    size_t const size = text.size() + 1;
+
+    std::vector<size_type> suffix_array(size);
+    std::vector<size_type> rank(size);
+    std::vector<size_type> buffer(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        suffix_array[i] = i;
+        rank[i] = (i + 1 < size) ? text[i] : 0;
+    }
+
+    for (size_t h = 1; ; h *= 2)
+    {
+        // the suffixes that are shorter than h + 1 are sorted already, because they contain the unique sentinel
+        auto key = [&] (size_type const i)
+        {
+            return std::pair<size_type, size_type>{rank[i], (i + h < size) ? rank[i + h] + 1 : 0};
+        };
+
+        parallel_sort(suffix_array, buffer, [&] (size_type const lhs, size_type const rhs)
+        {
+            return key(lhs) < key(rhs);
+        }, thread_count);
+
+        buffer[suffix_array[0]] = 0;
+        for (size_t i = 1; i < size; ++i)
+            buffer[suffix_array[i]] = buffer[suffix_array[i - 1]] + (key(suffix_array[i - 1]) != key(suffix_array[i]));
+
+        std::swap(rank, buffer);
+
+        if (rank[suffix_array[size - 1]] == size - 1)
+            break;
+    }
+
+    sdsl::int_vector<> result(size, 0, sdsl::bits::hi(size) + 1);
+    std::copy(suffix_array.begin(), suffix_array.end(), result.begin());
+    return result;
+}
+
+/*!\brief Constructs an SDSL index from the (reversed and rank-shifted) text.
+ * \tparam sdsl_index_t The type of the SDSL index; must model seqan3::detail::sdsl_index.
+ * \param[out] index    The index to construct.
+ * \param[in]  text     The text in SDSL representation. Will be emptied by the semi-external construction.
+ * \param[in]  options  The construction options.
+ * \param[in]  visit_suffix_array Invoked with an `sdsl::int_vector_buffer<> &` over the suffix array of the text
+ *                                before the intermediate files are removed (optional).
+ * \throws std::runtime_error if the text could not be written to the temporary directory.
+ * \throws std::filesystem::filesystem_error if no temporary directory is given and the system has none.
+ * \throws Any exception thrown by the constructor of `sdsl_index_t`; intermediate files are removed.
+ *
+ * \details
+ *
+ * The in-memory construction keeps all intermediate files in the SDSL RAM file system. If
+ * seqan3::fm_index_construction_options::thread_count is at least 2, it builds the suffix array by
+ * seqan3::detail::parallel_suffix_array and passes it to the SDSL through the cache.
+ *
+ * The semi-external construction writes the text to seqan3::fm_index_construction_options::tmp_directory (or the
+ * temporary directory of the system if it is empty), releases the in-memory copy and streams all intermediate data
+ * structures from disk. The suffix array is built by the semi-external SA-IS algorithm, unless
+ * seqan3::fm_index_construction_options::ram_budget suffices to build it in memory.
+ *
+ * Data structures that are derived from the full suffix array (e.g. the document array of a text collection) can
+ * stream it via `visit_suffix_array` instead of accessing the sampled suffix array of the constructed index.
+ *
+ * The suffix array algorithm is a global setting of the SDSL. Concurrent constructions that select different
+ * algorithms are serialised by seqan3::detail::sdsl_sa_algorithm_guard.
+ */
+template <typename sdsl_index_t, typename suffix_array_visitor_t = void (*)(sdsl::int_vector_buffer<> &)>
+inline void construct_sdsl_index(sdsl_index_t & index,
+                                 sdsl::int_vector<8> & text,
+                                 fm_index_construction_options const & options,
+                                 suffix_array_visitor_t && visit_suffix_array = nullptr)
+{
+    bool const sa_fits_budget = options.ram_budget >= in_memory_sa_bytes_per_char * (text.size() + 1);
+
+    sdsl::byte_sa_algo_type const sa_algo =
+        (options.construction == fm_index_construction::semi_external && !sa_fits_budget) ? sdsl::SE_SAIS
+                                                                                          : sdsl::LIBDIVSUFSORT;
+
+    sdsl_sa_algorithm_guard const sa_algo_guard{sa_algo};
+
+    std::string const id = unique_construction_id();
+
+    // the intermediate files are kept until the suffix array has been visited
+    auto visit = [&] (sdsl::cache_config & config)
+    {
+        if constexpr (std::is_pointer_v<remove_cvref_t<suffix_array_visitor_t>>)
+        {
+            if (visit_suffix_array == nullptr)
+                return;
+        }
+
+        sdsl::int_vector_buffer<> suffix_array{sdsl::cache_file_name(sdsl::conf::KEY_SA, config)};
+        visit_suffix_array(suffix_array);
+    };
+
+    if (options.construction == fm_index_construction::in_memory)
+    {
+        std::string const file = sdsl::ram_file_name(id);
+        sdsl::store_to_file(text, file);
+        sdsl::cache_config config{false, "@", id};
+        try
+        {
+            // the SDSL skips the construction of the suffix array if it is cached already
+            if (options.thread_count > 1)
+            {
+                sdsl::int_vector<> suffix_array = (text.size() < std::numeric_limits<uint32_t>::max())
+                                                ? parallel_suffix_array<uint32_t>(text, options.thread_count)
+                                                : parallel_suffix_array<uint64_t>(text, options.thread_count);
+                sdsl::store_to_cache(suffix_array, sdsl::conf::KEY_SA, config);
+            }
+
+            sdsl::construct(index, file, config, 0);
+            visit(config);
+        }
+        catch (...)
+        {
+            sdsl::util::delete_all_files(config.file_map);
+            sdsl::ram_fs::remove(file);
+            throw;
+        }
+        sdsl::util::delete_all_files(config.file_map);
+        sdsl::ram_fs::remove(file);
+    }
+    else
+    {
+        std::filesystem::path const tmp_directory = options.tmp_directory.empty() ? std::filesystem::temp_directory_path()
+                                                                                  : options.tmp_directory;
+        std::filesystem::path const file = tmp_directory / (id + ".sdsl");
+        if (!sdsl::store_to_file(text, file.string()))
+            throw std::runtime_error{"Could not write the text to " + file.string() + "."};
+
+        text = sdsl::int_vector<8>{}; // the construction streams the text from disk
+
+        sdsl::cache_config config{false, tmp_directory.string(), id};
+        [[maybe_unused]] std::error_code ec;
+        try
+        {
+            sdsl::construct(index, file.string(), config, 0);
+            visit(config);
+        }
+        catch (...)
+        {
+            sdsl::util::delete_all_files(config.file_map);
+            std::filesystem::remove(file, ec);
+            throw;
+        }
+        sdsl::util::delete_all_files(config.file_map);
+        std::filesystem::remove(file, ec);
+    }
+}
+
+//!\}
+
+} // namespace seqan3::detail
@@ -14,8 +14,12 @@
 
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/search/fm_index/detail/suffix_array_batch.hpp>
+#include <seqan3/std/concepts>
 
 namespace seqan3::detail
 {
@@ -63,6 +67,141 @@ struct fm_index_cursor_node
     }
 };
 
+/*!\interface seqan3::detail::prefetchable_occurrence_table <>
+ * \brief An occurrence table that can prefetch the data needed for a rank query into the cache.
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT prefetchable_occurrence_table = requires (t const & table, typename t::size_type const i)
+{
+    { table.prefetch(i) };
+};
+//!\endcond
+
+/*!\brief Prefetches the data needed for a rank query at position `i` of the BWT of an SDSL index.
+ * \tparam csa_t The type of the SDSL index; must model seqan3::detail::sdsl_index.
+ * \param[in] csa The SDSL index.
+ * \param[in] i   The position of the rank query.
+ *
+ * \details
+ *
+ * Does nothing if the BWT of the index does not model seqan3::detail::prefetchable_occurrence_table. Only the
+ * seqan3::detail::epr_occurrence_table does; the wavelet trees of the SDSL indices (e.g. the default
+ * seqan3::sdsl_wt_index_type) are not prefetched, because the position of a rank query on each level of the tree
+ * depends on the rank on the previous level.
+ */
+template <typename csa_t>
+inline void prefetch_rank(csa_t const & csa, typename csa_t::size_type const i) noexcept
+{
+    if constexpr (prefetchable_occurrence_table<remove_cvref_t<decltype(csa.bwt)>>)
+        csa.bwt.prefetch(i);
+}
+
+/*!\interface seqan3::detail::suffix_array_interval_index <>
+ * \brief An SDSL index that computes the entries of the suffix array interval of a string faster than one at a time.
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT suffix_array_interval_index = requires (t const & csa,
+                                                       typename t::size_type const lb,
+                                                       typename t::size_type const depth,
+                                                       std::vector<typename t::size_type> & sa)
+{
+    { csa.suffix_array_interval(lb, depth, sa) };
+};
+//!\endcond
+
+/*!\interface seqan3::detail::suffix_array_batch_index <>
+ * \brief An SDSL index that computes the suffix array entries of many positions faster than one at a time.
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT suffix_array_batch_index = requires (t const & csa, std::vector<typename t::size_type> & positions)
+{
+    { csa.suffix_array_entries(positions) };
+};
+//!\endcond
+
+/*!\interface seqan3::detail::sdsl_sampled_index <>
+ * \brief An SDSL index that exposes its LF mapping and its suffix array samples (e.g. sdsl::csa_wt).
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT sdsl_sampled_index = requires (t const & csa, typename t::size_type const i)
+{
+    { csa.sa_sample.is_sampled(i) } -> bool;
+    { csa.sa_sample[i] };
+    { csa.lf[i] };
+};
+//!\endcond
+
+/*!\brief Replaces suffix array positions of an SDSL index by their suffix array entries.
+ * \tparam csa_t The type of the SDSL index; must model seqan3::detail::sdsl_index.
+ * \param[in]     csa       The SDSL index.
+ * \param[in,out] positions The suffix array positions.
+ *
+ * \details
+ *
+ * Uses `csa.suffix_array_entries` if the index models seqan3::detail::suffix_array_batch_index (e.g.
+ * seqan3::detail::epr_index) and walks the LF mapping of the positions in lock-step via
+ * seqan3::detail::suffix_array_lf_batch if the index models seqan3::detail::sdsl_sampled_index. Otherwise, each entry
+ * is accessed on its own.
+ */
+template <typename csa_t>
+inline void suffix_array_entries(csa_t const & csa, std::vector<typename csa_t::size_type> & positions)
+{
+    using size_type = typename csa_t::size_type;
+
+    if constexpr (suffix_array_batch_index<csa_t>)
+    {
+        csa.suffix_array_entries(positions);
+    }
+    else if constexpr (sdsl_sampled_index<csa_t>)
+    {
+        suffix_array_lf_batch(positions, static_cast<size_type>(csa.size()),
+                              [&csa] (size_type const i) { return csa.sa_sample.is_sampled(i); },
+                              [] (size_type const) {}, // the levels of a wavelet tree cannot be prefetched in advance
+                              [&csa] (size_type const i) -> size_type { return csa.lf[i]; },
+                              [&csa] (size_type const i) -> size_type { return csa.sa_sample[i]; });
+    }
+    else
+    {
+        for (size_type & position : positions)
+            position = csa[position];
+    }
+}
+
+/*!\brief Stores the suffix array entries at the positions `lb` to `lb + sa.size() - 1` of an SDSL index in `sa`.
+ * \tparam csa_t The type of the SDSL index; must model seqan3::detail::sdsl_index.
+ * \param[in]  csa   The SDSL index.
+ * \param[in]  lb    The first position of the interval.
+ * \param[in]  depth The length of the string whose suffix array interval starts at `lb`, i.e. the query length of
+ *                   the cursor.
+ * \param[out] sa    The entries; its size determines the length of the interval.
+ *
+ * \details
+ *
+ * Uses `csa.suffix_array_interval` if the index models seqan3::detail::suffix_array_interval_index (e.g.
+ * seqan3::detail::r_index) and seqan3::detail::suffix_array_entries otherwise.
+ */
+template <typename csa_t>
+inline void suffix_array_interval(csa_t const & csa,
+                                  typename csa_t::size_type const lb,
+                                  [[maybe_unused]] typename csa_t::size_type const depth,
+                                  std::vector<typename csa_t::size_type> & sa)
+{
+    if constexpr (suffix_array_interval_index<csa_t>)
+    {
+        csa.suffix_array_interval(lb, depth, sa);
+    }
+    else
+    {
+        for (typename csa_t::size_type i = 0; i < sa.size(); ++i)
+            sa[i] = lb + i;
+        suffix_array_entries(csa, sa);
+    }
+}
+
 // std::tuple get_suffix_array_range(fm_index_cursor<index_t> const & it)
 // {
 //     return {node.lb, node.rb};
@@ -0,0 +1,229 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::fm_index_lookup_table.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/platform.hpp>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief Stores the suffix array intervals of all strings up to a fixed length.
+ * \tparam size_type The type of the suffix array positions.
+ *
+ * \details
+ *
+ * The first steps of a search starting at the root of an FM index are the most expensive ones: the suffix array
+ * interval is still large, so the two rank queries of each step access distant parts of the occurrence table. The
+ * lookup table replaces the first `kmer_length()` steps by a single access.
+ *
+ * The k-mers are addressed by their rank-encoded value, i.e. the first character is the most significant digit (as
+ * in seqan3::views::kmer_hash). The table stores the intervals of all strings of length 0 to `kmer_length()` to
+ * also provide the interval of the parent node that a cursor needs for `cycle_back()`. An empty interval is stored as
+ * `lb > rb`.
+ */
+template <typename size_type>
+class fm_index_lookup_table
+{
+private:
+    //!\brief The length of the longest strings in the table.
+    uint8_t kmer_length_{0};
+    //!\brief The size of the alphabet.
+    size_t sigma_{0};
+    //!\brief The left and right bound of each interval, ordered by length and then by rank-encoded value.
+    std::vector<size_type> intervals;
+    //!\brief The position of the first interval of each length (not serialised).
+    std::vector<size_t> level_begin;
+
+    //!\brief Computes level_begin from kmer_length_ and sigma_.
+    void compute_level_begin()
+    {
+        level_begin.resize(kmer_length_ + 1u);
+        for (size_t level = 0, begin = 0, count = 1; level <= kmer_length_; ++level, begin += count, count *= sigma_)
+            level_begin[level] = begin;
+    }
+
+    //!\brief Stores the intervals of all extensions of the node of `parent` recursively.
+    template <typename cursor_t>
+    void fill(cursor_t const & parent, uint8_t const level, size_t const parent_hash)
+    {
+        using char_t = typename cursor_t::index_type::char_type;
+
+        for (size_t rank = 0; rank < sigma_; ++rank)
+        {
+            cursor_t cursor{parent};
+            if (!cursor.extend_right(assign_rank_to(rank, char_t{})))
+                continue;
+
+            size_t const hash = parent_hash * sigma_ + rank;
+            intervals[2 * (level_begin[level] + hash)] = cursor.node.lb;
+            intervals[2 * (level_begin[level] + hash) + 1] = cursor.node.rb;
+
+            if (level < kmer_length_)
+                fill(cursor, level + 1, hash);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fm_index_lookup_table() = default;                                           //!< Defaulted.
+    fm_index_lookup_table(fm_index_lookup_table const &) = default;              //!< Defaulted.
+    fm_index_lookup_table(fm_index_lookup_table &&) = default;                   //!< Defaulted.
+    fm_index_lookup_table & operator=(fm_index_lookup_table const &) = default;  //!< Defaulted.
+    fm_index_lookup_table & operator=(fm_index_lookup_table &&) = default;       //!< Defaulted.
+    ~fm_index_lookup_table() = default;                                          //!< Defaulted.
+    //!\}
+
+    /*!\brief Computes the intervals of all strings up to the given length.
+     * \tparam cursor_t The type of the cursor; must be a seqan3::fm_index_cursor.
+     * \param[in] root        A cursor pointing to the root of the index.
+     * \param[in] kmer_length The length of the longest strings; 0 empties the table.
+     * \throws std::invalid_argument if the table would contain more than \f$2^{32}\f$ k-mers.
+     */
+    template <typename cursor_t>
+    void construct(cursor_t const & root, uint8_t const kmer_length)
+    {
+        sigma_ = alphabet_size<typename cursor_t::index_type::char_type>;
+        kmer_length_ = kmer_length;
+
+        intervals.clear();
+        compute_level_begin();
+
+        if (kmer_length_ == 0)
+            return;
+
+        size_t kmer_count{1};
+        for (uint8_t i = 0; i < kmer_length_; ++i)
+        {
+            kmer_count *= sigma_;
+            if (kmer_count > (1ull << 32))
+            {
+                kmer_length_ = 0;
+                throw std::invalid_argument{"The k-mer lookup table of an FM index cannot contain more than 2^32 "
+                                            "k-mers. Choose a shorter k-mer length."};
+            }
+        }
+
+        // every interval is empty (lb = 1 > 0 = rb) unless the string occurs in the text
+        intervals.resize(2 * (level_begin.back() + kmer_count));
+        for (size_t i = 0; i < intervals.size(); i += 2)
+            intervals[i] = 1;
+
+        intervals[0] = root.node.lb;
+        intervals[1] = root.node.rb;
+        fill(root, 1, 0);
+    }
+
+    //!\brief Returns the length of the longest strings in the table; 0 if there is no table.
+    uint8_t kmer_length() const noexcept
+    {
+        return kmer_length_;
+    }
+
+    //!\brief Returns the size of the alphabet of the strings in the table.
+    size_t sigma() const noexcept
+    {
+        return sigma_;
+    }
+
+    /*!\brief Computes the rank-encoded value of the first kmer_length() characters of a range.
+     * \tparam alphabet_t The alphabet of the index.
+     * \param[in,out] it  Iterator to the first character; advanced by kmer_length() characters on success.
+     * \param[in]     end Sentinel of the range.
+     * \returns The value and the value of the reversed k-mer, or std::nullopt if there is no table or the range
+     *          is shorter than kmer_length().
+     */
+    template <typename alphabet_t, typename iterator_t, typename sentinel_t>
+    std::optional<std::pair<size_t, size_t>> kmer_hash(iterator_t & it, sentinel_t const & end) const
+    {
+        if (kmer_length_ == 0)
+            return std::nullopt;
+
+        size_t hash{0};
+        size_t reverse_hash{0};
+        size_t power{1};
+        iterator_t kmer_it = it;
+
+        for (uint8_t i = 0; i < kmer_length_; ++i, ++kmer_it, power *= sigma_)
+        {
+            if (kmer_it == end)
+                return std::nullopt;
+
+            size_t const rank = seqan3::to_rank(static_cast<alphabet_t>(*kmer_it));
+            hash = hash * sigma_ + rank;
+            reverse_hash += rank * power;
+        }
+
+        it = kmer_it;
+        return std::pair{hash, reverse_hash};
+    }
+
+    /*!\brief Returns the interval of a string.
+     * \param[in] length The length of the string; must not be greater than kmer_length().
+     * \param[in] hash   The rank-encoded value of the string.
+     * \returns The left and right bound of the interval; the interval is empty if the left bound is greater.
+     */
+    std::pair<size_type, size_type> interval(uint8_t const length, size_t const hash) const noexcept
+    {
+        assert(length <= kmer_length_);
+        size_t const i = 2 * (level_begin[length] + hash);
+        return {intervals[i], intervals[i + 1]};
+    }
+
+    //!\brief Compares two lookup tables.
+    bool operator==(fm_index_lookup_table const & rhs) const noexcept
+    {
+        return kmer_length_ == rhs.kmer_length_ && sigma_ == rhs.sigma_ && intervals == rhs.intervals;
+    }
+
+    //!\brief Compares two lookup tables.
+    bool operator!=(fm_index_lookup_table const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(kmer_length_, sigma_, intervals);
+        compute_level_begin();
+    }
+    //!\endcond
+};
+
+//!\}
+
+} // namespace seqan3::detail
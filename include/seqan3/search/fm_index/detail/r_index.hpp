@@ -0,0 +1,605 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::run_length_occurrence_table and seqan3::detail::r_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <sdsl/config.hpp>
+#include <sdsl/int_vector.hpp>
+#include <sdsl/int_vector_buffer.hpp>
+#include <sdsl/io.hpp>
+#include <sdsl/sdsl_concepts.hpp>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
+#include <seqan3/search/fm_index/detail/epr_index.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief An occurrence table over the run-length encoded BWT.
+ * \tparam sigma_ The number of different characters in the BWT without the sentinel.
+ *
+ * \details
+ *
+ * The BWT is stored as its \f$r\f$ maximal runs of equal characters: the start position of each run and the
+ * character of each run (the run head). The run heads are stored in a seqan3::detail::epr_occurrence_table, which
+ * counts the runs of a character preceding a run. For each character, the number of its occurrences in its first k
+ * runs is stored for all k. A rank query finds the run containing the position by binary search and combines the
+ * number of preceding runs of the character with the offset inside the run. The start positions of the runs are also
+ * stored grouped by character, which allows to select the k-th occurrence of a character. The table takes
+ * \f$O(r)\f$ words instead of \f$O(n)\f$ bits, i.e. it is small for highly repetitive texts.
+ *
+ * The interface models the parts of an SDSL wavelet tree that are used by the FM index cursors, i.e. `rank`,
+ * `lex_count` and random access.
+ */
+template <uint8_t sigma_>
+class run_length_occurrence_table
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Type for representing positions in the BWT.
+    using size_type = uint64_t;
+    //!\brief The character type of the BWT.
+    using value_type = uint8_t;
+    //!\}
+
+    //!\brief The number of different characters without the sentinel.
+    static constexpr uint8_t sigma = sigma_;
+
+private:
+    //!\brief The characters of the runs.
+    epr_occurrence_table<sigma_> heads{};
+    //!\brief The start position of each run followed by the length of the BWT.
+    sdsl::int_vector<> run_starts{};
+    //!\brief For each character, the number of its occurrences in its first k runs for all k.
+    sdsl::int_vector<> run_prefix{};
+    //!\brief The position of the first entry of each character in `run_prefix`.
+    std::vector<size_type> run_prefix_begin{};
+    //!\brief The start positions of the runs, grouped by the character of the run.
+    sdsl::int_vector<> char_run_starts{};
+    //!\brief The position of the first run of each character in `char_run_starts`, followed by the number of runs.
+    std::vector<size_type> char_runs_begin{};
+
+    //!\brief Returns the number of occurrences of `c` in `[0, i)`, given the run containing position `i - 1`.
+    size_type rank_in_run(size_type const i, size_type const run, value_type const c) const noexcept
+    {
+        size_type rank = run_prefix[run_prefix_begin[c] + heads.rank(run, c)];
+        if (heads[run] == c)
+            rank += i - run_starts[run];
+        return rank;
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    run_length_occurrence_table() = default;                                                 //!< Defaulted.
+    run_length_occurrence_table(run_length_occurrence_table const &) = default;              //!< Defaulted.
+    run_length_occurrence_table(run_length_occurrence_table &&) = default;                   //!< Defaulted.
+    run_length_occurrence_table & operator=(run_length_occurrence_table const &) = default;  //!< Defaulted.
+    run_length_occurrence_table & operator=(run_length_occurrence_table &&) = default;       //!< Defaulted.
+    ~run_length_occurrence_table() = default;                                                //!< Defaulted.
+
+    /*!\brief Constructs the table from the BWT.
+     * \param[in] bwt A buffer holding the BWT.
+     * \throws std::invalid_argument if the BWT contains more than `sigma` different characters besides the sentinel.
+     */
+    explicit run_length_occurrence_table(sdsl::int_vector_buffer<8> & bwt)
+    {
+        size_type const n = bwt.size();
+
+        std::vector<value_type> run_heads;
+        std::vector<size_type> starts;
+        std::vector<std::vector<size_type>> prefix(sigma + 1, std::vector<size_type>{0});
+        std::vector<std::vector<size_type>> char_starts(sigma + 1);
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            value_type const c = bwt[i];
+
+            if (i == 0 || c != run_heads.back())
+            {
+                run_heads.push_back(c);
+                starts.push_back(i);
+                if (c <= sigma)
+                {
+                    prefix[c].push_back(prefix[c].back());
+                    char_starts[c].push_back(i);
+                }
+            }
+
+            if (c <= sigma)
+                ++prefix[c].back();
+        }
+
+        heads = epr_occurrence_table<sigma_>{run_heads}; // throws if a character is out of range
+
+        run_starts = sdsl::int_vector<>(starts.size() + 1, 0, sdsl::bits::hi(n) + 1);
+        std::copy(starts.begin(), starts.end(), run_starts.begin());
+        run_starts[starts.size()] = n;
+
+        size_type total{0};
+        for (std::vector<size_type> const & p : prefix)
+        {
+            run_prefix_begin.push_back(total);
+            total += p.size();
+        }
+
+        run_prefix = sdsl::int_vector<>(total, 0, sdsl::bits::hi(n) + 1);
+        for (value_type c = 0; c <= sigma; ++c)
+            std::copy(prefix[c].begin(), prefix[c].end(), run_prefix.begin() + run_prefix_begin[c]);
+
+        char_run_starts = sdsl::int_vector<>(starts.size(), 0, sdsl::bits::hi(n) + 1);
+        char_runs_begin.push_back(0);
+        for (std::vector<size_type> const & s : char_starts)
+        {
+            std::copy(s.begin(), s.end(), char_run_starts.begin() + char_runs_begin.back());
+            char_runs_begin.push_back(char_runs_begin.back() + s.size());
+        }
+    }
+    //!\}
+
+    //!\brief Returns the length of the BWT including the sentinel.
+    size_type size() const noexcept
+    {
+        return run_starts.empty() ? 0 : run_starts[run_starts.size() - 1];
+    }
+
+    //!\brief Returns the number of runs of the BWT.
+    size_type runs() const noexcept
+    {
+        return heads.size();
+    }
+
+    //!\brief Returns the run containing position `i` of the BWT.
+    size_type run(size_type const i) const noexcept
+    {
+        assert(i < size());
+        return std::upper_bound(run_starts.begin(), run_starts.end(), i) - run_starts.begin() - 1;
+    }
+
+    //!\brief Returns the start position of a run in the BWT.
+    size_type run_start(size_type const run) const noexcept
+    {
+        assert(run <= runs());
+        return run_starts[run];
+    }
+
+    //!\brief Returns the character of a run.
+    value_type run_head(size_type const run) const noexcept
+    {
+        assert(run < runs());
+        return heads[run];
+    }
+
+    /*!\brief Returns the position of the first run of `c` at or after `run` among the runs of all characters ordered
+     *        by character and position.
+     *
+     * \details
+     *
+     * Ranges over `[0, runs()]`. Data stored per run can be ordered this way to access the run of a character that
+     * follows a position.
+     */
+    size_type char_run(size_type const run, value_type const c) const noexcept
+    {
+        assert(run <= runs());
+        assert(c <= sigma);
+        return char_runs_begin[c] + heads.rank(run, c);
+    }
+
+    //!\brief Returns the character at position `i` of the BWT.
+    value_type operator[](size_type const i) const noexcept
+    {
+        return heads[run(i)];
+    }
+
+    //!\brief Returns the position of the occurrence of `c` in the BWT that is preceded by `k` occurrences of `c`.
+    size_type select(size_type const k, value_type const c) const noexcept
+    {
+        assert(c <= sigma);
+
+        // the (k + 1)-th occurrence is in the q-th run of c with prefix[q] <= k < prefix[q + 1]
+        auto const first = run_prefix.begin() + run_prefix_begin[c];
+        auto const last = first + (char_runs_begin[c + 1] - char_runs_begin[c]) + 1;
+        auto const it = std::upper_bound(first, last, k) - 1;
+        assert(it + 1 != last);
+
+        return char_run_starts[char_runs_begin[c] + (it - first)] + (k - *it);
+    }
+
+    //!\brief Returns the number of occurrences of `c` in the BWT interval `[0, i)`.
+    size_type rank(size_type const i, value_type const c) const noexcept
+    {
+        assert(i <= size());
+        assert(c <= sigma);
+
+        return i == 0 ? 0 : rank_in_run(i, run(i - 1), c);
+    }
+
+    /*!\brief Returns the number of occurrences of `c` in `[0, i)` and the number of characters smaller and greater
+     *        than `c` in `[i, j)`.
+     *
+     * \details
+     *
+     * This is the same interface as `sdsl::wt_pc::lex_count` and used for bidirectional search.
+     */
+    std::tuple<size_type, size_type, size_type> lex_count(size_type const i,
+                                                          size_type const j,
+                                                          value_type const c) const noexcept
+    {
+        assert(i <= j);
+        assert(j <= size());
+
+        if (i == j)
+            return {rank(i, c), 0, 0};
+
+        // the runs are searched once for all characters
+        size_type const run_i = i == 0 ? 0 : run(i - 1);
+        size_type const run_j = run(j - 1);
+        auto rank_i = [&] (value_type const d) { return i == 0 ? 0 : rank_in_run(i, run_i, d); };
+
+        size_type smaller{0};
+        for (value_type d = 0; d < c; ++d)
+            smaller += rank_in_run(j, run_j, d) - rank_i(d);
+
+        size_type const rank_c = rank_i(c);
+        return {rank_c, smaller, (j - i) - smaller - (rank_in_run(j, run_j, c) - rank_c)};
+    }
+
+    //!\brief Returns `true` if both tables are equal.
+    bool operator==(run_length_occurrence_table const & rhs) const noexcept
+    {
+        return heads == rhs.heads && run_starts == rhs.run_starts && run_prefix == rhs.run_prefix &&
+               run_prefix_begin == rhs.run_prefix_begin && char_run_starts == rhs.char_run_starts &&
+               char_runs_begin == rhs.char_runs_begin;
+    }
+
+    //!\brief Returns `true` if the tables are unequal.
+    bool operator!=(run_length_occurrence_table const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(heads, run_starts, run_prefix, run_prefix_begin, char_run_starts, char_runs_begin);
+    }
+    //!\endcond
+};
+
+/*!\brief A compressed suffix array of size \f$O(r)\f$ for a BWT with \f$r\f$ runs (r-index).
+ * \tparam sigma_ The number of different characters in the text without the sentinel.
+ *
+ * \details
+ *
+ * The BWT is stored in a seqan3::detail::run_length_occurrence_table. Instead of sampling the suffix array regularly,
+ * the suffix array is only sampled at the boundaries of the runs: the entry at the start of each run, and for
+ * the end of each run the entry together with its successor in the suffix array. The successor samples, ordered by
+ * text position, define the function \f$\phi^{-1}(SA[i]) = SA[i + 1]\f$: if \f$p\f$ is the largest sampled text
+ * position not greater than \f$t\f$, then \f$\phi^{-1}(t) = \phi^{-1}(p) + t - p\f$.
+ *
+ * The FM index cursors locate the occurrences of a string of length m through `suffix_array_interval`: its first
+ * entry (the toehold) is computed by backward search over the string as proposed by Gagie et al. Whenever the first
+ * character of the interval is not the next character of the search, the first matching character is the head of a
+ * run, whose suffix array sample is known. The string is read from the index itself by following \f$\psi\f$ (the
+ * inverse of the LF mapping) from the interval. This takes \f$O(m \log r)\f$ time, and each further entry a single
+ * application of \f$\phi^{-1}\f$ in \f$O(\log r)\f$. Single entries of the suffix array (`operator[]`) have no
+ * toehold and are computed from the sample at the start of their run by applying \f$\phi^{-1}\f$ once for each
+ * position between the start of the run and the entry.
+ *
+ * This type models seqan3::detail::sdsl_index and can be used as underlying index of a seqan3::fm_index or a
+ * seqan3::bi_fm_index. It is built by the SDSL construction (sdsl::construct and sdsl::construct_im) from the BWT and
+ * the suffix array, which are read sequentially. Use seqan3::sdsl_r_index_type to obtain a suitable type for an
+ * alphabet.
+ */
+template <uint8_t sigma_>
+class r_index
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the occurrence table.
+    using occurrence_table_type = run_length_occurrence_table<sigma_>;
+    //!\brief The alphabet strategy. The characters are not mapped.
+    using alphabet_type = sdsl::plain_byte_alphabet;
+    //!\brief Type for representing positions in the text.
+    using size_type = typename occurrence_table_type::size_type;
+    //!\brief The character type.
+    using char_type = typename alphabet_type::char_type;
+    //!\brief The character type after the mapping of the alphabet strategy.
+    using comp_char_type = typename alphabet_type::comp_char_type;
+    //!\brief The SDSL alphabet category, used by the SDSL construction.
+    using alphabet_category = typename alphabet_type::alphabet_category;
+    //!\brief The SDSL index category, used by the SDSL construction.
+    using index_category = sdsl::csa_tag;
+    //!\}
+
+private:
+    //!\brief The occurrence table over the run-length encoded BWT.
+    occurrence_table_type m_occ{};
+    //!\brief Stores the cumulative character counts.
+    alphabet_type m_alphabet{};
+    //!\brief The suffix array entry at the start of each run, ordered by run_length_occurrence_table::char_run.
+    sdsl::int_vector<> m_run_start_samples{};
+    //!\brief The suffix array entries at the end of each run (but the last), sorted.
+    sdsl::int_vector<> m_phi_keys{};
+    //!\brief The successor in the suffix array of each entry in `m_phi_keys`.
+    sdsl::int_vector<> m_phi_values{};
+
+public:
+    //!\brief Maps a character to its rank in the BWT (identity).
+    typename alphabet_type::char2comp_type const & char2comp;
+    //!\brief Maps a rank in the BWT to its character (identity).
+    typename alphabet_type::comp2char_type const & comp2char;
+    //!\brief Cumulative character counts.
+    typename alphabet_type::C_type const & C;
+    //!\brief The largest character of the text plus one.
+    typename alphabet_type::sigma_type const & sigma;
+    //!\brief The BWT (provides `rank` and random access).
+    occurrence_table_type const & bwt;
+    //!\brief The BWT (provides `lex_count`); an alias for `bwt`.
+    occurrence_table_type const & wavelet_tree;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Default constructor.
+    r_index() :
+        char2comp{m_alphabet.char2comp}, comp2char{m_alphabet.comp2char}, C{m_alphabet.C}, sigma{m_alphabet.sigma},
+        bwt{m_occ}, wavelet_tree{m_occ}
+    {}
+
+    //!\brief Copy constructor; rebinds the public references.
+    r_index(r_index const & rhs) :
+        m_occ{rhs.m_occ}, m_alphabet{rhs.m_alphabet}, m_run_start_samples{rhs.m_run_start_samples},
+        m_phi_keys{rhs.m_phi_keys}, m_phi_values{rhs.m_phi_values},
+        char2comp{m_alphabet.char2comp}, comp2char{m_alphabet.comp2char}, C{m_alphabet.C}, sigma{m_alphabet.sigma},
+        bwt{m_occ}, wavelet_tree{m_occ}
+    {}
+
+    //!\brief Move constructor; rebinds the public references.
+    r_index(r_index && rhs) :
+        m_occ{std::move(rhs.m_occ)}, m_alphabet{std::move(rhs.m_alphabet)},
+        m_run_start_samples{std::move(rhs.m_run_start_samples)}, m_phi_keys{std::move(rhs.m_phi_keys)},
+        m_phi_values{std::move(rhs.m_phi_values)},
+        char2comp{m_alphabet.char2comp}, comp2char{m_alphabet.comp2char}, C{m_alphabet.C}, sigma{m_alphabet.sigma},
+        bwt{m_occ}, wavelet_tree{m_occ}
+    {}
+
+    //!\brief Copy and move assignment.
+    r_index & operator=(r_index rhs)
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    ~r_index() = default; //!< Defaulted.
+
+    /*!\brief Constructs the index from the BWT and the suffix array in the SDSL cache.
+     * \param[in] config The SDSL cache configuration holding the BWT and the suffix array.
+     * \throws std::invalid_argument if the text contains more than `sigma_` different characters.
+     *
+     * \details
+     *
+     * This constructor is called by the SDSL construction, you should never need to call it directly.
+     */
+    explicit r_index(sdsl::cache_config & config) : r_index{}
+    {
+        {
+            sdsl::int_vector_buffer<8> bwt_buf(sdsl::cache_file_name(sdsl::conf::KEY_BWT, config));
+            m_alphabet = alphabet_type{bwt_buf, bwt_buf.size()};
+            m_occ = occurrence_table_type{bwt_buf};
+        }
+
+        sdsl::int_vector_buffer<> sa_buf(sdsl::cache_file_name(sdsl::conf::KEY_SA, config));
+        size_type const n = sa_buf.size();
+        size_type const r = m_occ.runs();
+        uint8_t const width = sdsl::bits::hi(n) + 1;
+
+        m_run_start_samples = sdsl::int_vector<>(r, 0, width);
+        std::vector<std::pair<size_type, size_type>> phi(r - 1);
+
+        for (size_type run = 0; run < r; ++run)
+        {
+            size_type const sample = sa_buf[m_occ.run_start(run)];
+            m_run_start_samples[m_occ.char_run(run, m_occ.run_head(run))] = sample;
+
+            if (run > 0)
+                phi[run - 1] = {sa_buf[m_occ.run_start(run) - 1], sample};
+        }
+
+        std::sort(phi.begin(), phi.end());
+
+        m_phi_keys = sdsl::int_vector<>(phi.size(), 0, width);
+        m_phi_values = sdsl::int_vector<>(phi.size(), 0, width);
+        for (size_type i = 0; i < phi.size(); ++i)
+        {
+            m_phi_keys[i] = phi[i].first;
+            m_phi_values[i] = phi[i].second;
+        }
+    }
+    //!\}
+
+    //!\brief Returns the length of the text including the sentinel.
+    size_type size() const noexcept
+    {
+        return m_occ.size();
+    }
+
+    //!\brief Returns `true` if the index is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the suffix array entry following the one with value `t`, i.e. \f$SA[ISA[t] + 1]\f$.
+     *
+     * \details
+     *
+     * Must not be called for the last entry of the suffix array.
+     */
+    size_type phi_inverse(size_type const t) const noexcept
+    {
+        auto const it = std::upper_bound(m_phi_keys.begin(), m_phi_keys.end(), t);
+        assert(it != m_phi_keys.begin());
+        size_type const k = it - m_phi_keys.begin() - 1;
+        return m_phi_values[k] + (t - m_phi_keys[k]);
+    }
+
+    /*!\brief Returns the suffix array entry at position `i`.
+     *
+     * \details
+     *
+     * Applies \f$\phi^{-1}\f$ to the sample at the start of the run containing `i`, once per position between the
+     * start of the run and `i`, i.e. the cost grows with the length of the run. Use `suffix_array_interval` for the
+     * entries of a suffix array interval.
+     */
+    size_type operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+
+        size_type const run = m_occ.run(i);
+        size_type entry = m_run_start_samples[m_occ.char_run(run, m_occ.run_head(run))];
+        for (size_type j = m_occ.run_start(run); j < i; ++j)
+            entry = phi_inverse(entry);
+
+        return entry;
+    }
+
+    /*!\brief Returns the suffix array entry at the left bound of the suffix array interval of a string.
+     * \param[in] lb    The left bound of the interval.
+     * \param[in] depth The length of the string.
+     *
+     * \details
+     *
+     * Reads the string by following \f$\psi\f$ from `lb` and searches it backwards, keeping track of the suffix
+     * array entry at the left bound of the interval (the toehold): if the BWT at the left bound holds the next
+     * character, the entry decreases by one. Otherwise, the first occurrence of the character in the interval is the
+     * head of the next run of this character, whose entry is sampled. Takes \f$O(depth \cdot \log r)\f$ time.
+     */
+    size_type toehold(size_type const lb, size_type const depth) const
+    {
+        assert(lb < size());
+
+        std::vector<comp_char_type> label(depth);
+        for (size_type i = 0, p = lb; i < depth; ++i)
+        {
+            comp_char_type const c = std::upper_bound(C.begin(), C.end(), p) - C.begin() - 1;
+            label[i] = c;
+            p = m_occ.select(p - C[c], c);
+        }
+
+        // the empty string is the prefix of all suffixes; the smallest suffix is the sentinel
+        size_type l = 0;
+        size_type entry = size() - 1;
+        for (auto it = label.rbegin(); it != label.rend(); ++it)
+        {
+            size_type const run = m_occ.run(l);
+            if (m_occ.run_head(run) == *it)
+                entry = entry - 1;
+            else
+                entry = m_run_start_samples[m_occ.char_run(run, *it)] - 1;
+
+            l = C[*it] + m_occ.rank(l, *it);
+        }
+
+        assert(l == lb);
+        return entry;
+    }
+
+    /*!\brief Stores the suffix array entries at the positions `lb` to `lb + sa.size() - 1` in `sa`.
+     * \param[in]  lb    The left bound of the interval.
+     * \param[in]  depth The length of the string whose suffix array interval starts at `lb`.
+     * \param[out] sa    The entries; its size determines the length of the interval.
+     *
+     * \details
+     *
+     * The first entry is computed by seqan3::detail::r_index::toehold, every further entry by a single application
+     * of \f$\phi^{-1}\f$.
+     */
+    void suffix_array_interval(size_type const lb, size_type const depth, std::vector<size_type> & sa) const
+    {
+        assert(lb + sa.size() <= size());
+
+        if (sa.empty())
+            return;
+
+        sa[0] = toehold(lb, depth);
+        for (size_type i = 1; i < sa.size(); ++i)
+            sa[i] = phi_inverse(sa[i - 1]);
+    }
+
+    //!\brief Swaps the content with another index.
+    void swap(r_index & rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            std::swap(m_occ, rhs.m_occ);
+            std::swap(m_alphabet, rhs.m_alphabet);
+            m_run_start_samples.swap(rhs.m_run_start_samples);
+            m_phi_keys.swap(rhs.m_phi_keys);
+            m_phi_values.swap(rhs.m_phi_values);
+        }
+    }
+
+    //!\brief Returns `true` if both indices are equal.
+    bool operator==(r_index const & rhs) const noexcept
+    {
+        return m_occ == rhs.m_occ && m_alphabet == rhs.m_alphabet &&
+               m_run_start_samples == rhs.m_run_start_samples && m_phi_keys == rhs.m_phi_keys &&
+               m_phi_values == rhs.m_phi_values;
+    }
+
+    //!\brief Returns `true` if the indices are unequal.
+    bool operator!=(r_index const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(m_occ, m_alphabet, m_run_start_samples, m_phi_keys, m_phi_values);
+    }
+    //!\endcond
+};
+
+//!\}
+
+} // namespace seqan3::detail
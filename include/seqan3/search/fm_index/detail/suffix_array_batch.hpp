@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::suffix_array_lf_batch.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+//!\brief The number of suffix array entries that seqan3::detail::suffix_array_lf_batch resolves in lock-step.
+inline constexpr size_t suffix_array_batch_size = 256;
+
+/*!\brief Replaces suffix array positions by their suffix array entries, walking the LF mapping of many positions in
+ *        lock-step.
+ * \tparam size_type     The type of the positions.
+ * \tparam is_sampled_t  Invocable with a position; returns whether the suffix array entry is sampled.
+ * \tparam prefetch_lf_t Invocable with a position; prefetches the data needed for the LF mapping.
+ * \tparam lf_t          Invocable with a position; returns the LF mapping of the position.
+ * \tparam sample_t      Invocable with a sampled position; returns its suffix array entry.
+ * \param[in,out] positions   The suffix array positions; replaced by the suffix array entries.
+ * \param[in]     text_size   The length of the text including the sentinel.
+ * \param[in]     is_sampled  Returns whether the suffix array entry of a position is sampled.
+ * \param[in]     prefetch_lf Prefetches the data needed for the LF mapping of a position.
+ * \param[in]     lf          Returns the LF mapping of a position.
+ * \param[in]     sample      Returns the suffix array entry of a sampled position.
+ *
+ * \details
+ *
+ * Locating an occurrence walks the LF mapping until a sampled position is reached; each step is a random access into
+ * the occurrence table. Instead of walking one occurrence at a time, the positions are processed in batches of
+ * seqan3::detail::suffix_array_batch_size: in each round, the data for the next step of all walks of the batch is
+ * prefetched before any step is taken, s.t. the memory accesses of independent walks overlap. When all walks of a
+ * batch have reached a sampled position, the samples are read in ascending order of their position.
+ */
+template <typename size_type, typename is_sampled_t, typename prefetch_lf_t, typename lf_t, typename sample_t>
+inline void suffix_array_lf_batch(std::vector<size_type> & positions,
+                                  size_type const text_size,
+                                  is_sampled_t && is_sampled,
+                                  prefetch_lf_t && prefetch_lf,
+                                  lf_t && lf,
+                                  sample_t && sample)
+{
+    // the state of a single walk
+    struct walk_type
+    {
+        size_type slot;     // the index in `positions`
+        size_type position; // the current suffix array position
+        size_type steps;    // the number of LF steps taken
+    };
+
+    std::vector<walk_type> walking;
+    std::vector<walk_type> sampled;
+    walking.reserve(suffix_array_batch_size);
+    sampled.reserve(suffix_array_batch_size);
+
+    for (size_type batch_begin = 0; batch_begin < positions.size(); batch_begin += suffix_array_batch_size)
+    {
+        size_type const batch_end = std::min<size_type>(batch_begin + suffix_array_batch_size, positions.size());
+
+        walking.clear();
+        sampled.clear();
+        for (size_type slot = batch_begin; slot < batch_end; ++slot)
+            walking.push_back(walk_type{slot, positions[slot], 0});
+
+        while (!walking.empty())
+        {
+            // set aside the walks that reached a sample
+            auto const still_walking = std::partition(walking.begin(), walking.end(), [&] (walk_type const & walk)
+            {
+                return !is_sampled(walk.position);
+            });
+            sampled.insert(sampled.end(), still_walking, walking.end());
+            walking.erase(still_walking, walking.end());
+
+            for (walk_type const & walk : walking)
+                prefetch_lf(walk.position);
+
+            for (walk_type & walk : walking)
+            {
+                walk.position = lf(walk.position);
+                ++walk.steps;
+            }
+        }
+
+        std::sort(sampled.begin(), sampled.end(), [] (walk_type const & lhs, walk_type const & rhs)
+        {
+            return lhs.position < rhs.position;
+        });
+
+        for (walk_type const & walk : sampled)
+            positions[walk.slot] = (sample(walk.position) + walk.steps) % text_size;
+    }
+}
+
+//!\}
+
+} // namespace seqan3::detail
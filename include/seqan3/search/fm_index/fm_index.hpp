@@ -13,6 +13,7 @@
 #pragma once
 
 #include <sdsl/suffix_trees.hpp>
+#include <sdsl/wavelet_trees.hpp>
 
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/std/filesystem>
@@ -21,8 +22,13 @@
 #include <seqan3/range/views/to_rank.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/construction_options.hpp>
 #include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
+#include <seqan3/search/fm_index/detail/epr_index.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_construction.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_lookup_table.hpp>
+#include <seqan3/search/fm_index/detail/r_index.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
@@ -43,16 +49,39 @@ class bi_fm_index_cursor;
  * \{
  */
 
-/*!\brief The FM Index Configuration using a Wavelet Tree.
+//!\brief The strategies to sample the suffix array of an FM index.
+enum class sa_sampling : uint8_t
+{
+    /*!\brief Every k-th entry of the suffix array is sampled.
+     *        Needs no additional bit vector, but the number of LF-steps for locating an occurrence is not bounded by k.
+     */
+    suffix_order,
+    /*!\brief Every k-th position of the text is sampled.
+     *        Guarantees less than k LF-steps for locating an occurrence at the cost of a bit vector marking the
+     *        sampled suffix array entries.
+     */
+    text_order
+};
+
+/*!\brief The FM Index Configuration using a Wavelet Tree with a configurable sampling of the suffix array.
+ * \tparam sa_sampling_rate  Every `sa_sampling_rate`-th suffix array entry (resp. text position) is sampled.
+ * \tparam isa_sampling_rate Every `isa_sampling_rate`-th entry of the inverse suffix array is sampled.
+ * \tparam sampling_strategy The strategy to choose the sampled entries, see seqan3::sa_sampling.
  *
  * \details
  *
  * ### Running time / Space consumption
  *
- * \f$SAMPLING\_RATE = 16\f$
+ * \f$SAMPLING\_RATE = sa\_sampling\_rate\f$
  * \f$\Sigma\f$: alphabet_size<char_type> where char_type is the seqan3 alphabet type (e.g. dna4 has an alphabet size
  *               of 4).
  *
+ * The suffix array samples take \f$\frac{n}{SAMPLING\_RATE} \cdot \log n\f$ bits for a text of length \f$n\f$.
+ * They are only needed to locate occurrences (seqan3::fm_index_cursor::locate() and
+ * seqan3::fm_index_cursor::path_label()), counting and searching is not affected by the sampling rate. Thus a large
+ * sampling rate results in a small index for count-heavy applications, while a small sampling rate speeds up
+ * locate-heavy applications. The inverse suffix array samples are not used by the FM indices and should be kept sparse.
+ *
  * For an index over a text collection a delimiter is added inbetween the texts. This causes sigma to increase by 1.
  * \attention For any alphabet, the symbol with rank 255 is not allowed to occur in the text. Addtionally,
  *            rank 254 cannot occur when indexing text collections.
@@ -74,23 +103,82 @@ class bi_fm_index_cursor;
  * \if DEV \todo Asymptotic space consumption: \endif
  *
  */
-using sdsl_wt_index_type =
+template <uint32_t sa_sampling_rate,
+          uint32_t isa_sampling_rate = 10000000,
+          sa_sampling sampling_strategy = sa_sampling::suffix_order>
+using sampled_sdsl_wt_index_type =
     sdsl::csa_wt<sdsl::wt_blcd<sdsl::bit_vector,
                                sdsl::rank_support_v<>,
                                sdsl::select_support_scan<>,
                                sdsl::select_support_scan<0>>,
-                 16,
-                 10000000,
-                 sdsl::sa_order_sa_sampling<>,
-                 sdsl::isa_sampling<>,
+                 sa_sampling_rate,
+                 isa_sampling_rate,
+                 std::conditional_t<sampling_strategy == sa_sampling::suffix_order,
+                                    sdsl::sa_order_sa_sampling<>,
+                                    sdsl::text_order_sa_sampling<>>,
+                 std::conditional_t<sampling_strategy == sa_sampling::suffix_order,
+                                    sdsl::isa_sampling<>,
+                                    sdsl::text_order_isa_sampling_support<>>,
                  sdsl::plain_byte_alphabet>;
 
+/*!\brief The FM Index Configuration using a Wavelet Tree.
+ *
+ * \details
+ *
+ * Samples every 16-th entry of the suffix array. See seqan3::sampled_sdsl_wt_index_type for details.
+ */
+using sdsl_wt_index_type = sampled_sdsl_wt_index_type<16>;
+
 /*!\brief The default FM Index Configuration.
  * \attention The default might be changed in a future release. If you rely on a stable API and on-disk-format,
  *            please hard-code your sdsl_index_type to a concrete type.
  */
 using default_sdsl_index_type = sdsl_wt_index_type;
 
+/*!\brief The FM Index Configuration using an interleaved occurrence table (EPR dictionary) for small alphabets.
+ * \tparam alphabet_t        The alphabet type of the index; seqan3::alphabet_size must be at most 63.
+ * \tparam text_layout_mode  Whether the index is built over a single text or a collection (adds the delimiter).
+ * \tparam sa_sampling_rate  Every `sa_sampling_rate`-th suffix array entry is sampled.
+ *
+ * \details
+ *
+ * Instead of a wavelet tree, the BWT is stored in blocks of 64 characters together with the occurrence counts of all
+ * characters preceding the block (see seqan3::detail::epr_occurrence_table). A backward search step or a
+ * bidirectional extension thus accesses a single block per interval bound instead of one rank data structure per level
+ * of the wavelet tree. For seqan3::dna4 a block needs 32 bytes, i.e. the index takes about 4 bits per character
+ * plus the suffix array samples.
+ *
+ * The alphabet and text layout must match those of the FM index:
+ *
+ * \include test/snippet/search/fm_index_epr.cpp
+ */
+template <semialphabet alphabet_t, text_layout text_layout_mode, uint32_t sa_sampling_rate = 16>
+using sdsl_epr_index_type = detail::epr_index<alphabet_size<alphabet_t> + text_layout_mode, sa_sampling_rate>;
+
+/*!\brief The FM Index Configuration using a run-length encoded BWT and suffix array samples at the run boundaries
+ *        (r-index), e.g. for collections of many similar genomes.
+ * \tparam alphabet_t        The alphabet type of the index; seqan3::alphabet_size must be at most 63.
+ * \tparam text_layout_mode  Whether the index is built over a single text or a collection (adds the delimiter).
+ *
+ * \details
+ *
+ * The size of an FM index with a wavelet tree and regular suffix array samples is linear in the length of the text.
+ * For a highly repetitive text, e.g. a pangenome of many genomes of the same species, the BWT consists of few runs of
+ * equal characters. The r-index stores each of the \f$r\f$ runs by its start position and character, and samples
+ * the suffix array only at the boundaries of the runs (see seqan3::detail::r_index). Its size is \f$O(r)\f$ words.
+ *
+ * Searching is slower by a binary search over the runs per rank query. Locating the first occurrence of a query
+ * takes time proportional to its distance to the start of its BWT run, every further occurrence takes a single binary
+ * search over the samples.
+ *
+ * The construction still computes the full suffix array. For large texts, consider the semi-external construction
+ * (see seqan3::fm_index_construction_options).
+ *
+ * \include test/snippet/search/fm_index_r_index.cpp
+ */
+template <semialphabet alphabet_t, text_layout text_layout_mode>
+using sdsl_r_index_type = detail::r_index<alphabet_size<alphabet_t> + text_layout_mode>;
+
 
 
 /*!\brief The SeqAn FM Index.
@@ -120,11 +208,19 @@ using default_sdsl_index_type = sdsl_wt_index_type;
  * \attention When building an index for a **text collection** over any alphabet, the symbols with rank 254 and 255
  *            are reserved and may not be used in the text.
  *
+ * ### Choosing the sampling rate
+ *
+ * Counting the occurrences of a pattern does not depend on the suffix array samples, locating them does. The sampling
+ * rate and strategy can be chosen by passing a seqan3::sampled_sdsl_wt_index_type as third template parameter, e.g.
+ * a sparse sampling for count-heavy applications and a dense sampling for locate-heavy ones:
+ *
+ * \include test/snippet/search/fm_index_sampling.cpp
+ *
  * \if DEV
  * ### Choosing an index implementation
  *
  * The underlying implementation of the FM Index (rank data structure, sampling rates, etc.) can be specified by
- * passing a new SDSL index type as second template parameter:
+ * passing a new SDSL index type as third template parameter.
  *
  * \todo Link to SDSL documentation or write our own once SDSL3 documentation is available somewhere....
  *
@@ -149,6 +245,24 @@ private:
     using sdsl_sigma_type = typename sdsl_index_type::alphabet_type::sigma_type;
     //!\}
 
+    /*!\brief The tag that begins a serialised index ("SEQAN3FM" in little endian).
+     *
+     * \details
+     *
+     * Indices serialised by SeqAn 3.0.0 begin with the data of the SDSL index, whose first 8 bytes are a length. The
+     * tag exceeds every possible length, so these archives are recognised instead of being misparsed.
+     */
+    static constexpr uint64_t serialisation_tag = 0x4D46334E41514553ULL;
+
+    /*!\brief The version of the serialised format of the index.
+     *
+     * \details
+     *
+     * Version 1 added the tag, the version and the optional k-mer lookup table and document array, which are only
+     * stored if they are present.
+     */
+    static constexpr uint32_t serialisation_version = 1;
+
     //!\brief Underlying index from the SDSL.
     sdsl_index_type index;
 
@@ -158,11 +272,16 @@ private:
     sdsl::select_support_sd<1> text_begin_ss;
     //!\brief Rank support for text_begin.
     sdsl::rank_support_sd<1> text_begin_rs;
+    //!\brief Precomputed suffix array intervals of short strings.
+    detail::fm_index_lookup_table<typename sdsl_index_type::size_type> lookup_table;
+    //!\brief The text of each suffix array entry for collections (empty unless requested on construction).
+    sdsl::wt_int<> document_array;
 
     /*!\brief Constructs the index given a range.
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
-     * \param[in] text The text to construct from.
+     * \param[in] text    The text to construct from.
+     * \param[in] options The construction options, see seqan3::fm_index_construction_options.
      *
      * \details
      * \if DEV
@@ -182,7 +301,7 @@ private:
     //!\cond
         requires text_layout_mode_ == text_layout::single
     //!\endcond
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options)
     {
         static_assert(std::ranges::bidirectional_range<text_t>, "The text must model bidirectional_range.");
         static_assert(alphabet_size<innermost_value_type_t<text_t>> <= 256, "The alphabet is too big.");
@@ -198,7 +317,6 @@ private:
 
         // TODO:
         // * check what happens in sdsl when constructed twice!
-        // * choose between in-memory/external and construction algorithms
         // * sdsl construction currently only works for int_vector, std::string and char *, not ranges in general
         // uint8_t largest_char = 0;
         sdsl::int_vector<8> tmp_text(std::ranges::distance(text));
@@ -219,7 +337,8 @@ private:
                           | std::views::reverse,
                           std::ranges::begin(tmp_text)); // reverse and increase rank by one
 
-        sdsl::construct_im(index, tmp_text, 0);
+        detail::construct_sdsl_index(index, tmp_text, options);
+        lookup_table.construct(begin(), options.kmer_lookup_length);
 
         // TODO: would be nice but doesn't work since it's private and the public member references are const
         // index.m_C.resize(largest_char);
@@ -232,7 +351,7 @@ private:
     //!\cond
         requires text_layout_mode_ == text_layout::collection
     //!\endcond
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options)
     {
         static_assert(std::ranges::bidirectional_range<text_t>, "The text collection must model bidirectional_range.");
         static_assert(std::ranges::bidirectional_range<reference_t<text_t>>,
@@ -314,7 +433,34 @@ private:
 
         std::ranges::reverse(tmp_text);
 
-        sdsl::construct_im(index, tmp_text, 0);
+        size_t const number_of_texts = std::ranges::distance(text);
+        size_t const concatenation_size = tmp_text.size();
+
+        // The suffix array entry i with SA[i] = j is the suffix of the reversed concatenation starting at j, i.e.
+        // position `concatenation_size - 1 - j` of the concatenation is its first character in the original text.
+        auto fill_document_array = [&] (sdsl::int_vector_buffer<> & suffix_array)
+        {
+            sdsl::int_vector<> documents(suffix_array.size(), 0,
+                                         sdsl::bits::hi(std::max<size_t>(number_of_texts - 1, 1)) + 1);
+
+            for (size_t i = 0; i < suffix_array.size(); ++i)
+            {
+                size_t const j = suffix_array[i];
+                // the sentinel has no text, it is only contained in the interval of the root, whose document
+                // counts are not taken from the document array
+                documents[i] = (j == concatenation_size) ? number_of_texts - 1
+                                                         : text_begin_rs.rank(concatenation_size - j) - 1;
+            }
+
+            sdsl::construct_im(document_array, documents, 0);
+        };
+
+        if (options.document_listing)
+            detail::construct_sdsl_index(index, tmp_text, options, fill_document_array);
+        else
+            detail::construct_sdsl_index(index, tmp_text, options);
+
+        lookup_table.construct(begin(), options.kmer_lookup_length);
     }
 
 public:
@@ -348,7 +494,8 @@ public:
 
     //!\brief When copy constructing, also update internal data structures.
     fm_index(fm_index const & rhs) :
-        index{rhs.index}, text_begin{rhs.text_begin}, text_begin_ss{rhs.text_begin_ss}, text_begin_rs{rhs.text_begin_rs}
+        index{rhs.index}, text_begin{rhs.text_begin}, text_begin_ss{rhs.text_begin_ss}, text_begin_rs{rhs.text_begin_rs},
+        lookup_table{rhs.lookup_table}, document_array{rhs.document_array}
     {
         text_begin_ss.set_vector(&text_begin);
         text_begin_rs.set_vector(&text_begin);
@@ -357,7 +504,8 @@ public:
     //!\brief When move constructing, also update internal data structures.
     fm_index(fm_index && rhs) :
         index{std::move(rhs.index)}, text_begin{std::move(rhs.text_begin)},text_begin_ss{std::move(rhs.text_begin_ss)},
-        text_begin_rs{std::move(rhs.text_begin_rs)}
+        text_begin_rs{std::move(rhs.text_begin_rs)}, lookup_table{std::move(rhs.lookup_table)},
+        document_array{std::move(rhs.document_array)}
     {
         text_begin_ss.set_vector(&text_begin);
         text_begin_rs.set_vector(&text_begin);
@@ -370,6 +518,8 @@ public:
         text_begin = std::move(rhs.text_begin);
         text_begin_ss = std::move(rhs.text_begin_ss);
         text_begin_rs = std::move(rhs.text_begin_rs);
+        lookup_table = std::move(rhs.lookup_table);
+        document_array = std::move(rhs.document_array);
 
         text_begin_ss.set_vector(&text_begin);
         text_begin_rs.set_vector(&text_begin);
@@ -381,16 +531,17 @@ public:
 
     /*!\brief Constructor that immediately constructs the index given a range. The range cannot be empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
-     * \param[in] text The text to construct from.
+     * \param[in] text    The text to construct from.
+     * \param[in] options The construction options, see seqan3::fm_index_construction_options.
      *
      * ### Complexity
      *
      * \if DEV \todo \endif At least linear.
      */
     template <std::ranges::range text_t>
-    fm_index(text_t && text)
+    fm_index(text_t && text, fm_index_construction_options const & options = {})
     {
-        construct(std::forward<text_t>(text));
+        construct(std::forward<text_t>(text), options);
     }
     //!\}
 
@@ -426,6 +577,23 @@ public:
         return size() == 0;
     }
 
+    /*!\brief Returns the length of the strings whose suffix array intervals are precomputed.
+     * \returns seqan3::fm_index_construction_options::kmer_lookup_length of the construction; 0 if there is no lookup
+     *          table.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    uint8_t kmer_lookup_length() const noexcept
+    {
+        return lookup_table.kmer_length();
+    }
+
     /*!\brief Compares two indices.
      * \returns `true` if the indices are equal, false otherwise.
      *
@@ -440,7 +608,8 @@ public:
     bool operator==(fm_index const & rhs) const noexcept
     {
         // (void) rhs;
-        return (index == rhs.index) && (text_begin == rhs.text_begin);
+        return (index == rhs.index) && (text_begin == rhs.text_begin) && (lookup_table == rhs.lookup_table) &&
+               (document_array == rhs.document_array);
     }
 
     /*!\brief Compares two indices.
@@ -483,11 +652,30 @@ public:
      * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
      * \param archive The archive being serialised from/to.
      *
+     * \throws std::logic_error if the archive does not begin with seqan3::fm_index::serialisation_tag (e.g. it was
+     *         written by SeqAn 3.0.0) or was written with another version of the serialised format.
+     *
      * \attention These functions are never called directly, see \ref serialisation for more details.
      */
     template <cereal_archive archive_t>
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
+        uint64_t tag = serialisation_tag;
+        archive(tag);
+        if (tag != serialisation_tag)
+        {
+            throw std::logic_error{"The archive does not contain an fm_index in the format of SeqAn 3.0.1 or later. "
+                                   "Indices serialised by SeqAn 3.0.0 have to be rebuilt."};
+        }
+
+        uint32_t version = serialisation_version;
+        archive(version);
+        if (version != serialisation_version)
+        {
+            throw std::logic_error{"The fm_index was serialised in format version " + std::to_string(version) +
+                                   " but only version " + std::to_string(serialisation_version) + " can be read."};
+        }
+
         archive(index);
         archive(text_begin);
         archive(text_begin_ss);
@@ -513,9 +701,104 @@ public:
                                    " but it is being read into an fm_index expecting a " +
                                    (text_layout_mode ? "text collection." : "single text.")};
         }
+
+        // the optional data structures are only stored if they are present
+        bool has_lookup_table = lookup_table.kmer_length() > 0;
+        archive(has_lookup_table);
+        if (has_lookup_table)
+            archive(lookup_table);
+        else if constexpr (cereal_input_archive<archive_t>)
+            lookup_table.construct(begin(), 0);
+
+        bool has_document_array = !document_array.empty();
+        archive(has_document_array);
+        if (has_document_array)
+            archive(document_array);
+        else if constexpr (cereal_input_archive<archive_t>)
+            document_array = sdsl::wt_int<>{};
     }
     //!\endcond
 
+private:
+    /*!\brief Lists the texts that contain the suffixes of a suffix array interval.
+     * \param[in] lb    The left bound of the interval.
+     * \param[in] rb    The right bound of the interval (inclusive).
+     * \param[in] depth The length of the string whose suffix array interval is `[lb, rb]`.
+     * \returns The text positions in ascending order, each with the number of suffixes of the interval in the text.
+     *
+     * \details
+     *
+     * With a document array, the texts are listed by traversing the wavelet tree over the document array in
+     * \f$O(d \log_2 D)\f$ for d listed texts out of D texts in the collection. Otherwise, each suffix is located.
+     *
+     * The interval of the root (`depth == 0`) is the only interval that also contains the suffixes starting at the
+     * sentinel and at the delimiters. These are no occurrences of the empty string, which occurs once at every
+     * character, i.e. each non-empty text is listed with its length.
+     */
+    std::vector<std::pair<size_type, size_type>> document_counts(size_type const lb,
+                                                                 size_type const rb,
+                                                                 size_type const depth) const
+    //!\cond
+        requires text_layout_mode_ == text_layout::collection
+    //!\endcond
+    {
+        std::vector<std::pair<size_type, size_type>> counts;
+        size_type const number_of_texts = text_begin_rs.rank(text_begin.size());
+
+        if (depth == 0)
+        {
+            for (size_type i = 0; i < number_of_texts; ++i)
+            {
+                size_type const text_end = (i + 1 < number_of_texts) ? text_begin_ss.select(i + 2)
+                                                                     : text_begin.size();
+                // excludes the delimiter
+                size_type const text_size = text_end - text_begin_ss.select(i + 1) - 1;
+
+                if (text_size > 0)
+                    counts.emplace_back(i, text_size);
+            }
+
+            return counts;
+        }
+
+        if (!document_array.empty())
+        {
+
+            sdsl::wt_int<>::size_type k{};
+            std::vector<sdsl::wt_int<>::value_type> texts(number_of_texts);
+            std::vector<sdsl::wt_int<>::size_type> rank_lb(number_of_texts);
+            std::vector<sdsl::wt_int<>::size_type> rank_rb(number_of_texts);
+            document_array.interval_symbols(lb, rb + 1, k, texts, rank_lb, rank_rb);
+
+            // the wavelet tree is balanced, i.e. the texts are reported in ascending order
+            counts.reserve(k);
+            for (size_t i = 0; i < k; ++i)
+                counts.emplace_back(texts[i], rank_rb[i] - rank_lb[i]);
+
+            return counts;
+        }
+
+        std::vector<size_type> suffixes(rb + 1 - lb);
+        detail::suffix_array_interval(index, lb, depth, suffixes);
+
+        // only the interval of the root contains the sentinel, i.e. the suffix starting at `concatenation_size`
+        size_type const concatenation_size = size() - 1;
+        for (size_type & text_position : suffixes)
+        {
+            assert(text_position < concatenation_size);
+            text_position = text_begin_rs.rank(concatenation_size - text_position) - 1;
+        }
+
+        std::ranges::sort(suffixes);
+        for (size_type const text_position : suffixes)
+        {
+            if (counts.empty() || counts.back().first != text_position)
+                counts.emplace_back(text_position, 0);
+            ++counts.back().second;
+        }
+
+        return counts;
+    }
 };
 
 /*!\name Template argument type deduction guides
@@ -524,6 +807,11 @@ public:
 //! \brief Deduces the alphabet and dimensions of the text.
 template <std::ranges::range text_t>
 fm_index(text_t &&) -> fm_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+
+//! \brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+fm_index(text_t &&, fm_index_construction_options const &)
+    -> fm_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
 //!\}
 
 //!\}
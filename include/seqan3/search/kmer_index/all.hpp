@@ -15,4 +15,7 @@
 
 #pragma once
 
+#include <seqan3/search/kmer_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/kmer_index/minimiser_index.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
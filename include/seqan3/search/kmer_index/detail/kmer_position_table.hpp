@@ -0,0 +1,244 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::kmer_position_table.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/platform.hpp>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief Invokes `task(thread_id)` on `thread_count` threads (including the calling thread) and waits for all of them.
+ * \ingroup submodule_kmer_index
+ */
+template <typename task_t>
+inline void kmer_index_run_parallel(uint32_t const thread_count, task_t && task)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+
+    for (uint32_t thread_id = 1; thread_id < thread_count; ++thread_id)
+        threads.emplace_back(task, thread_id);
+
+    task(0u);
+
+    for (auto & thread : threads)
+        thread.join();
+}
+
+/*!\brief Stores the positions of hash values, grouped by hash value.
+ * \ingroup submodule_kmer_index
+ *
+ * \details
+ *
+ * The positions of all hash values are stored in one array, grouped by hash value and sorted by position within each
+ * group (compressed sparse row layout). The begin of each group is looked up
+ *
+ *   * directly by the hash value if the number of possible hash values does not exceed twice the number of
+ *     positions, or
+ *   * in an open addressing hash table with linear probing that only stores the hash values that occur.
+ *
+ * This is the storage of seqan3::kmer_index and seqan3::minimiser_index.
+ */
+class kmer_position_table
+{
+public:
+    //!\brief Type for hash values and positions.
+    using size_type = uint64_t;
+
+private:
+    //!\brief Marks an empty slot of the hash table.
+    static constexpr size_type empty_slot = std::numeric_limits<size_type>::max();
+    //!\brief Multiplier of the hash function of the hash table (Fibonacci hashing).
+    static constexpr size_type hash_multiplier = 0x9E3779B97F4A7C15ULL;
+
+    //!\brief The positions of all hash values, grouped by hash value.
+    std::vector<size_type> positions{};
+    //!\brief The begin of each group in `positions`; the last entry is the number of positions.
+    std::vector<size_type> group_begin{};
+    //!\brief The hash values stored in the hash table (empty if the hash values address the groups directly).
+    std::vector<size_type> slot_hash{};
+    //!\brief The group of each slot of the hash table.
+    std::vector<size_type> slot_group{};
+
+    //!\brief Returns the first slot of the hash table that is probed for `hash`.
+    size_type first_slot(size_type const hash) const noexcept
+    {
+        assert(detail::is_power_of_two(slot_hash.size()));
+        return (hash * hash_multiplier) >> (64 - detail::most_significant_bit_set(slot_hash.size()));
+    }
+
+    //!\brief Returns the group of `hash` or `empty_slot` if the hash value does not occur.
+    size_type group(size_type const hash) const noexcept
+    {
+        if (slot_hash.empty()) // direct addressing
+            return hash + 1 < group_begin.size() ? hash : empty_slot;
+
+        size_type const mask = slot_hash.size() - 1;
+        for (size_type slot = first_slot(hash); slot_group[slot] != empty_slot; slot = (slot + 1) & mask)
+            if (slot_hash[slot] == hash)
+                return slot_group[slot];
+
+        return empty_slot;
+    }
+
+public:
+    /*!\brief Stores the positions of (hash value, position) pairs.
+     * \param[in,out] entries      The pairs; sorted afterwards.
+     * \param[in]     hash_space   The number of possible hash values.
+     * \param[in]     thread_count The number of threads used for sorting.
+     *
+     * \details
+     *
+     * 1. The pairs are sorted concurrently in `thread_count` parts and merged, which groups the positions by hash
+     *    value.
+     * 2. The group boundaries are stored, either directly addressed by the hash value or in the hash table.
+     */
+    void construct(std::vector<std::pair<size_type, size_type>> & entries,
+                   long double const hash_space,
+                   uint32_t thread_count)
+    {
+        thread_count = std::max<uint32_t>(thread_count, 1);
+        size_type const entry_count = entries.size();
+
+        // 1. sort by hash value and position
+        size_type const chunk_size = (entry_count + thread_count - 1) / thread_count;
+        std::vector<size_type> part_begin(thread_count + 1);
+        for (uint32_t t = 0; t <= thread_count; ++t)
+            part_begin[t] = std::min<size_type>(t * chunk_size, entry_count);
+
+        kmer_index_run_parallel(thread_count, [&] (uint32_t const thread_id)
+        {
+            std::sort(entries.begin() + part_begin[thread_id], entries.begin() + part_begin[thread_id + 1]);
+        });
+
+        for (uint32_t width = 1; width < thread_count; width *= 2)
+        {
+            uint32_t const merges = (thread_count + 2 * width - 1) / (2 * width);
+            kmer_index_run_parallel(merges, [&] (uint32_t const merge_id)
+            {
+                uint32_t const first = merge_id * 2 * width;
+                uint32_t const middle = std::min(first + width, thread_count);
+                uint32_t const last = std::min(first + 2 * width, thread_count);
+                std::inplace_merge(entries.begin() + part_begin[first],
+                                   entries.begin() + part_begin[middle],
+                                   entries.begin() + part_begin[last]);
+            });
+        }
+
+        // 2. store the groups
+        positions.resize(entry_count);
+        for (size_type i = 0; i < entry_count; ++i)
+            positions[i] = entries[i].second;
+
+        slot_hash.clear();
+        slot_group.clear();
+
+        if (hash_space <= 2.0L * std::max<size_type>(entry_count, 1))
+        {
+            // the group of a hash value is the hash value itself
+            group_begin.assign(static_cast<size_type>(hash_space) + 1, 0);
+            for (auto const & [hash_value, position] : entries)
+                ++group_begin[hash_value + 1];
+            for (size_type i = 1; i < group_begin.size(); ++i)
+                group_begin[i] += group_begin[i - 1];
+        }
+        else
+        {
+            group_begin.clear();
+            for (size_type i = 0; i < entry_count; ++i)
+                if (i == 0 || entries[i].first != entries[i - 1].first)
+                    group_begin.push_back(i);
+
+            size_type const group_count = group_begin.size();
+            group_begin.push_back(entry_count);
+
+            slot_hash.assign(std::max<size_type>(detail::next_power_of_two(2 * group_count), 2), 0);
+            slot_group.assign(slot_hash.size(), empty_slot);
+
+            size_type const mask = slot_hash.size() - 1;
+            for (size_type g = 0; g < group_count; ++g)
+            {
+                size_type const hash_value = entries[group_begin[g]].first;
+                size_type slot = first_slot(hash_value);
+                while (slot_group[slot] != empty_slot)
+                    slot = (slot + 1) & mask;
+                slot_hash[slot] = hash_value;
+                slot_group[slot] = g;
+            }
+        }
+    }
+
+    //!\brief Returns the number of positions.
+    size_type size() const noexcept
+    {
+        return positions.size();
+    }
+
+    //!\brief Returns the number of positions of a hash value.
+    size_type count(size_type const hash) const noexcept
+    {
+        size_type const g = group(hash);
+        return g == empty_slot ? 0 : group_begin[g + 1] - group_begin[g];
+    }
+
+    //!\brief Returns the positions of a hash value in ascending order as a pair of pointers.
+    std::pair<size_type const *, size_type const *> equal_range(size_type const hash) const noexcept
+    {
+        size_type const g = group(hash);
+        if (g == empty_slot)
+            return {nullptr, nullptr};
+        return {positions.data() + group_begin[g], positions.data() + group_begin[g + 1]};
+    }
+
+    //!\brief Compares two tables.
+    bool operator==(kmer_position_table const & rhs) const noexcept
+    {
+        return std::tie(positions, group_begin, slot_hash, slot_group) ==
+               std::tie(rhs.positions, rhs.group_begin, rhs.slot_hash, rhs.slot_group);
+    }
+
+    //!\brief Compares two tables.
+    bool operator!=(kmer_position_table const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(positions, group_begin, slot_hash, slot_group);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3::detail
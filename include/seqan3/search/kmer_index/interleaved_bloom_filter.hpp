@@ -0,0 +1,428 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3
+{
+
+//!\brief Strong type for the number of bins of a seqan3::interleaved_bloom_filter.
+//!\ingroup submodule_kmer_index
+struct bin_count : detail::strong_type<size_t, bin_count>
+{
+    //!\brief Import the base constructors.
+    using detail::strong_type<size_t, bin_count>::strong_type;
+};
+
+//!\brief Strong type for the number of bits of each bin of a seqan3::interleaved_bloom_filter.
+//!\ingroup submodule_kmer_index
+struct bin_size : detail::strong_type<size_t, bin_size>
+{
+    //!\brief Import the base constructors.
+    using detail::strong_type<size_t, bin_size>::strong_type;
+};
+
+//!\brief Strong type for the number of hash functions of a seqan3::interleaved_bloom_filter.
+//!\ingroup submodule_kmer_index
+struct hash_function_count : detail::strong_type<size_t, hash_function_count>
+{
+    //!\brief Import the base constructors.
+    using detail::strong_type<size_t, hash_function_count>::strong_type;
+};
+
+//!\brief Strong type for a bin of a seqan3::interleaved_bloom_filter.
+//!\ingroup submodule_kmer_index
+struct bin_index : detail::strong_type<size_t, bin_index>
+{
+    //!\brief Import the base constructors.
+    using detail::strong_type<size_t, bin_index>::strong_type;
+};
+
+/*!\brief Returns the minimal number of k-mers a query shares with a text it occurs in with errors (k-mer lemma).
+ * \ingroup submodule_kmer_index
+ * \param[in] query_length The length of the query.
+ * \param[in] kmer_shape   The shape of the k-mers.
+ * \param[in] errors       The number of errors (substitutions, insertions or deletions).
+ *
+ * \details
+ *
+ * A query of length n has \f$n - s + 1\f$ k-mers for a shape of size s. Each error changes at most s of them, so an
+ * occurrence with e errors shares at least \f$n - s + 1 - e \cdot s\f$ k-mers with the text. If the result is 0, the
+ * k-mers cannot be used to rule out any text.
+ */
+inline size_t kmer_lemma_threshold(size_t const query_length, shape const & kmer_shape, uint8_t const errors) noexcept
+{
+    size_t const span = kmer_shape.size();
+    if (query_length < span)
+        return 0;
+
+    size_t const kmers = query_length - span + 1;
+    return kmers > errors * span ? kmers - errors * span : 0;
+}
+
+/*!\brief A Bloom filter for each of many bins that are stored interleaved, s.t. all bins are queried at once.
+ * \ingroup submodule_kmer_index
+ *
+ * \details
+ *
+ * Each bin (e.g. a genome of a reference collection) is a Bloom filter of `bin_size` bits that represents the hash
+ * values of the k-mers of the bin (see seqan3::views::kmer_hash). Instead of storing the Bloom filters one after the
+ * other, the i-th bit of all bins is stored consecutively. A hash function therefore determines a row of
+ * \f$\lceil b / 64 \rceil\f$ words for b bins, and the membership of a value in all bins is the bitwise AND of the
+ * rows of all hash functions. The rows are contiguous, so the AND is vectorised by the compiler and costs the same
+ * as a few memory accesses, independent of the number of bins.
+ *
+ * To determine the bins that may contain a query with errors, the k-mers of the query are counted per bin
+ * (seqan3::interleaved_bloom_filter::bulk_count) and compared to the threshold of the k-mer lemma
+ * (seqan3::kmer_lemma_threshold). Bloom filters have no false negatives: every bin that contains the query is
+ * reported, but bins that do not contain it may be reported as well. The false positive rate of a bin with n values,
+ * m bits and h hash functions is about \f$(1 - e^{-hn/m})^h\f$.
+ *
+ * The number of bits of a bin is rounded up to a power of two.
+ *
+ * \include test/snippet/search/kmer_index/interleaved_bloom_filter.cpp
+ */
+class interleaved_bloom_filter
+{
+private:
+    //!\brief The seeds of the hash functions.
+    static constexpr std::array<uint64_t, 5> hash_seeds{{0x9E3779B97F4A7C15ULL,
+                                                         0xC2B2AE3D27D4EB4FULL,
+                                                         0x165667B19E3779F9ULL,
+                                                         0xD6E8FEB86659FD93ULL,
+                                                         0xFF51AFD7ED558CCDULL}};
+
+    //!\brief The number of bins.
+    size_t bins_{0};
+    //!\brief The number of bits of each bin.
+    size_t bin_size_{0};
+    //!\brief The number of hash functions.
+    size_t hash_funs{0};
+    //!\brief The number of 64 bit words of a row, i.e. of each bit of all bins.
+    size_t bin_words{0};
+    //!\brief Shift that maps a 64 bit hash value to a row.
+    size_t hash_shift{0};
+    //!\brief The rows of all bits of the bins.
+    std::vector<uint64_t> data{};
+
+    /*!\brief Returns the first word of the row of `value` for the `i`-th hash function.
+     *
+     * \details
+     *
+     * The seed is mixed in before multiplying, otherwise the value 0 would be mapped to row 0 by every hash function.
+     */
+    size_t row_begin(uint64_t value, size_t const i) const noexcept
+    {
+        value = (value ^ hash_seeds[i]) * 0x9E3779B97F4A7C15ULL;
+        value ^= value >> 29;
+        value *= 0xBF58476D1CE4E5B9ULL;
+        return (value >> hash_shift) * bin_words;
+    }
+
+    //!\brief Stores the bitwise AND of the rows of `value` in `result`.
+    void and_rows(uint64_t const value, std::vector<uint64_t> & result) const noexcept
+    {
+        assert(result.size() == bin_words);
+
+        uint64_t const * row = data.data() + row_begin(value, 0);
+        std::copy(row, row + bin_words, result.begin());
+
+        for (size_t i = 1; i < hash_funs; ++i)
+        {
+            row = data.data() + row_begin(value, i);
+            for (size_t w = 0; w < bin_words; ++w)
+                result[w] &= row[w];
+        }
+    }
+
+    //!\brief Inserts the k-mers of a text or text collection into a bin.
+    template <typename text_t>
+    void emplace_text(text_t && text, shape const & kmer_shape, bin_index const bin)
+    {
+        if constexpr (dimension_v<text_t> > 1)
+        {
+            for (auto && sequence : text)
+                emplace_text(sequence, kmer_shape, bin);
+        }
+        else
+        {
+            if (static_cast<size_t>(std::ranges::distance(text)) < kmer_shape.size())
+                return;
+
+            for (uint64_t const hash : text | views::kmer_hash(kmer_shape))
+                emplace(hash, bin);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    interleaved_bloom_filter() = default;                                             //!< Defaulted.
+    interleaved_bloom_filter(interleaved_bloom_filter const &) = default;             //!< Defaulted.
+    interleaved_bloom_filter(interleaved_bloom_filter &&) = default;                  //!< Defaulted.
+    interleaved_bloom_filter & operator=(interleaved_bloom_filter const &) = default; //!< Defaulted.
+    interleaved_bloom_filter & operator=(interleaved_bloom_filter &&) = default;      //!< Defaulted.
+    ~interleaved_bloom_filter() = default;                                            //!< Defaulted.
+
+    /*!\brief Constructs an empty filter.
+     * \param[in] bins      The number of bins.
+     * \param[in] size      The number of bits of each bin; rounded up to a power of two.
+     * \param[in] functions The number of hash functions; must be between 1 and 5.
+     * \throws std::invalid_argument if a parameter is out of range.
+     */
+    interleaved_bloom_filter(seqan3::bin_count const bins,
+                             seqan3::bin_size const size,
+                             seqan3::hash_function_count const functions = seqan3::hash_function_count{2}) :
+        bins_{bins.get()}, hash_funs{functions.get()}
+    {
+        if (bins_ == 0)
+            throw std::invalid_argument{"The number of bins of an interleaved_bloom_filter must be positive."};
+        if (size.get() == 0)
+            throw std::invalid_argument{"The bin size of an interleaved_bloom_filter must be positive."};
+        if (hash_funs == 0 || hash_funs > hash_seeds.size())
+            throw std::invalid_argument{"The number of hash functions of an interleaved_bloom_filter must be between "
+                                        "1 and 5."};
+
+        bin_size_ = std::max<size_t>(detail::next_power_of_two(size.get()), 2);
+        hash_shift = 64 - detail::most_significant_bit_set(bin_size_);
+        bin_words = (bins_ + 63) / 64;
+        data.assign(bin_size_ * bin_words, 0);
+    }
+
+    /*!\brief Constructs the filter from the k-mers of each bin.
+     * \tparam bins_t The type of the bins; must model std::ranges::random_access_range and std::ranges::sized_range
+     *                over texts or text collections.
+     * \param[in] bins         The texts (or text collections) of the bins.
+     * \param[in] kmer_shape   The shape of the k-mers.
+     * \param[in] size         The number of bits of each bin; rounded up to a power of two.
+     * \param[in] functions    The number of hash functions; must be between 1 and 5.
+     * \param[in] thread_count The number of threads used for the construction.
+     * \throws std::invalid_argument if a parameter is out of range or the hash values of the shape/alphabet
+     *         combination cannot be represented in `uint64_t`.
+     *
+     * \details
+     *
+     * Each thread fills the bins of every `thread_count`-th word of the rows, s.t. no word is written concurrently.
+     * At most \f$\lceil b / 64 \rceil\f$ threads are used for b bins.
+     */
+    template <std::ranges::range bins_t>
+    interleaved_bloom_filter(bins_t && bins,
+                             shape const & kmer_shape,
+                             seqan3::bin_size const size,
+                             seqan3::hash_function_count const functions = seqan3::hash_function_count{2},
+                             uint32_t thread_count = 1) :
+        interleaved_bloom_filter{seqan3::bin_count{static_cast<size_t>(std::ranges::size(bins))}, size, functions}
+    {
+        static_assert(std::ranges::random_access_range<bins_t> && std::ranges::sized_range<bins_t>,
+                      "The bins must model random_access_range and sized_range.");
+        static_assert(semialphabet<innermost_value_type_t<bins_t>>,
+                      "The bins must be texts or text collections over a semialphabet.");
+
+        if (kmer_shape.size() == 0)
+            throw std::invalid_argument{"The shape of an interleaved_bloom_filter cannot be empty."};
+
+        // Checked here because the construction threads must not throw.
+        if (kmer_shape.size() > 64 / std::log2(alphabet_size<innermost_value_type_t<bins_t>>))
+            throw std::invalid_argument{"The chosen shape/alphabet combination is not valid. "
+                                        "The alphabet or shape size must be reduced."};
+
+        thread_count = std::max<uint32_t>(1, std::min<size_t>(thread_count, bin_words));
+
+        detail::kmer_index_run_parallel(thread_count, [&] (uint32_t const thread_id)
+        {
+            for (size_t word = thread_id; word < bin_words; word += thread_count)
+                for (size_t bin = 64 * word; bin < std::min(64 * word + 64, bins_); ++bin)
+                    emplace_text(bins[bin], kmer_shape, bin_index{bin});
+        });
+    }
+    //!\}
+
+    //!\brief Returns the number of bins.
+    size_t bin_count() const noexcept
+    {
+        return bins_;
+    }
+
+    //!\brief Returns the number of bits of each bin.
+    size_t bin_size() const noexcept
+    {
+        return bin_size_;
+    }
+
+    //!\brief Returns the number of hash functions.
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    //!\brief Returns the number of bits of the filter.
+    size_t bit_size() const noexcept
+    {
+        return 64 * data.size();
+    }
+
+    /*!\brief Inserts a value into a bin.
+     * \param[in] value The value, e.g. a hash value of seqan3::views::kmer_hash.
+     * \param[in] bin   The bin; must be less than bin_count().
+     *
+     * \details
+     *
+     * Inserting into bins that share a word of a row (bins \f$64 \cdot w\f$ to \f$64 \cdot w + 63\f$) is not
+     * thread-safe.
+     */
+    void emplace(uint64_t const value, bin_index const bin) noexcept
+    {
+        assert(bin.get() < bins_);
+
+        size_t const word = bin.get() / 64;
+        uint64_t const mask = 1ULL << (bin.get() % 64);
+
+        for (size_t i = 0; i < hash_funs; ++i)
+            data[row_begin(value, i) + word] |= mask;
+    }
+
+    /*!\brief Determines the bins that may contain a value.
+     * \param[in] value The value, e.g. a hash value of seqan3::views::kmer_hash.
+     * \returns A `std::vector<bool>` whose i-th element is `true` if the i-th bin may contain the value.
+     *
+     * ### Complexity
+     *
+     * \f$O(h \cdot b / 64)\f$ for h hash functions and b bins.
+     */
+    std::vector<bool> bulk_contains(uint64_t const value) const
+    {
+        std::vector<uint64_t> words(bin_words);
+        and_rows(value, words);
+
+        std::vector<bool> result(bins_);
+        for (size_t bin = 0; bin < bins_; ++bin)
+            result[bin] = (words[bin / 64] >> (bin % 64)) & 1u;
+        return result;
+    }
+
+    /*!\brief Counts for each bin the number of values of a range it may contain.
+     * \tparam values_t The type of the values; must model std::ranges::input_range over std::integral values.
+     * \param[in] values The values, e.g. the k-mer hash values of a query.
+     * \returns The count of each bin.
+     *
+     * ### Complexity
+     *
+     * \f$O(h \cdot b / 64)\f$ per value for h hash functions and b bins, plus the number of counted bins.
+     */
+    template <std::ranges::input_range values_t>
+    std::vector<size_t> bulk_count(values_t && values) const
+    {
+        static_assert(std::integral<value_type_t<values_t>>, "The values must be integral, e.g. k-mer hash values.");
+
+        std::vector<size_t> counts(bins_, 0);
+        std::vector<uint64_t> words(bin_words);
+
+        for (uint64_t const value : values)
+        {
+            and_rows(value, words);
+
+            for (size_t w = 0; w < bin_words; ++w)
+            {
+                for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1)
+                    ++counts[64 * w + detail::count_trailing_zeros(bits)];
+            }
+        }
+
+        return counts;
+    }
+
+    /*!\brief Determines the bins that may contain a query with at most `errors` errors.
+     * \tparam query_t The type of the query; must model std::ranges::forward_range over a seqan3::semialphabet.
+     * \param[in] query      The query.
+     * \param[in] kmer_shape The shape of the k-mers the filter was constructed with.
+     * \param[in] errors     The maximal number of errors.
+     * \returns The bins in ascending order whose k-mer count reaches seqan3::kmer_lemma_threshold; all bins if the
+     *          threshold is 0.
+     */
+    template <std::ranges::forward_range query_t>
+    std::vector<size_t> select_bins(query_t && query, shape const & kmer_shape, uint8_t const errors) const
+    {
+        static_assert(semialphabet<reference_t<query_t>>, "The query must be over a semialphabet.");
+
+        size_t const length = std::ranges::distance(query);
+        size_t const threshold = kmer_lemma_threshold(length, kmer_shape, errors);
+
+        std::vector<size_t> selected;
+
+        if (threshold == 0)
+        {
+            selected.resize(bins_);
+            std::iota(selected.begin(), selected.end(), 0);
+            return selected;
+        }
+
+        std::vector<size_t> const counts = bulk_count(query | views::kmer_hash(kmer_shape));
+        for (size_t bin = 0; bin < bins_; ++bin)
+            if (counts[bin] >= threshold)
+                selected.push_back(bin);
+
+        return selected;
+    }
+
+    //!\brief Compares two filters.
+    bool operator==(interleaved_bloom_filter const & rhs) const noexcept
+    {
+        return std::tie(bins_, bin_size_, hash_funs, data) ==
+               std::tie(rhs.bins_, rhs.bin_size_, rhs.hash_funs, rhs.data);
+    }
+
+    //!\brief Compares two filters.
+    bool operator!=(interleaved_bloom_filter const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(bins_, bin_size_, hash_funs, bin_words, hash_shift, data);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
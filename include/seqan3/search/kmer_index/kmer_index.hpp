@@ -0,0 +1,381 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::kmer_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/kmer_index/detail/kmer_position_table.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/std/ranges>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3
+{
+
+/*!\brief A hash-based index that stores the text positions of all k-mers of a text or text collection.
+ * \ingroup submodule_kmer_index
+ * \tparam alphabet_t        The alphabet type; must model seqan3::semialphabet.
+ * \tparam text_layout_mode_ Indicates whether this index works on a text collection or a single text.
+ *                           See seqan3::text_layout.
+ *
+ * \details
+ *
+ * The k-mers are determined by a seqan3::shape and hashed with seqan3::views::kmer_hash. The positions of all k-mers
+ * are stored in one array, grouped by k-mer and sorted by position within each group (compressed sparse row layout).
+ * The begin of each group is looked up
+ *
+ *   * directly by the hash value if the number of possible hash values \f$\sigma^w\f$ (\f$w\f$ being the number of
+ *     `1`s of the shape) does not exceed twice the number of k-mers, or
+ *   * in an open addressing hash table with linear probing that only stores the hash values occurring in the text.
+ *
+ * Hence, locating all occurrences of a k-mer takes constant expected time, independent of the size of the text.
+ * In contrast to the seqan3::fm_index, the k-mer index only answers queries whose length is the size of its shape,
+ * which makes it suited for seeding with short k-mers.
+ *
+ * K-mers never span two texts of a collection. The index does not store the text itself.
+ *
+ * \include test/snippet/search/kmer_index/kmer_index.cpp
+ */
+template <semialphabet alphabet_t, text_layout text_layout_mode_>
+class kmer_index
+{
+public:
+    //!\brief Indicates whether index is built over a collection.
+    static constexpr text_layout text_layout_mode = text_layout_mode_;
+
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the underlying character of the indexed text.
+    using char_type = alphabet_t;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = uint64_t;
+    //!\brief The type of a hit: a text position or a pair of text index and text position.
+    using hit_type = std::conditional_t<text_layout_mode == text_layout::collection,
+                                        std::pair<size_type, size_type>,
+                                        size_type>;
+    //!\}
+
+private:
+    //!\brief The shape of the k-mers.
+    shape kmer_shape_{};
+    //!\brief The positions of all k-mers, grouped by k-mer.
+    detail::kmer_position_table table{};
+    //!\brief The position of the first character of each text in the concatenation of all texts.
+    std::vector<size_type> text_begin{};
+
+    //!\brief Returns the hash value of a k-mer as computed by seqan3::views::kmer_hash.
+    template <std::ranges::range kmer_t>
+    size_type hash(kmer_t && kmer) const
+    {
+        static_assert(std::convertible_to<reference_t<kmer_t>, alphabet_t>,
+                      "The alphabet of the query must be convertible to the alphabet of the index.");
+
+        if (static_cast<size_t>(std::ranges::distance(kmer)) != kmer_shape_.size())
+            throw std::invalid_argument{"The length of a query must be the size of the shape of the kmer_index."};
+
+        size_type value{0};
+        auto it = std::ranges::begin(kmer);
+        for (size_t i = 0; i < kmer_shape_.size(); ++i, ++it)
+            if (kmer_shape_[i])
+                value = value * alphabet_size<alphabet_t> + to_rank(static_cast<alphabet_t>(*it));
+
+        return value;
+    }
+
+    //!\brief Converts a position in the concatenation of all texts into a hit.
+    hit_type to_hit(size_type const position) const noexcept
+    {
+        if constexpr (text_layout_mode == text_layout::collection)
+        {
+            size_type const text_id = std::upper_bound(text_begin.begin(), text_begin.end(), position) -
+                                      text_begin.begin() - 1;
+            return {text_id, position - text_begin[text_id]};
+        }
+        else
+        {
+            return position;
+        }
+    }
+
+    /*!\brief Constructs the index.
+     * \param[in] texts        The texts to index.
+     * \param[in] thread_count The number of threads.
+     *
+     * \details
+     *
+     * 1. The hash values of all k-mers are computed concurrently; each thread hashes a contiguous part of the texts.
+     * 2. The (hash value, position) pairs are grouped by k-mer in a seqan3::detail::kmer_position_table.
+     */
+    template <typename texts_t>
+    void construct(texts_t const & texts, uint32_t thread_count)
+    {
+        thread_count = std::max<uint32_t>(thread_count, 1);
+        size_t const k = kmer_shape_.size();
+
+        if (k == 0)
+            throw std::invalid_argument{"The shape of a kmer_index cannot be empty."};
+
+        // Checked here because the hashing threads must not throw.
+        if (k > 64 / std::log2(alphabet_size<alphabet_t>))
+            throw std::invalid_argument{"The chosen shape/alphabet combination is not valid. "
+                                        "The alphabet or shape size must be reduced."};
+
+        // Begin of each text and of its k-mers in the array of all k-mers.
+        std::vector<size_type> kmer_begin{0};
+        text_begin.clear();
+        size_type text_size{0};
+        for (auto && text : texts)
+        {
+            size_type const length = std::ranges::distance(text);
+            text_begin.push_back(text_size);
+            text_size += length;
+            kmer_begin.push_back(kmer_begin.back() + (length >= k ? length - k + 1 : 0));
+        }
+
+        size_type const kmer_count = kmer_begin.back();
+
+        // 1. hash all k-mers
+        std::vector<std::pair<size_type, size_type>> kmers(kmer_count);
+        size_type const chunk_size = (kmer_count + thread_count - 1) / thread_count;
+
+        detail::kmer_index_run_parallel(thread_count, [&] (uint32_t const thread_id)
+        {
+            size_type const chunk_begin = std::min<size_type>(thread_id * chunk_size, kmer_count);
+            size_type const chunk_end = std::min<size_type>(chunk_begin + chunk_size, kmer_count);
+
+            size_t text_id = std::upper_bound(kmer_begin.begin(), kmer_begin.end(), chunk_begin) -
+                             kmer_begin.begin() - 1;
+            auto text_it = std::ranges::begin(texts);
+            std::ranges::advance(text_it, text_id);
+
+            for (size_type i = chunk_begin; i < chunk_end; ++text_id, ++text_it)
+            {
+                size_type const end = std::min(chunk_end, kmer_begin[text_id + 1]);
+                if (i == end)
+                    continue;
+
+                auto hashes = *text_it | views::kmer_hash(kmer_shape_);
+                auto hash_it = std::ranges::next(std::ranges::begin(hashes), i - kmer_begin[text_id]);
+
+                for (; i < end; ++i, ++hash_it)
+                    kmers[i] = {*hash_it, text_begin[text_id] + i - kmer_begin[text_id]};
+            }
+        });
+
+        // 2. group by k-mer
+        long double const hash_space = std::pow(static_cast<long double>(alphabet_size<alphabet_t>),
+                                                static_cast<long double>(kmer_shape_.count()));
+        table.construct(kmers, hash_space, thread_count);
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_index() = default;                               //!< Defaulted.
+    kmer_index(kmer_index const &) = default;             //!< Defaulted.
+    kmer_index(kmer_index &&) = default;                  //!< Defaulted.
+    kmer_index & operator=(kmer_index const &) = default; //!< Defaulted.
+    kmer_index & operator=(kmer_index &&) = default;      //!< Defaulted.
+    ~kmer_index() = default;                              //!< Defaulted.
+
+    /*!\brief Constructs the index over a text or text collection.
+     * \tparam text_t The type of the text; must model std::ranges::forward_range (over std::ranges::forward_range
+     *                for text collections).
+     * \param[in] text         The text or text collection to index.
+     * \param[in] kmer_shape  The shape of the k-mers.
+     * \param[in] thread_count The number of threads used for the construction.
+     * \throws std::invalid_argument if the shape is empty or the hash values of the shape/alphabet combination
+     *         cannot be represented in `uint64_t`.
+     *
+     * ### Complexity
+     *
+     * \f$O(n \log n)\f$ for \f$n\f$ k-mers.
+     */
+    template <std::ranges::range text_t>
+    kmer_index(text_t && text, shape const & kmer_shape, uint32_t const thread_count = 1) : kmer_shape_{kmer_shape}
+    {
+        static_assert(std::ranges::forward_range<text_t>, "The text must model forward_range.");
+        static_assert(dimension_v<text_t> == (text_layout_mode == text_layout::collection ? 2 : 1),
+                      "The dimension of the text does not match the text layout of the kmer_index.");
+        static_assert(std::convertible_to<innermost_value_type_t<text_t>, alphabet_t>,
+                     "The alphabet of the text must be convertible to the alphabet of the index.");
+
+        if constexpr (text_layout_mode == text_layout::collection)
+            construct(text, thread_count);
+        else
+            construct(std::array{std::views::all(text)}, thread_count);
+    }
+    //!\}
+
+    //!\brief Returns the shape of the k-mers.
+    shape const & kmer_shape() const noexcept
+    {
+        return kmer_shape_;
+    }
+
+    //!\brief Returns the number of k-mers in the index.
+    size_type size() const noexcept
+    {
+        return table.size();
+    }
+
+    //!\brief Checks whether the index is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the number of occurrences of a k-mer.
+     * \param[in] kmer The k-mer; its length must be the size of the shape.
+     * \throws std::invalid_argument if the length of `kmer` is not the size of the shape.
+     *
+     * ### Complexity
+     *
+     * Expected constant.
+     */
+    template <std::ranges::forward_range kmer_t>
+    size_type count(kmer_t && kmer) const
+    {
+        return table.count(hash(kmer));
+    }
+
+    /*!\brief Returns the occurrences of a k-mer in ascending order.
+     * \param[in] kmer The k-mer; its length must be the size of the shape.
+     * \returns The text positions for a single text; pairs of text index and text position for a text collection.
+     * \throws std::invalid_argument if the length of `kmer` is not the size of the shape.
+     *
+     * ### Complexity
+     *
+     * Expected constant plus linear in the number of occurrences.
+     */
+    template <std::ranges::forward_range kmer_t>
+    std::vector<hit_type> locate(kmer_t && kmer) const
+    {
+        auto [first, last] = table.equal_range(hash(kmer));
+
+        std::vector<hit_type> hits;
+        hits.reserve(last - first);
+        for (; first != last; ++first)
+            hits.push_back(to_hit(*first));
+
+        return hits;
+    }
+
+    //!\brief Compares two indices.
+    bool operator==(kmer_index const & rhs) const noexcept
+    {
+        return std::tie(kmer_shape_, table, text_begin) == std::tie(rhs.kmer_shape_, rhs.table, rhs.text_begin);
+    }
+
+    //!\brief Compares two indices.
+    bool operator!=(kmer_index const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(kmer_shape_, table, text_begin);
+
+        auto sigma = alphabet_size<alphabet_t>;
+        archive(sigma);
+        if (sigma != alphabet_size<alphabet_t>)
+        {
+            throw std::logic_error{"The kmer_index was built over an alphabet of size " + std::to_string(sigma) +
+                                   " but it is being read into a kmer_index with an alphabet of size " +
+                                   std::to_string(alphabet_size<alphabet_t>) + "."};
+        }
+
+        bool tmp = text_layout_mode;
+        archive(tmp);
+        if (tmp != text_layout_mode)
+        {
+            throw std::logic_error{std::string{"The kmer_index was built over a "} +
+                                   (tmp ? "text collection" : "single text") +
+                                   " but it is being read into a kmer_index expecting a " +
+                                   (text_layout_mode ? "text collection." : "single text.")};
+        }
+    }
+    //!\endcond
+};
+
+/*!\name Template argument type deduction guides
+ * \{
+ */
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+kmer_index(text_t &&, shape const &) ->
+    kmer_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+kmer_index(text_t &&, shape const &, uint32_t) ->
+    kmer_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+//!\}
+
+/*!\brief Searches a k-mer or a range of k-mers in a seqan3::kmer_index.
+ * \ingroup submodule_kmer_index
+ * \tparam queries_t The type of a single query or a range of queries; must model std::ranges::forward_range.
+ * \param[in] queries A single k-mer or a range of k-mers. Each k-mer must be as long as the shape of the index.
+ * \param[in] index   The seqan3::kmer_index to search.
+ * \returns The hits of the query (or a `std::vector` with the hits of each query). A hit is a text position for a
+ *          single text and a pair of text index and text position for a text collection, see seqan3::search.
+ * \throws std::invalid_argument if the length of a query is not the size of the shape.
+ *
+ * \details
+ *
+ * The equivalent of seqan3::search without errors for k-mer queries.
+ *
+ * ### Complexity
+ *
+ * Expected constant per query plus linear in the number of hits.
+ */
+template <std::ranges::forward_range queries_t, semialphabet alphabet_t, text_layout text_layout_mode>
+inline auto search(queries_t && queries, kmer_index<alphabet_t, text_layout_mode> const & index)
+{
+    if constexpr (dimension_v<queries_t> == 1u)
+    {
+        return index.locate(queries);
+    }
+    else
+    {
+        std::vector<std::vector<typename kmer_index<alphabet_t, text_layout_mode>::hit_type>> hits;
+        for (auto && query : queries)
+            hits.push_back(index.locate(query));
+        return hits;
+    }
+}
+
+} // namespace seqan3
@@ -0,0 +1,453 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::minimiser_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/kmer_index/detail/kmer_position_table.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/std/ranges>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3
+{
+
+/*!\brief A hash-based index that stores the text positions of the minimisers of a text or text collection.
+ * \ingroup submodule_kmer_index
+ * \tparam alphabet_t        The alphabet type; must model seqan3::semialphabet.
+ * \tparam text_layout_mode_ Indicates whether this index works on a text collection or a single text.
+ *                           See seqan3::text_layout.
+ *
+ * \details
+ *
+ * In contrast to the seqan3::kmer_index, which stores every k-mer, this index only stores the minimisers computed by
+ * seqan3::views::minimiser_hash, i.e. about \f$2 / (w + 1)\f$ of the k-mers for windows of \f$w\f$ k-mers. For
+ * nucleotide alphabets, k-mers are hashed canonically, so a query and its reverse complement find the same minimisers
+ * if the shape is symmetric.
+ *
+ * Any substring of a text that is at least `window_size` characters long contains a minimiser of the text, so each
+ * occurrence of a query of that length is found via at least one of the minimisers of the query. The index therefore
+ * answers
+ *
+ *   * seeding queries: seqan3::minimiser_index::locate reports the occurrences of the minimisers of a query
+ *     together with their positions in the query, and
+ *   * containment queries: seqan3::minimiser_index::containment estimates the fraction of the query that is contained
+ *     in each text from the fraction of the minimisers of the query that occur in the text.
+ *
+ * The positions are stored like in the seqan3::kmer_index. Minimisers never span two texts of a collection. The index
+ * does not store the text itself.
+ *
+ * \include test/snippet/search/kmer_index/minimiser_index.cpp
+ */
+template <semialphabet alphabet_t, text_layout text_layout_mode_>
+class minimiser_index
+{
+public:
+    //!\brief Indicates whether index is built over a collection.
+    static constexpr text_layout text_layout_mode = text_layout_mode_;
+
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the underlying character of the indexed text.
+    using char_type = alphabet_t;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = uint64_t;
+    //!\brief The type of a hit: a text position or a pair of text index and text position.
+    using hit_type = std::conditional_t<text_layout_mode == text_layout::collection,
+                                        std::pair<size_type, size_type>,
+                                        size_type>;
+    //!\brief The type of a seed: the position of a minimiser in the query and a hit of the minimiser.
+    using seed_type = std::pair<size_type, hit_type>;
+    //!\}
+
+private:
+    //!\brief The shape of the k-mers.
+    shape kmer_shape_{};
+    //!\brief The number of characters of a window.
+    uint32_t window_size_{};
+    //!\brief The value the hash values are XOR-ed with.
+    uint64_t seed_{};
+    //!\brief The positions of all minimisers, grouped by minimiser.
+    detail::kmer_position_table table{};
+    //!\brief The position of the first character of each text in the concatenation of all texts.
+    std::vector<size_type> text_begin{};
+
+    //!\brief Returns the minimisers of a range, computed like the minimisers of the text.
+    template <typename rng_t>
+    auto minimisers(rng_t && rng) const
+    {
+        return rng | views::minimiser_hash(kmer_shape_, seqan3::window_size{window_size_}, seqan3::seed{seed_});
+    }
+
+    //!\brief Converts a position in the concatenation of all texts into a hit.
+    hit_type to_hit(size_type const position) const noexcept
+    {
+        if constexpr (text_layout_mode == text_layout::collection)
+        {
+            size_type const text_id = std::upper_bound(text_begin.begin(), text_begin.end(), position) -
+                                      text_begin.begin() - 1;
+            return {text_id, position - text_begin[text_id]};
+        }
+        else
+        {
+            return position;
+        }
+    }
+
+    //!\brief Checks the alphabet of a query.
+    template <typename query_t>
+    static constexpr void check_query() noexcept
+    {
+        static_assert(std::ranges::forward_range<query_t>, "The query must model forward_range.");
+        static_assert(std::convertible_to<reference_t<query_t>, alphabet_t>,
+                      "The alphabet of the query must be convertible to the alphabet of the index.");
+    }
+
+    /*!\brief Constructs the index.
+     * \param[in] texts        The texts to index.
+     * \param[in] thread_count The number of threads.
+     *
+     * \details
+     *
+     * 1. The minimisers of the texts are computed concurrently; each thread processes every `thread_count`-th text.
+     * 2. The (hash value, position) pairs are grouped by minimiser in a seqan3::detail::kmer_position_table.
+     */
+    template <typename texts_t>
+    void construct(texts_t const & texts, uint32_t thread_count)
+    {
+        thread_count = std::max<uint32_t>(thread_count, 1);
+
+        if (kmer_shape_.size() == 0)
+            throw std::invalid_argument{"The shape of a minimiser_index cannot be empty."};
+
+        // Checked here because the threads must not throw.
+        if (kmer_shape_.size() > 64 / std::log2(alphabet_size<alphabet_t>))
+            throw std::invalid_argument{"The chosen shape/alphabet combination is not valid. "
+                                        "The alphabet or shape size must be reduced."};
+
+        if (window_size_ < kmer_shape_.size())
+            throw std::invalid_argument{"The window of a minimiser_index must not be smaller than the shape."};
+
+        text_begin.clear();
+        size_type text_size{0};
+        for (auto && text : texts)
+        {
+            text_begin.push_back(text_size);
+            text_size += std::ranges::distance(text);
+        }
+
+        // 1. compute the minimisers
+        std::vector<std::vector<std::pair<size_type, size_type>>> thread_minimisers(thread_count);
+
+        detail::kmer_index_run_parallel(thread_count, [&] (uint32_t const thread_id)
+        {
+            auto & result = thread_minimisers[thread_id];
+            size_t text_id{0};
+            for (auto && text : texts)
+            {
+                if (text_id % thread_count == thread_id &&
+                    static_cast<size_type>(std::ranges::distance(text)) >= window_size_)
+                {
+                    auto && mins = minimisers(text);
+                    for (auto it = std::ranges::begin(mins); it != std::ranges::end(mins); ++it)
+                        result.emplace_back(*it, text_begin[text_id] + it.position());
+                }
+                ++text_id;
+            }
+        });
+
+        std::vector<std::pair<size_type, size_type>> entries;
+        size_type entry_count{0};
+        for (auto const & result : thread_minimisers)
+            entry_count += result.size();
+        entries.reserve(entry_count);
+        for (auto & result : thread_minimisers)
+        {
+            entries.insert(entries.end(), result.begin(), result.end());
+            std::vector<std::pair<size_type, size_type>>{}.swap(result);
+        }
+
+        // 2. group by minimiser; the seeded hash values can take any 64 bit value
+        long double const hash_space = std::numeric_limits<uint64_t>::max() + 1.0L;
+        table.construct(entries, hash_space, thread_count);
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    minimiser_index() = default;                                    //!< Defaulted.
+    minimiser_index(minimiser_index const &) = default;             //!< Defaulted.
+    minimiser_index(minimiser_index &&) = default;                  //!< Defaulted.
+    minimiser_index & operator=(minimiser_index const &) = default; //!< Defaulted.
+    minimiser_index & operator=(minimiser_index &&) = default;      //!< Defaulted.
+    ~minimiser_index() = default;                                   //!< Defaulted.
+
+    /*!\brief Constructs the index over a text or text collection.
+     * \tparam text_t The type of the text; must model std::ranges::forward_range (over std::ranges::forward_range
+     *                for text collections).
+     * \param[in] text         The text or text collection to index.
+     * \param[in] kmer_shape   The shape of the k-mers.
+     * \param[in] window       The number of characters of a window; must not be less than the size of the shape.
+     * \param[in] seed_value   The value the hash values are XOR-ed with; queries are hashed with the same value.
+     * \param[in] thread_count The number of threads used for the construction.
+     * \throws std::invalid_argument if the shape is empty, the window is smaller than the shape or the hash values of
+     *         the shape/alphabet combination cannot be represented in `uint64_t`.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the text for computing the minimisers plus \f$O(m \log m)\f$ for \f$m\f$ minimisers.
+     */
+    template <std::ranges::range text_t>
+    minimiser_index(text_t && text,
+                    shape const & kmer_shape,
+                    seqan3::window_size const window,
+                    seqan3::seed const seed_value = seqan3::seed{detail::minimiser_hash_fn::default_seed},
+                    uint32_t const thread_count = 1) :
+        kmer_shape_{kmer_shape}, window_size_{window.get()}, seed_{seed_value.get()}
+    {
+        static_assert(std::ranges::forward_range<text_t>, "The text must model forward_range.");
+        static_assert(dimension_v<text_t> == (text_layout_mode == text_layout::collection ? 2 : 1),
+                      "The dimension of the text does not match the text layout of the minimiser_index.");
+        static_assert(std::convertible_to<innermost_value_type_t<text_t>, alphabet_t>,
+                     "The alphabet of the text must be convertible to the alphabet of the index.");
+
+        if constexpr (text_layout_mode == text_layout::collection)
+            construct(text, thread_count);
+        else
+            construct(std::array{std::views::all(text)}, thread_count);
+    }
+    //!\}
+
+    //!\brief Returns the shape of the k-mers.
+    shape const & kmer_shape() const noexcept
+    {
+        return kmer_shape_;
+    }
+
+    //!\brief Returns the number of characters of a window.
+    seqan3::window_size window_size() const noexcept
+    {
+        return seqan3::window_size{window_size_};
+    }
+
+    //!\brief Returns the value the hash values are XOR-ed with.
+    seqan3::seed seed() const noexcept
+    {
+        return seqan3::seed{seed_};
+    }
+
+    //!\brief Returns the number of minimisers in the index.
+    size_type size() const noexcept
+    {
+        return table.size();
+    }
+
+    //!\brief Checks whether the index is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the number of occurrences of the minimisers of a query.
+     * \param[in] query The query; must model std::ranges::forward_range.
+     *
+     * \details
+     *
+     * Queries shorter than the window have no minimisers.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the query.
+     */
+    template <std::ranges::range query_t>
+    size_type count(query_t && query) const
+    {
+        check_query<query_t>();
+
+        size_type result{0};
+        if (static_cast<size_type>(std::ranges::distance(query)) >= window_size_)
+            for (uint64_t const hash_value : minimisers(query))
+                result += table.count(hash_value);
+
+        return result;
+    }
+
+    /*!\brief Returns the occurrences of the minimisers of a query.
+     * \param[in] query The query; must model std::ranges::forward_range.
+     * \returns For each minimiser of the query in order of its position in the query, the pairs of its position in
+     *          the query and its hits in ascending order. A hit is a text position for a single text and a pair of text
+     *          index and text position for a text collection.
+     *
+     * \details
+     *
+     * Since the minimisers are hashed canonically for nucleotide alphabets, a seed can match the reverse complement
+     * of the query.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the query plus linear in the number of hits.
+     */
+    template <std::ranges::range query_t>
+    std::vector<seed_type> locate(query_t && query) const
+    {
+        check_query<query_t>();
+
+        std::vector<seed_type> seeds;
+        if (static_cast<size_type>(std::ranges::distance(query)) < window_size_)
+            return seeds;
+
+        auto && mins = minimisers(query);
+        for (auto it = std::ranges::begin(mins); it != std::ranges::end(mins); ++it)
+            for (auto [first, last] = table.equal_range(*it); first != last; ++first)
+                seeds.emplace_back(it.position(), to_hit(*first));
+
+        return seeds;
+    }
+
+    /*!\brief Estimates the fraction of a query that is contained in each text.
+     * \param[in] query The query; must model std::ranges::forward_range.
+     * \returns The fraction of the minimisers of the query that occur in the text (a `std::vector` with one fraction
+     *          per text for a text collection). 0 if the query has no minimisers.
+     *
+     * \details
+     *
+     * The fraction of shared minimisers is an estimate of the fraction of shared k-mers (containment index).
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the query plus linear in the number of hits.
+     */
+    template <std::ranges::range query_t>
+    auto containment(query_t && query) const
+    {
+        check_query<query_t>();
+
+        std::vector<size_type> shared(text_layout_mode == text_layout::collection ? text_begin.size() : 1, 0);
+        size_type minimiser_count{0};
+
+        if (static_cast<size_type>(std::ranges::distance(query)) >= window_size_)
+        {
+            std::vector<size_type> last_query_minimiser(shared.size(), std::numeric_limits<size_type>::max());
+
+            for (uint64_t const hash_value : minimisers(query))
+            {
+                for (auto [first, last] = table.equal_range(hash_value); first != last; ++first)
+                {
+                    size_type text_id{0};
+                    if constexpr (text_layout_mode == text_layout::collection)
+                        text_id = to_hit(*first).first;
+
+                    // a minimiser occurring several times in a text counts once
+                    if (last_query_minimiser[text_id] != minimiser_count)
+                    {
+                        last_query_minimiser[text_id] = minimiser_count;
+                        ++shared[text_id];
+                    }
+                }
+                ++minimiser_count;
+            }
+        }
+
+        std::vector<double> fractions(shared.size(), 0.0);
+        if (minimiser_count != 0)
+            for (size_t i = 0; i < shared.size(); ++i)
+                fractions[i] = static_cast<double>(shared[i]) / minimiser_count;
+
+        if constexpr (text_layout_mode == text_layout::collection)
+            return fractions;
+        else
+            return fractions[0];
+    }
+
+    //!\brief Compares two indices.
+    bool operator==(minimiser_index const & rhs) const noexcept
+    {
+        return std::tie(kmer_shape_, window_size_, seed_, table, text_begin) ==
+               std::tie(rhs.kmer_shape_, rhs.window_size_, rhs.seed_, rhs.table, rhs.text_begin);
+    }
+
+    //!\brief Compares two indices.
+    bool operator!=(minimiser_index const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(kmer_shape_, window_size_, seed_, table, text_begin);
+
+        auto sigma = alphabet_size<alphabet_t>;
+        archive(sigma);
+        if (sigma != alphabet_size<alphabet_t>)
+        {
+            throw std::logic_error{"The minimiser_index was built over an alphabet of size " + std::to_string(sigma) +
+                                   " but it is being read into a minimiser_index with an alphabet of size " +
+                                   std::to_string(alphabet_size<alphabet_t>) + "."};
+        }
+
+        bool tmp = text_layout_mode;
+        archive(tmp);
+        if (tmp != text_layout_mode)
+        {
+            throw std::logic_error{std::string{"The minimiser_index was built over a "} +
+                                   (tmp ? "text collection" : "single text") +
+                                   " but it is being read into a minimiser_index expecting a " +
+                                   (text_layout_mode ? "text collection." : "single text.")};
+        }
+    }
+    //!\endcond
+};
+
+/*!\name Template argument type deduction guides
+ * \{
+ */
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+minimiser_index(text_t &&, shape const &, window_size) ->
+    minimiser_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+minimiser_index(text_t &&, shape const &, window_size, seed) ->
+    minimiser_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+minimiser_index(text_t &&, shape const &, window_size, seed, uint32_t) ->
+    minimiser_index<innermost_value_type_t<text_t>, text_layout{dimension_v<text_t> != 1}>;
+//!\}
+
+} // namespace seqan3
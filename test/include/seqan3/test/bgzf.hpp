@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::test::decompress_bgzf.
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/io/detail/magic_header.hpp>
+
+namespace seqan3::test
+{
+
+/*!\brief Checks the block frame of BGZF compressed bytes and returns the decompressed bytes.
+ * \param[in] compressed The BGZF compressed bytes.
+ * \returns The decompressed bytes.
+ *
+ * \details
+ *
+ * The compressed blocks depend on the DEFLATE implementation (zlib, zlib-ng or libdeflate) and its version, hence the
+ * tests compare the decompressed bytes. Only the frame is checked byte by byte: the first block begins with a BGZF
+ * header and the last block is the end-of-file marker.
+ */
+inline std::string decompress_bgzf(std::string const & compressed)
+{
+    auto const & header = detail::bgzf_compression::magic_header;
+    auto const & eof_marker = contrib::BGZF_END_OF_FILE_MARKER;
+
+    EXPECT_GE(compressed.size(), header.size() + eof_marker.size());
+    if (compressed.size() >= header.size() + eof_marker.size())
+    {
+        // everything but MTIME, XFL, OS and BSIZE
+        EXPECT_EQ(compressed.substr(0, 4), std::string(header.data(), 4));
+        EXPECT_EQ(compressed.substr(10, 6), std::string(header.data() + 10, 6));
+        EXPECT_EQ(compressed.substr(compressed.size() - eof_marker.size()),
+                  std::string(eof_marker.data(), eof_marker.size()));
+    }
+
+    std::istringstream in{compressed};
+    contrib::bgzf_istream decompressed{in};
+    return std::string{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}};
+}
+
+} // namespace seqan3::test
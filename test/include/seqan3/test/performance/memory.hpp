@@ -0,0 +1,71 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides functions to measure the memory consumption of a benchmark.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+
+#include <seqan3/core/platform.hpp>
+
+#if __has_include(<sys/resource.h>)
+#include <sys/resource.h>
+#endif
+
+namespace seqan3::test
+{
+
+/*!\brief Returns the peak resident set size of the process in bytes, 0 if it cannot be determined.
+ *
+ * \details
+ *
+ * On Linux, the value is read from `/proc/self/status` (`VmHWM`) and can be reset with
+ * seqan3::test::reset_peak_resident_memory. Otherwise, the maximum resident set size reported by `getrusage` is
+ * returned, which cannot be reset.
+ */
+inline size_t peak_resident_memory()
+{
+    std::ifstream status{"/proc/self/status"};
+    for (std::string line; std::getline(status, line);)
+        if (line.rfind("VmHWM:", 0) == 0)
+            return std::stoull(line.substr(6)) * 1024; // in kB
+
+#if __has_include(<sys/resource.h>)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#   if defined(__APPLE__)
+        return usage.ru_maxrss; // in bytes
+#   else
+        return usage.ru_maxrss * 1024; // in kB
+#   endif
+    }
+#endif
+
+    return 0;
+}
+
+/*!\brief Resets the peak resident set size to the current resident set size.
+ * \returns `true` if the peak was reset, `false` if this is not supported (Linux only).
+ *
+ * \details
+ *
+ * Call this before the code whose peak memory consumption is measured with seqan3::test::peak_resident_memory.
+ */
+inline bool reset_peak_resident_memory()
+{
+    std::ofstream clear_refs{"/proc/self/clear_refs"};
+    clear_refs << "5";
+    clear_refs.close();
+    return static_cast<bool>(clear_refs);
+}
+
+} // namespace seqan3::test
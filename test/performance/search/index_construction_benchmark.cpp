@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/test/performance/memory.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+#if SEQAN3_WITH_CEREAL
+#include <cereal/archives/binary.hpp>
+#endif
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+// The text of length `length`; a collection is split into 10 texts.
+template <text_layout layout>
+auto generate_text(size_t const length)
+{
+    if constexpr (layout == text_layout::single)
+    {
+        return generate_sequence<dna4>(length, 0, 0);
+    }
+    else
+    {
+        std::vector<std::vector<dna4>> texts;
+        for (size_t i = 0; i < 10; ++i)
+            texts.push_back(generate_sequence<dna4>(length / 10, 0, i));
+        return texts;
+    }
+}
+
+//============================================================================
+//  construction time, peak memory and size of fm_index and bi_fm_index
+//============================================================================
+
+template <bool bidirectional, text_layout layout>
+void index_construction(benchmark::State & state)
+{
+    size_t const text_length = state.range(0);
+    auto text = generate_text<layout>(text_length);
+
+    fm_index_construction_options options{};
+    options.thread_count = state.range(1);
+
+    auto construct = [&] ()
+    {
+        if constexpr (bidirectional)
+            return bi_fm_index{text, options};
+        else
+            return fm_index{text, options};
+    };
+
+    // Absolute peak resident memory of the process during a construction, i.e. including the text. The difference to
+    // the memory in use before is too low, because the allocator keeps the memory of the previous index resident.
+    size_t peak_memory{0};
+    bool const can_reset_peak = reset_peak_resident_memory();
+
+    for (auto _ : state)
+    {
+        reset_peak_resident_memory();
+
+        auto index = construct();
+        benchmark::DoNotOptimize(index);
+
+        peak_memory = std::max(peak_memory, peak_resident_memory());
+    }
+
+    state.counters["bytes/s"] = bytes_per_second(text_length);
+    if (can_reset_peak)
+        state.counters["peak_memory_bytes"] = peak_memory;
+
+#if SEQAN3_WITH_CEREAL
+    std::ostringstream stream{};
+    {
+        auto index = construct();
+        cereal::BinaryOutputArchive archive{stream};
+        archive(index);
+    }
+    state.counters["index_bytes"] = stream.str().size();
+    state.counters["index_bytes_per_character"] = static_cast<double>(stream.str().size()) / text_length;
+#endif
+}
+
+// text length, threads (only the bi_fm_index builds its two indices concurrently)
+BENCHMARK_TEMPLATE(index_construction, false, text_layout::single)->Args({1'000'000, 1})->Args({10'000'000, 1});
+BENCHMARK_TEMPLATE(index_construction, false, text_layout::collection)->Args({1'000'000, 1})->Args({10'000'000, 1});
+BENCHMARK_TEMPLATE(index_construction, true, text_layout::single)->Args({1'000'000, 1})->Args({1'000'000, 2})
+                                                                ->Args({10'000'000, 1})->Args({10'000'000, 2});
+BENCHMARK_TEMPLATE(index_construction, true, text_layout::collection)->Args({1'000'000, 1})->Args({1'000'000, 2})
+                                                                    ->Args({10'000'000, 1})->Args({10'000'000, 2});
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
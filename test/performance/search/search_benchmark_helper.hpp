@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/range/views/join.hpp>
+#include <seqan3/range/views/persist.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/search/algorithm/all.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+namespace seqan3::test
+{
+
+struct options
+{
+    size_t const sequence_length;
+    bool const has_repeats;
+    size_t const number_of_reads;
+    size_t const read_length;
+    double const prob_insertion;
+    double const prob_deletion;
+    uint8_t const simulated_errors;
+    uint8_t const searched_errors;
+    uint8_t const strata;
+    double const stddev{0};
+    uint32_t repeats{20};
+};
+
+template <alphabet alphabet_t>
+void mutate_substitution(std::vector<alphabet_t> & seq, size_t const pos, uint8_t alphabet_rank)
+{
+    alphabet_t & cbase = seq[pos];
+    if (alphabet_rank >= to_rank(cbase))
+        ++alphabet_rank;
+    cbase.assign_rank(alphabet_rank);
+}
+
+template <alphabet alphabet_t>
+void mutate_insertion(std::vector<alphabet_t> & seq, size_t const pos, uint8_t const alphabet_rank)
+{
+    seq.insert(std::ranges::begin(seq) + pos, alphabet_t{}.assign_rank(alphabet_rank));
+}
+
+template <alphabet alphabet_t>
+void mutate_deletion(std::vector<alphabet_t> & seq, size_t const pos)
+{
+    seq.erase(std::ranges::begin(seq) + pos);
+}
+
+template <alphabet alphabet_t>
+std::vector<std::vector<alphabet_t>> generate_reads(std::vector<alphabet_t> const & ref,
+                                                    size_t const number_of_reads,
+                                                    size_t const read_length,
+                                                    uint8_t const simulated_errors_,
+                                                    double const prob_insertion,
+                                                    double const prob_deletion,
+                                                    double const stddev = 0,
+                                                    size_t const seed = 0)
+{
+    std::vector<std::vector<alphabet_t>> reads;
+    std::mt19937_64 gen{seed};
+
+    std::normal_distribution<> dis_error_count{static_cast<double>(simulated_errors_), stddev};
+
+    // mutation distributions
+    std::uniform_real_distribution<double> mutation_type_prob{0.0, 1.0};
+    // position
+    std::uniform_int_distribution<size_t> random_mutation_pos{0, read_length - 1};
+    // substitution
+    std::uniform_int_distribution<uint8_t> dis_alpha_short{0, alphabet_size<alphabet_t> - 2};
+    // insertion
+    std::uniform_int_distribution<uint8_t> dis_alpha{0, alphabet_size<alphabet_t> - 1};
+
+    for (size_t i = 0; i < number_of_reads; ++i)
+    {
+        // simulate concrete error number or use normal distribution
+        uint8_t simulated_errors = (stddev == 0) ? simulated_errors_ :
+                                                   std::abs(std::round(dis_error_count(gen)));
+
+        std::uniform_int_distribution<size_t> random_read_pos{0, std::ranges::size(ref) - read_length - simulated_errors};
+        size_t rpos = random_read_pos(gen);
+        std::vector<alphabet_t> read_tmp{std::ranges::begin(ref) + rpos,
+                                         std::ranges::begin(ref) + rpos + read_length + simulated_errors};
+
+        // generate simulated_errors many unique random mutation positions
+        std::set<size_t> mutation_positions;
+        if (read_length > simulated_errors){
+            while (mutation_positions.size() < simulated_errors)
+                mutation_positions.insert(random_mutation_pos(gen));
+        }
+        else
+        {
+            for(size_t i = 0; i < simulated_errors; ++i)
+                mutation_positions.insert(i);
+        }
+
+        for (std::set<size_t>::iterator pos_it = mutation_positions.begin(); pos_it != mutation_positions.end(); ++pos_it)
+        {
+            size_t ppos = *pos_it;
+            double prob = mutation_type_prob(gen);
+            // Substitution
+            if (prob_insertion + prob_deletion < prob)
+                mutate_substitution(read_tmp, ppos, dis_alpha_short(gen));
+            // Insertion
+            else if (prob_insertion < prob)
+                mutate_insertion(read_tmp, ppos, dis_alpha(gen));
+            // Deletion
+            else
+                mutate_deletion(read_tmp, ppos);
+        }
+
+        read_tmp.erase(std::ranges::begin(read_tmp) + read_length, std::ranges::end(read_tmp));
+        reads.push_back(read_tmp);
+    }
+
+    return reads;
+}
+
+template <typename alphabet_t>
+std::vector<alphabet_t> generate_repeating_sequence(size_t const template_length = 5000,
+                                                    size_t const repeats = 20,
+                                                    double const template_fraction = 1,
+                                                    size_t const seed = 0)
+{
+    std::vector<alphabet_t> seq_template = generate_sequence<alphabet_t>(template_length, 0, seed);
+
+    // copy substrings of length len from seq_template mutate and concatenate them
+    size_t len = std::round(template_length * template_fraction);
+    uint8_t simulated_errors = 5;
+    len = (len + simulated_errors  > template_length) ? template_length - simulated_errors : len;
+
+    return generate_reads(seq_template, repeats, len, simulated_errors, 0.15, 0.15)
+         | views::persist
+         | views::join
+         | views::to<std::vector>;
+}
+
+//!\brief A counter of events per second, e.g. queries or hits, for `count` events per benchmark iteration.
+inline benchmark::Counter per_second(size_t const count)
+{
+    return benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+//!\brief The number of hits of the results of seqan3::search over a range of queries.
+template <typename results_t>
+size_t hit_count(results_t const & results)
+{
+    size_t hits{0};
+    for (auto const & query_results : results)
+    {
+        for (auto const & result : query_results)
+        {
+            if constexpr (std::integral<remove_cvref_t<decltype(result)>> ||
+                          tuple_like<remove_cvref_t<decltype(result)>>)
+                ++hits;                  // a text position
+            else
+                hits += result.count();  // an index cursor
+        }
+    }
+    return hits;
+}
+
+/*!\brief Searches the reads concurrently; each thread searches a contiguous part of the reads.
+ * \returns The number of hits.
+ */
+template <typename index_t, typename configuration_t>
+size_t parallel_search(std::vector<std::vector<std::vector<dna4>>> const & read_parts,
+                       index_t const & index,
+                       configuration_t const & cfg)
+{
+    std::vector<size_t> hits(read_parts.size(), 0);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 1; t < read_parts.size(); ++t)
+        threads.emplace_back([&, t] () { hits[t] = hit_count(search(read_parts[t], index, cfg)); });
+
+    hits[0] = hit_count(search(read_parts[0], index, cfg));
+
+    for (auto & thread : threads)
+        thread.join();
+
+    return std::accumulate(hits.begin(), hits.end(), size_t{0});
+}
+
+//!\brief Splits the reads into `part_count` contiguous parts of (almost) equal size.
+template <typename reads_t>
+std::vector<reads_t> split_reads(reads_t const & reads, size_t const part_count)
+{
+    std::vector<reads_t> parts(part_count);
+    size_t const part_size = (reads.size() + part_count - 1) / part_count;
+    for (size_t i = 0; i < reads.size(); ++i)
+        parts[i / part_size].push_back(reads[i]);
+    return parts;
+}
+
+/*!\brief Measures the search of the reads and reports queries/s, hits/s and bytes/s of the reads.
+ *
+ * \details
+ *
+ * The hits are counted in an additional search after the measurement, so counting does not affect the timings.
+ */
+template <typename index_t, typename configuration_t>
+void run_search_benchmark(benchmark::State & state,
+                          std::vector<std::vector<dna4>> const & reads,
+                          index_t const & index,
+                          configuration_t const & cfg)
+{
+    for (auto _ : state)
+    {
+        auto results = search(reads, index, cfg);
+        benchmark::DoNotOptimize(results);
+    }
+
+    size_t read_bytes{0};
+    for (auto const & read : reads)
+        read_bytes += read.size();
+
+    size_t const hits = hit_count(search(reads, index, cfg));
+    state.counters["hits"] = hits;
+    state.counters["queries/s"] = per_second(reads.size());
+    state.counters["hits/s"] = per_second(hits);
+    state.counters["bytes/s"] = bytes_per_second(read_bytes);
+}
+
+} // namespace seqan3::test
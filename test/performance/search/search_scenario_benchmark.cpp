@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/algorithm/all.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+#include "search_benchmark_helper.hpp"
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+// reads of length 50 with as many errors as searched; fewer reads for many errors to keep the runtime reasonable
+constexpr size_t read_length = 50;
+
+size_t number_of_reads(uint8_t const errors)
+{
+    return errors <= 2 ? 1000 : 100;
+}
+
+// A text of 1'000'000 characters or a collection of 10 texts with 100'000 characters each, and reads sampled from it.
+template <text_layout layout>
+auto generate_text_and_reads(uint8_t const errors)
+{
+    std::vector<std::vector<dna4>> reads;
+
+    if constexpr (layout == text_layout::single)
+    {
+        std::vector<dna4> text = generate_sequence<dna4>(1'000'000, 0, 0);
+        reads = generate_reads(text, number_of_reads(errors), read_length, errors, 0.15, 0.15);
+        return std::pair{std::move(text), std::move(reads)};
+    }
+    else
+    {
+        std::vector<std::vector<dna4>> texts;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            texts.push_back(generate_sequence<dna4>(100'000, 0, i));
+            std::ranges::move(generate_reads(texts.back(), number_of_reads(errors) / 10, read_length, errors,
+                                             0.15, 0.15, 0, i),
+                              std::ranges::back_inserter(reads));
+        }
+        return std::pair{std::move(texts), std::move(reads)};
+    }
+}
+
+//============================================================================
+//  exact vs 1-4 errors; uni- vs bidirectional; single vs collection;
+//  locate (text positions) vs count-only (index cursors); threads
+//============================================================================
+
+template <bool bidirectional, text_layout layout, bool locate>
+void search_scenario(benchmark::State & state)
+{
+    uint8_t const errors = state.range(0);
+    size_t const thread_count = state.range(1);
+
+    auto [text, reads] = generate_text_and_reads<layout>(errors);
+
+    auto index = [&text = text] ()
+    {
+        if constexpr (bidirectional)
+            return bi_fm_index{text};
+        else
+            return fm_index{text};
+    }();
+
+    configuration const error_cfg = search_cfg::max_error{search_cfg::total{errors}};
+    auto cfg = [&] ()
+    {
+        if constexpr (locate)
+            return error_cfg | search_cfg::output{search_cfg::text_position};
+        else
+            return error_cfg | search_cfg::output{search_cfg::index_cursor};
+    }();
+
+    auto const read_parts = split_reads(reads, thread_count);
+
+    size_t hits{0};
+    for (auto _ : state)
+        hits = parallel_search(read_parts, index, cfg);
+
+    size_t read_bytes{0};
+    for (auto const & read : reads)
+        read_bytes += read.size();
+
+    state.counters["hits"] = hits;
+    state.counters["queries/s"] = per_second(reads.size());
+    state.counters["hits/s"] = per_second(hits);
+    state.counters["bytes/s"] = bytes_per_second(read_bytes);
+}
+
+// Arguments: errors, threads
+void errors_and_threads(benchmark::internal::Benchmark * benchmark)
+{
+    for (int errors = 0; errors <= 4; ++errors)
+        benchmark->Args({errors, 1});
+    for (int threads : {2, 4, 8})
+        benchmark->Args({2, threads});
+}
+
+// unidirectional
+BENCHMARK_TEMPLATE(search_scenario, false, text_layout::single, true)->Apply(errors_and_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(search_scenario, false, text_layout::single, false)->Apply(errors_and_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(search_scenario, false, text_layout::collection, true)->Apply(errors_and_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(search_scenario, false, text_layout::collection, false)->Apply(errors_and_threads)->UseRealTime();
+
+// bidirectional
+BENCHMARK_TEMPLATE(search_scenario, true, text_layout::single, true)->Apply(errors_and_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(search_scenario, true, text_layout::single, false)->Apply(errors_and_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(search_scenario, true, text_layout::collection, true)->Apply(errors_and_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(search_scenario, true, text_layout::collection, false)->Apply(errors_and_threads)->UseRealTime();
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,38 @@
+#include <iostream>
+#include <sstream>
+
+#include <seqan3/io/alignment_file/all.hpp>
+#include <seqan3/std/ranges>
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate	GO:none
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	*	=	37	39	TTAGATAAAGGATACTG	*
+r003	0	ref	29	30	*	*	0	0	GCCTAAGCTAA	*	SA:Z:ref,29,-,6H5M,17,0;
+r003	2064	ref	29	17	*	*	0	0	TAGGC	*	SA:Z:ref,9,+,5S6M,30,1;
+r001	147	ref	237	30	*	=	7	-39	CAGCGGCAT	*	NM:i:1
+)";
+
+int main()
+{
+    std::ostringstream bam{};
+
+    { // convert the SAM file to BAM; four threads format the records
+        seqan3::alignment_file_input fin{std::istringstream{sam_file_raw}, seqan3::format_sam{}};
+        seqan3::alignment_file_output fout{bam, seqan3::format_bam{}};
+
+        fout.write_batches(fin, 4);
+    }
+
+    // keep the records with a mapping quality of at least 30
+    // four threads parse the BAM file and four threads format the SAM records; the order of the file is kept
+    seqan3::alignment_file_input fin{std::istringstream{bam.str()}, seqan3::format_bam{}};
+    seqan3::alignment_file_output fout{std::cout, seqan3::format_sam{}};
+
+    fin.read_batches([&fout] (auto & batch)
+    {
+        fout.write_batches(batch | std::views::filter([] (auto & rec)
+        {
+            return seqan3::get<seqan3::field::mapq>(rec) >= 30;
+        }), 4);
+    }, 4);
+}
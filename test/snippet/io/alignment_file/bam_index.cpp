@@ -0,0 +1,46 @@
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/std/filesystem>
+
+using seqan3::operator""_cigar_op;
+using seqan3::operator""_dna5;
+
+int main()
+{
+    auto const path = std::filesystem::temp_directory_path() / "sorted.bam";
+
+    { // a coordinate-sorted BAM file with a read every 100 positions
+        std::vector<std::string> ref_ids{"chr1"};
+        std::vector<size_t> ref_lengths{10000};
+        seqan3::alignment_file_output fout{path, ref_ids, ref_lengths,
+                                           seqan3::fields<seqan3::field::seq, seqan3::field::id, seqan3::field::ref_id,
+                                                          seqan3::field::ref_offset, seqan3::field::cigar>{}};
+
+        for (int32_t position = 0; position < 10000; position += 100)
+            fout.emplace_back("ACGTACGTAC"_dna5, "read" + std::to_string(position), 0, position,
+                              std::vector<seqan3::cigar>{seqan3::cigar{10, 'M'_cigar_op}});
+    }
+
+    // build the index once and store it next to the file
+    std::ifstream bam_stream{path, std::ios::binary};
+    seqan3::bam_index index{bam_stream};
+    std::ofstream bai_stream{path.string() + ".bai", std::ios::binary};
+    index.write_bai(bai_stream);
+
+    // only the chunks of the file that contain the region are read
+    seqan3::alignment_file_input fin{path, seqan3::fields<seqan3::field::id, seqan3::field::ref_offset>{}};
+    fin.set_region(index, "chr1:1,001-1,300");
+
+    for (auto & [id, ref_offset] : fin)
+        seqan3::debug_stream << id << ' ' << ref_offset.value() << '\n'; // read1000, read1100 and read1200
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(path.string() + ".bai");
+}
@@ -0,0 +1,48 @@
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/alignment_file/bam_input.hpp>
+#include <seqan3/io/alignment_file/bam_output.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/ranges>
+
+using seqan3::operator""_cigar_op;
+using seqan3::operator""_dna5;
+
+int main()
+{
+    auto const input_path = std::filesystem::temp_directory_path() / "reads.bam";
+    auto const output_path = std::filesystem::temp_directory_path() / "filtered.bam";
+
+    { // a BAM file with reads of increasing mapping quality
+        std::vector<std::string> ref_ids{"chr1"};
+        std::vector<size_t> ref_lengths{1000};
+        seqan3::alignment_file_output fout{input_path, ref_ids, ref_lengths,
+                                           seqan3::fields<seqan3::field::seq, seqan3::field::id, seqan3::field::ref_id,
+                                                          seqan3::field::ref_offset, seqan3::field::cigar,
+                                                          seqan3::field::mapq>{}};
+
+        for (int32_t i = 0; i < 10; ++i)
+            fout.emplace_back("ACGTACGTAC"_dna5, "read" + std::to_string(i), 0, 100 * i,
+                              std::vector<seqan3::cigar>{seqan3::cigar{10, 'M'_cigar_op}}, static_cast<uint8_t>(i * 10));
+    }
+
+    { // only the mapping quality is read; the records are copied without decoding them
+        seqan3::bam_file_input fin{input_path};
+        seqan3::bam_file_output fout{output_path, fin.header()};
+
+        fout = fin | std::views::filter([] (seqan3::bam_record const & record) { return record.mapq() >= 60; });
+    }
+
+    // other fields are decoded on access
+    seqan3::bam_file_input filtered{output_path};
+    for (seqan3::bam_record & record : filtered)
+        seqan3::debug_stream << record.id() << ' ' << record.sequence() << '\n'; // read6 to read9 with ACGTACGTAC
+
+    std::filesystem::remove(input_path);
+    std::filesystem::remove(output_path);
+}
@@ -0,0 +1,25 @@
+#include <fstream>
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/std/filesystem>
+
+int main()
+{
+    auto const path = std::filesystem::temp_directory_path() / "genome.fasta";
+    std::ofstream{path} << ">chr1 first chromosome\nACGTACGT\nACGTACGT\nACG\n>chr2\nGGTTAACC\nGG\n";
+
+    // build the index once and store it next to the file
+    std::ifstream fasta_stream{path};
+    seqan3::fasta_index index{fasta_stream};
+    std::ofstream fai_stream{path.string() + ".fai"};
+    index.write_fai(fai_stream);
+
+    seqan3::sequence_file_input fin{path};
+    seqan3::debug_stream << fin.read_region(index, "chr1", 6, 12) << '\n'; // GTACGT
+    seqan3::debug_stream << fin.read_region(index, "chr2") << '\n';        // GGTTAACCGG
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(path.string() + ".fai");
+}
@@ -0,0 +1,19 @@
+#include <fstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/mapped_input.hpp>
+#include <seqan3/std/filesystem>
+
+int main()
+{
+    auto const path = std::filesystem::temp_directory_path() / "my.fasta";
+    std::ofstream{path} << ">chr1 first chromosome\nACGTACGT\nACGT\n>chr2\nGGTT\n";
+
+    seqan3::mapped_sequence_file_input fin{path};
+    fin.options.truncate_ids = true;
+
+    for (auto & [seq, id] : fin) // neither the id nor the sequence is copied
+        seqan3::debug_stream << id << ": " << std::ranges::distance(seq) << " bases\n";
+
+    std::filesystem::remove(path);
+}
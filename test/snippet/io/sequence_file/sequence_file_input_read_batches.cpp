@@ -0,0 +1,31 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(@read1
+ACGT
++
+##!#
+@read2
+AGGCTGA
++
+##!#!##
+@read3
+GGAGTA
++
+##!#!#)";
+
+int main()
+{
+    using seqan3::get;
+
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fastq{}};
+
+    // four threads parse the file; the batches arrive in the order of the file
+    fin.read_batches([] (auto & batch)
+    {
+        for (auto & rec : batch)
+            seqan3::debug_stream << "ID: " << get<seqan3::field::id>(rec) << '\n';
+    }, 4);
+}
@@ -0,0 +1,12 @@
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/views/minimiser.hpp>
+
+int main()
+{
+    std::vector<int> values{28, 100, 9, 23, 4, 1, 72, 37, 8};
+
+    // the minimum of each window of three values, the minimum of consecutive windows is reported once
+    seqan3::debug_stream << (values | seqan3::views::minimiser(3)) << '\n'; // outputs: [9,4,1,8]
+}
@@ -0,0 +1,20 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGC"_dna4};
+    auto reverse_complement = text | seqan3::views::complement | std::views::reverse;
+
+    // the minimisers of the canonical 3-mers of all windows of 5 characters, with the seed 0 the hash values are not
+    // scrambled
+    auto minimisers = seqan3::views::minimiser_hash(seqan3::ungapped{3}, seqan3::window_size{5}, seqan3::seed{0});
+    seqan3::debug_stream << (text | minimisers) << '\n';               // outputs: [6,9]
+    seqan3::debug_stream << (reverse_complement | minimisers) << '\n'; // outputs: [9,6,6]
+}
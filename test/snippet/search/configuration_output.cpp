@@ -14,5 +14,9 @@ int main()
                                                                      seqan3::search_cfg::insertion{1},
                                                                      seqan3::search_cfg::deletion{1}} |
                                        seqan3::search_cfg::output{seqan3::search_cfg::index_cursor};
+
+    // Report text positions with the number of errors and the edit transcript.
+    seqan3::configuration const cfg3 = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                       seqan3::search_cfg::output{seqan3::search_cfg::alignment};
     return 0;
 }
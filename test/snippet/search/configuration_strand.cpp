@@ -0,0 +1,18 @@
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/algorithm/search.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTTTGCAAAACCG"_dna4};
+    seqan3::bi_fm_index index{text};
+
+    // "TTTG" occurs at position 3 and its reverse complement "CAAA" at position 7.
+    seqan3::configuration const cfg = seqan3::search_cfg::strand{seqan3::search_cfg::both_strands};
+    for (auto && [position, strand] : search("TTTG"_dna4, index, cfg))
+    {
+        seqan3::debug_stream << position << ' '
+                             << (strand == seqan3::search_strand::forward ? "forward" : "reverse complement") << '\n';
+    }
+}
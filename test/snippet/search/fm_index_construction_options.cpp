@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+    std::vector<std::vector<seqan3::dna4>> genomes{"ATCTGACGAAGGCTAGCTAGCTAAGGGA"_dna4,
+                                                   "TAGCTGAAGCCATTGGCATCTGATCGGACT"_dna4,
+                                                   "ACTGAGCTCGTC"_dna4};
+
+    seqan3::fm_index_construction_options options{};
+    options.construction = seqan3::fm_index_construction::semi_external; // keep intermediate data on disk
+    options.ram_budget = 1ULL << 30;                                      // build the suffix array in memory if
+                                                                          // it needs at most 1 GiB
+    options.thread_count = 2;                                             // build both directions concurrently
+
+    seqan3::bi_fm_index index{genomes, options};                          // build the index
+
+    auto cur = index.begin();
+    cur.extend_right("AAGG"_dna4);
+    seqan3::debug_stream << "Number of hits: " << cur.count() << '\n';    // outputs: 1
+    return 0;
+}
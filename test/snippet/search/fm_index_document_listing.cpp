@@ -0,0 +1,25 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<std::vector<seqan3::dna4>> genomes{"ACGTACGTTTGACCA"_dna4,
+                                                   "TTTGGGCCCAAA"_dna4,
+                                                   "CCATTTGACCATTTG"_dna4};
+
+    seqan3::fm_index_construction_options options{};
+    options.document_listing = true;
+
+    seqan3::fm_index index{genomes, options};
+
+    auto cur = index.begin();
+    cur.extend_right("TTTG"_dna4);
+    seqan3::debug_stream << "Genomes: " << cur.documents() << '\n';        // outputs: [0,1,2]
+    seqan3::debug_stream << "Counts: " << cur.document_counts() << '\n';   // outputs: [(0,1),(1,1),(2,2)]
+    return 0;
+}
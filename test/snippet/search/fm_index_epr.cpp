@@ -0,0 +1,31 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/std/algorithm>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+    std::vector<std::vector<seqan3::dna4>> genomes{"ATCTGACGAAGGCTAGCTAGCTAAGGGA"_dna4, "TAGCTAAGGGA"_dna4};
+
+    using single_index_t = seqan3::sdsl_epr_index_type<seqan3::dna4, seqan3::text_layout::single>;
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, single_index_t> index{genome};
+
+    using collection_index_t = seqan3::sdsl_epr_index_type<seqan3::dna4, seqan3::text_layout::collection>;
+    seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection, collection_index_t> bi_index{genomes};
+
+    auto cur = index.begin();
+    cur.extend_right("AAGG"_dna4);
+    auto positions = cur.locate(); // the order of the positions depends on the index
+    std::ranges::sort(positions);
+    seqan3::debug_stream << "Positions: " << positions << '\n';            // outputs: [8,22]
+
+    auto bi_cur = bi_index.begin();
+    bi_cur.extend_left("AAGG"_dna4);
+    seqan3::debug_stream << "Number of hits: " << bi_cur.count() << '\n';  // outputs: 3
+    return 0;
+}
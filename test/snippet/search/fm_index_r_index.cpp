@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/std/algorithm>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    // three genomes that only differ in a single position
+    std::vector<std::vector<seqan3::dna4>> genomes{"ACGTACGTTTGACCA"_dna4,
+                                                   "ACGTACGTTTGACCA"_dna4,
+                                                   "ACGAACGTTTGACCA"_dna4};
+
+    using r_index_t = seqan3::sdsl_r_index_type<seqan3::dna4, seqan3::text_layout::collection>;
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection, r_index_t> index{genomes};
+
+    auto cur = index.begin();
+    cur.extend_right("CGTT"_dna4);
+    auto hits = cur.locate();
+    std::ranges::sort(hits);
+    seqan3::debug_stream << "Positions: " << hits << '\n'; // outputs: [(0,5),(1,5),(2,5)]
+    return 0;
+}
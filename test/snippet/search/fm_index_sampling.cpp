@@ -0,0 +1,32 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/std/algorithm>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // sample only every 256-th suffix array entry: small index, counting is as fast as with the default index
+    using count_index_t = seqan3::sampled_sdsl_wt_index_type<256>;
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, count_index_t> count_index{genome};
+
+    // sample every 4-th text position: locating an occurrence takes at most 3 LF-steps
+    using locate_index_t = seqan3::sampled_sdsl_wt_index_type<4, 10000000, seqan3::sa_sampling::text_order>;
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, locate_index_t> locate_index{genome};
+
+    auto count_cur = count_index.begin();
+    count_cur.extend_right("AAGG"_dna4);
+    seqan3::debug_stream << "Number of hits: " << count_cur.count() << '\n';   // outputs: 2
+
+    auto locate_cur = locate_index.begin();
+    locate_cur.extend_right("AAGG"_dna4);
+    auto positions = locate_cur.locate(); // the order of the positions depends on the index
+    std::ranges::sort(positions);
+    seqan3::debug_stream << "Positions: " << positions << '\n';                // outputs: [8,22]
+    return 0;
+}
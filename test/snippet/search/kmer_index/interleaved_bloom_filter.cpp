@@ -0,0 +1,23 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/interleaved_bloom_filter.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::vector<std::vector<seqan3::dna4>> genomes{"ACGTACGTTTGACCATTAGGCA"_dna4,
+                                                   "TTTGGGCCCAAATTTGGGCCCA"_dna4,
+                                                   "CCATTTGACCATTTGAGGATCC"_dna4};
+
+    // one bin per genome, 1024 bits per bin, 2 hash functions, constructed with 2 threads
+    seqan3::shape const kmer_shape{seqan3::ungapped{5}};
+    seqan3::interleaved_bloom_filter ibf{genomes, kmer_shape, seqan3::bin_size{1024},
+                                         seqan3::hash_function_count{2}, 2};
+
+    // the bins that may contain the read with at most one error
+    std::vector<seqan3::dna4> read{"GTTTGACCATTA"_dna4};
+    seqan3::debug_stream << ibf.select_bins(read, kmer_shape, 1) << '\n'; // outputs: [0,2]
+}
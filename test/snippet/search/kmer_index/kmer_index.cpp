@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+    std::vector<std::vector<seqan3::dna4>> genomes{"ATCGAAGG"_dna4, "GCTAAGGGA"_dna4};
+
+    // index all 4-mers, using two threads for the construction
+    seqan3::kmer_index index{genome, seqan3::shape{seqan3::ungapped{4}}, 2};
+
+    seqan3::debug_stream << index.count("AAGG"_dna4) << '\n';            // outputs: 2
+    seqan3::debug_stream << seqan3::search("AAGG"_dna4, index) << '\n';  // outputs: [8,22]
+
+    // gapped 4-mers over a text collection: the third position is not taken into account
+    seqan3::kmer_index collection_index{genomes, seqan3::shape{seqan3::bin_literal{0b1011}}};
+
+    std::vector<std::vector<seqan3::dna4>> queries{"AAGG"_dna4, "AATG"_dna4, "CCCC"_dna4};
+    seqan3::debug_stream << seqan3::search(queries, collection_index) << '\n';
+    // outputs: [[(0,4),(1,3)],[(0,4),(1,3)],[]]
+}
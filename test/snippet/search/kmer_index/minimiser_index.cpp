@@ -0,0 +1,27 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/minimiser_index.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::vector<std::vector<seqan3::dna4>> genomes{"ACGGCGACGTTTAGACGTTACGAT"_dna4,
+                                                   "TTGACCATTAGGCAGGATCCGTAA"_dna4,
+                                                   "GGATCCGTAACGTCTAAACGTCGCCGT"_dna4};
+
+    // the minimisers of the canonical 4-mers of all windows of 8 characters
+    seqan3::minimiser_index index{genomes, seqan3::ungapped{4}, seqan3::window_size{8}};
+    seqan3::debug_stream << index.size() << '\n'; // outputs: 20
+
+    // seeds: the positions of the minimisers in the read and their occurrences in the genomes
+    std::vector<seqan3::dna4> read{"GACGTTTAGACG"_dna4};
+    seqan3::debug_stream << index.locate(read) << '\n';
+    // outputs: [(4,(0,9)),(4,(2,14)),(6,(0,11)),(6,(2,12))]
+
+    // the fraction of the minimisers of the read that occur in each genome
+    std::vector<seqan3::dna4> read2{"AGGATCCGTAACG"_dna4};
+    seqan3::debug_stream << index.containment(read2) << '\n'; // outputs: [0.5,0.5,1]
+}
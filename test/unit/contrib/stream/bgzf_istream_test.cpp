@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <string>
+
 #include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
 
 #include "../../io/stream/istream_test_template.hpp"
 
@@ -32,3 +36,44 @@ public:
 using test_types = ::testing::Types<contrib::bgzf_istream>;
 
 INSTANTIATE_TYPED_TEST_CASE_P(contrib_streams, istream, test_types);
+
+TEST(bgzf_istream, virtual_offset_seek)
+{
+    // several BGZF blocks of 64 KiB
+    std::string text{};
+    for (size_t i = 0; text.size() < 300'000; ++i)
+        text += std::to_string(i) + ' ';
+
+    std::ostringstream compressed{};
+    {
+        contrib::bgzf_ostream stream{compressed};
+        stream << text;
+    }
+
+    std::istringstream compressed_input{compressed.str()};
+    contrib::bgzf_istream stream{compressed_input};
+
+    // remember the virtual offsets of positions in the first and the last block
+    std::string buffer(100, '\0');
+    stream.ignore(1000);
+    std::streampos const first = stream.tellg();
+    EXPECT_EQ(static_cast<std::streamoff>(first) >> 16, 0);       // in the first block
+    EXPECT_EQ(static_cast<std::streamoff>(first) & 0xffff, 1000); // offset in the block
+
+    stream.ignore(250'000);
+    std::streampos const last = stream.tellg();
+    EXPECT_GT(static_cast<std::streamoff>(last) >> 16, 0);
+
+    // seek back and forth
+    for (auto const & [offset, position] : {std::pair{last, 251'000}, std::pair{first, 1000},
+                                            std::pair{first, 1000}, std::pair{last, 251'000}})
+    {
+        ASSERT_EQ(stream.seekg(offset).tellg(), offset);
+        ASSERT_TRUE(stream.read(buffer.data(), buffer.size()));
+        EXPECT_EQ(buffer, text.substr(position, buffer.size()));
+    }
+
+    // the offset in the block must not exceed the block
+    stream.seekg((static_cast<std::streamoff>(first) & ~std::streamoff{0xffff}) | 0xffff);
+    EXPECT_TRUE(stream.fail());
+}
@@ -7,28 +7,45 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
 #include <seqan3/contrib/stream/bgzf_ostream.hpp>
 
 #include "../../io/stream/ostream_test_template.hpp"
 
 using namespace seqan3;
 
-template <>
-class ostream<contrib::bgzf_ostream> : public ::testing::Test
-{
-public:
-    static inline std::string compressed
-    {                                                                          // OS = 0
-        '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x06', '\x00', '\x42', '\x43',
-        '\x02', '\x00', '\x45', '\x00', '\x0B', '\xC9', '\x48', '\x55', '\x28', '\x2C', '\xCD', '\x4C', '\xCE', '\x56',
-        '\x48', '\x2A', '\xCA', '\x2F', '\xCF', '\x53', '\x48', '\xCB', '\xAF', '\x50', '\xC8', '\x2A', '\xCD', '\x2D',
-        '\x28', '\x56', '\xC8', '\x2F', '\x4B', '\x2D', '\x52', '\x28', '\x01', '\x4A', '\xE7', '\x24', '\x56', '\x55',
-        '\x2A', '\xA4', '\xE4', '\xA7', '\x03', '\x00', '\x39', '\xA3', '\x4F', '\x41', '\x2B', '\x00', '\x00', '\x00',
-        '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\xFF', '\x06', '\x00', '\x42', '\x43',
-        '\x02', '\x00', '\x1B', '\x00', '\x03', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
-    };  // Note we zeroed the 10th byte which indicates the OS on which the file was compressed.
-};
-
 using test_types = ::testing::Types<contrib::bgzf_ostream>;
 
 INSTANTIATE_TYPED_TEST_CASE_P(contrib_streams, ostream, test_types);
+
+TEST(bgzf_ostream, compression_level)
+{
+    std::string text{};
+    for (size_t i = 0; i < 10000; ++i)
+        text += std::to_string(i % 97) + uncompressed;
+
+    auto compress = [&text] (int const level)
+    {
+        std::ostringstream out{};
+        {
+            contrib::bgzf_ostream compout{out};
+            compout.rdbuf()->set_compression_level(level);
+            compout << text;
+        }
+        return out.str();
+    };
+
+    std::string const stored = compress(0);
+    std::string const fast = compress(1);
+    std::string const best = compress(100); // clamped to the highest level
+
+    EXPECT_GT(stored.size(), text.size());
+    EXPECT_LT(fast.size(), stored.size());
+    EXPECT_LE(best.size(), fast.size());
+
+    for (std::string const & compressed : {stored, fast, best})
+        EXPECT_EQ(test::decompress_bgzf(compressed), text);
+}
@@ -0,0 +1,63 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+using namespace seqan3;
+
+template <>
+class istream<contrib::zstd_istream> : public ::testing::Test
+{
+public:
+    static inline std::string compressed
+    {
+        '\x28', '\xB5', '\x2F', '\xFD', '\x04', '\x58', '\x59', '\x01', '\x00', '\x54', '\x68', '\x65', '\x20', '\x71',
+        '\x75', '\x69', '\x63', '\x6B', '\x20', '\x62', '\x72', '\x6F', '\x77', '\x6E', '\x20', '\x66', '\x6F', '\x78',
+        '\x20', '\x6A', '\x75', '\x6D', '\x70', '\x73', '\x20', '\x6F', '\x76', '\x65', '\x72', '\x20', '\x74', '\x68',
+        '\x65', '\x20', '\x6C', '\x61', '\x7A', '\x79', '\x20', '\x64', '\x6F', '\x67', '\xBC', '\x71', '\xDA', '\x1F'
+    };
+};
+
+using test_types = ::testing::Types<contrib::zstd_istream>;
+
+INSTANTIATE_TYPED_TEST_CASE_P(contrib_streams, istream, test_types);
+
+TEST(zstd_istream, concatenated_frames)
+{
+    std::string const & compressed = istream<contrib::zstd_istream>::compressed;
+
+    std::istringstream in{compressed + compressed};
+    contrib::zstd_istream decompin{in};
+    std::string buffer{std::istreambuf_iterator<char>{decompin}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(buffer, uncompressed + uncompressed);
+}
+
+TEST(zstd_istream, invalid_input)
+{
+    std::string const & compressed = istream<contrib::zstd_istream>::compressed;
+
+    { // the stream ends within the frame
+        std::istringstream in{compressed.substr(0, compressed.size() - 10)};
+        contrib::zstd_istream decompin{in};
+        EXPECT_THROW((std::string{std::istreambuf_iterator<char>{decompin}, std::istreambuf_iterator<char>{}}),
+                     io_error);
+    }
+
+    { // the checksum does not match
+        std::string corrupted = compressed;
+        corrupted.back() = '\x00';
+        std::istringstream in{corrupted};
+        contrib::zstd_istream decompin{in};
+        EXPECT_THROW((std::string{std::istreambuf_iterator<char>{decompin}, std::istreambuf_iterator<char>{}}),
+                     io_error);
+    }
+}
@@ -0,0 +1,81 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+using namespace seqan3;
+
+// The compressed bytes depend on the version of libzstd, hence the output is decompressed instead of compared.
+std::string decompress(std::string const & compressed)
+{
+    std::istringstream in{compressed};
+    contrib::zstd_istream decompin{in};
+    return std::string{std::istreambuf_iterator<char>{decompin}, std::istreambuf_iterator<char>{}};
+}
+
+std::string const uncompressed{"The quick brown fox jumps over the lazy dog"};
+
+TEST(zstd_ostream, concept_check)
+{
+    EXPECT_TRUE((output_stream_over<contrib::zstd_ostream, char>));
+}
+
+TEST(zstd_ostream, output)
+{
+    std::ostringstream out{};
+    {
+        contrib::zstd_ostream compout{out};
+        compout << uncompressed << std::flush;
+    }
+
+    EXPECT_EQ(out.str().substr(0, 4), (std::string{'\x28', '\xB5', '\x2F', '\xFD'}));
+    EXPECT_EQ(decompress(out.str()), uncompressed);
+}
+
+TEST(zstd_ostream, output_type_erased)
+{
+    std::ostringstream out{};
+    {
+        std::unique_ptr<std::ostream> compout{new contrib::zstd_ostream{out}};
+        *compout << uncompressed;
+    }
+
+    EXPECT_EQ(decompress(out.str()), uncompressed);
+}
+
+TEST(zstd_ostream, compression_level_and_threads)
+{
+    std::string text{};
+    for (size_t i = 0; i < 100000; ++i)
+        text += std::to_string(i % 997) + uncompressed;
+
+    auto compress = [&text] (int const level, size_t const thread_count)
+    {
+        std::ostringstream out{};
+        {
+            contrib::zstd_ostream compout{out, level, thread_count};
+            compout << text;
+        }
+        return out.str();
+    };
+
+    std::string const fast = compress(1, 1);
+    std::string const best = compress(100, 1); // clamped to the highest level
+    std::string const parallel = compress(3, 4);
+
+    EXPECT_LT(best.size(), fast.size());
+
+    for (std::string const & compressed : {fast, best, parallel})
+        EXPECT_EQ(decompress(compressed), text);
+}
@@ -11,6 +11,7 @@
 
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
 #include <seqan3/range/views/convert.hpp>
 #include <seqan3/std/algorithm>
 #include <seqan3/std/iterator>
@@ -498,6 +499,27 @@ struct alignment_file_input_sam_format_f : public alignment_file_input_f
     };
 };
 
+TEST_F(alignment_file_input_sam_format_f, read_batches)
+{
+    alignment_file_input fin{std::istringstream{input}, format_sam{}, fields<field::id, field::seq>{}};
+
+    // SAM files are read record by record
+    size_t counter = 0;
+    fin.read_batches([&] (auto & batch)
+    {
+        for (auto & [ id, seq ] : batch)
+        {
+            EXPECT_EQ(id, id_comp[counter]);
+            EXPECT_EQ(seq, seq_comp[counter]);
+            ++counter;
+        }
+    }, 2);
+
+    EXPECT_EQ(counter, 3u);
+    EXPECT_EQ(fin.header().ref_ids(), ref_ids);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
 TEST_F(alignment_file_input_sam_format_f, construct_by_filename_and_read_alignments)
 {
     test::tmp_filename filename{"alignment_file_input_constructor.sam"};
@@ -591,6 +613,63 @@ struct alignment_file_input_bam_format_f : public alignment_file_input_sam_forma
     };
 };
 
+TEST_F(alignment_file_input_bam_format_f, read_batches)
+{
+    // an uncompressed BAM file with many records
+    std::string sam_input{input};
+    for (size_t i = 3; i < 100; ++i)
+    {
+        sam_input += "read" + std::to_string(i + 1) + "\t0\tref\t" + std::to_string(i + 1) +
+                     "\t60\t4M\t*\t0\t0\tACGT\t!##$\n";
+    }
+
+    std::ostringstream bam{};
+    {
+        alignment_file_input fin{std::istringstream{sam_input}, format_sam{}};
+        alignment_file_output fout{bam, format_bam{}};
+        fout = fin;
+    }
+
+    alignment_file_input fin{std::istringstream{bam.str()}, format_bam{}, fields<field::id,
+                                                                                 field::ref_offset,
+                                                                                 field::header_ptr>{}};
+
+    // small chunks s.t. the records are parsed in many batches
+    size_t counter = 0;
+    size_t batches = 0;
+    fin.read_batches([&] (auto & batch)
+    {
+        for (auto & [ id, ref_offset, header_ptr ] : batch)
+        {
+            EXPECT_EQ(id, "read" + std::to_string(counter + 1));
+            EXPECT_EQ(ref_offset, std::optional<int32_t>{static_cast<int32_t>(counter)});
+            EXPECT_EQ(header_ptr, &fin.header());
+            ++counter;
+        }
+        ++batches;
+    }, 3, 256);
+
+    EXPECT_EQ(counter, 100u);
+    EXPECT_GT(batches, 10u);
+    EXPECT_EQ(fin.header().ref_ids(), ref_ids);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(alignment_file_input_bam_format_f, read_batches_truncated)
+{
+    std::ostringstream bam{};
+    {
+        alignment_file_input fin{std::istringstream{input}, format_sam{}};
+        alignment_file_output fout{bam, format_bam{}};
+        fout = fin;
+    }
+
+    std::string const truncated = bam.str().substr(0, bam.str().size() - 3);
+    alignment_file_input fin{std::istringstream{truncated}, format_bam{}};
+
+    EXPECT_THROW(fin.read_batches([] (auto &) {}, 2, 16), unexpected_end_of_input);
+}
+
 #if SEQAN3_HAS_ZLIB
 TEST_F(alignment_file_input_bam_format_f, construct_by_filename)
 {
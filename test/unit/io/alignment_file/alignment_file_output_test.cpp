@@ -15,8 +15,10 @@
 #include <seqan3/io/alignment_file/input.hpp>
 #include <seqan3/io/alignment_file/output.hpp>
 #include <seqan3/range/shortcuts.hpp>
+#include <seqan3/test/bgzf.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 #include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
 
 using namespace seqan3;
 
@@ -539,6 +541,80 @@ read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
 }
 #endif // SEQAN3_HAS_ZLIB
 
+TEST(rows, write_batches)
+{
+    std::vector<record<type_list<dna5_vector, std::string>, fields<field::seq, field::id>>> range;
+    std::string expected{};
+
+    for (size_t i = 0; i < 34; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+            range.emplace_back(seqs[j], ids[j]);
+        expected += output_comp;
+    }
+
+    // a random access range is formatted in place
+    {
+        alignment_file_output fout{std::ostringstream{}, format_sam{}};
+        fout.write_batches(range, 3, 4);
+
+        fout.get_stream().flush();
+        EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), expected);
+    }
+
+    // other ranges are copied into batches
+    {
+        alignment_file_output fout{std::ostringstream{}, format_sam{}};
+        fout.write_batches(range | std::views::filter([] (auto const &) { return true; }), 3, 4);
+
+        fout.get_stream().flush();
+        EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), expected);
+    }
+
+    // an empty range writes nothing
+    {
+        alignment_file_output fout{std::ostringstream{}, format_sam{}};
+        fout.write_batches(std::vector<std::tuple<dna5_vector, std::string>>{});
+
+        fout.get_stream().flush();
+        EXPECT_TRUE(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str().empty());
+    }
+}
+
+TEST(rows, write_batches_bam)
+{
+    std::vector<std::string> const ref_ids{"ref"};
+    std::vector<dna4_vector> const ref_seqs{"ACTAGCTAGGAGGACTAGCATCGATC"_dna4};
+
+    std::string comp =
+R"(@HD	VN:1.6	SO:unknown	GO:none
+@SQ	SN:ref	LN:26
+@PG	ID:prog1	PN:cool_program
+@CO	This is a comment.
+read1	41	ref	1	61	1S1M1D1M1I	ref	10	300	ACGT	!##$	AS:i:2	NM:i:7
+read2	42	ref	2	62	7M1D1M1S	ref	10	300	AGGCTGNAG	!##$&'()*	xy:B:S,3,4,5
+read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
+)";
+
+    // SAM -> BAM, formatted in parallel
+    std::ostringstream bam{};
+    {
+        alignment_file_input fin{std::istringstream{comp}, ref_ids, ref_seqs, format_sam{}};
+        alignment_file_output fout{bam, format_bam{}};
+
+        fout.write_batches(fin, 2, 1);
+    }
+
+    // BAM -> SAM, parsed and formatted in parallel
+    alignment_file_input fin{std::istringstream{bam.str()}, ref_ids, ref_seqs, format_bam{}};
+    alignment_file_output fout{std::ostringstream{}, format_sam{}};
+
+    fin.read_batches([&] (auto & batch) { fout.write_batches(batch, 2, 1); }, 2, 64);
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), comp);
+}
+
 TEST(rows, convert_sam_to_blast)
 {
     // TODO when blast format is implemented
@@ -590,6 +666,14 @@ void compression_by_stream_impl(comp_stream_t & stream)
 }
 
 #ifdef SEQAN3_HAS_ZLIB
+// the SAM output that is compressed
+std::string uncompressed_output()
+{
+    std::ostringstream out{};
+    compression_by_stream_impl(out);
+    return out.str();
+}
+
 std::string expected_gz
 {
     '\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x2B', '\x4A', '\x4D',
@@ -600,25 +684,11 @@ std::string expected_gz
     '\x7E', '\x6C', '\x6C', '\x0F', '\x76', '\x00', '\x00', '\x00'
 };
 
-std::string expected_bgzf
-{
-    '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x06', '\x00', '\x42', '\x43',
-    '\x02', '\x00', '\x50', '\x00', '\x2B', '\x4A', '\x4D', '\x4C', '\x31', '\xE4', '\x34', '\xE0', '\xD4', '\x02',
-    '\x62', '\x10', '\x09', '\xA1', '\x1D', '\x9D', '\xDD', '\x43', '\x38', '\xB5', '\xB8', '\x8A', '\x80', '\x92',
-    '\x46', '\x98', '\x92', '\xEE', '\xEE', '\xCE', '\x21', '\xEE', '\x7E', '\x8E', '\x50', '\x0A', '\xAA', '\xCE',
-    '\x18', '\x43', '\x9D', '\xBB', '\xBB', '\xA3', '\x7B', '\x88', '\x63', '\x88', '\x23', '\x10', '\xA1', '\x40',
-    '\xA0', '\x06', '\x00', '\x7E', '\x6C', '\x6C', '\x0F', '\x76', '\x00', '\x00', '\x00', '\x1F', '\x8B', '\x08',
-    '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\xFF', '\x06', '\x00', '\x42', '\x43', '\x02', '\x00', '\x1B',
-    '\x00', '\x03', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
-};
-
 TEST(compression, by_filename_gz)
 {
     test::tmp_filename filename{"alignment_file_output_test.sam.gz"};
 
-    std::string buffer = compression_by_filename_impl(filename);
-    buffer[9] = '\x00'; // zero out OS byte.
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(test::decompress_bgzf(compression_by_filename_impl(filename)), uncompressed_output());
 }
 
 TEST(compression, by_stream_gz)
@@ -638,9 +708,7 @@ TEST(compression, by_filename_bgzf)
 {
     test::tmp_filename filename{"alignment_file_output_test.sam.bgzf"};
 
-    std::string buffer = compression_by_filename_impl(filename);
-    buffer[9] = '\x00'; // zero out OS byte.
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(test::decompress_bgzf(compression_by_filename_impl(filename)), uncompressed_output());
 }
 
 TEST(compression, by_stream_bgzf)
@@ -651,9 +719,7 @@ TEST(compression, by_stream_bgzf)
         contrib::bgzf_ostream compout{out};
         compression_by_stream_impl(compout);
     }
-    std::string buffer = out.str();
-    buffer[9] = '\x00'; // zero out OS byte.
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(test::decompress_bgzf(out.str()), uncompressed_output());
 }
 #endif
 
@@ -0,0 +1,269 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/genomic_region.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+TEST(genomic_region, from_string)
+{
+    genomic_region region = genomic_region::from_string("chr1:1,000,000-2,000,000");
+    EXPECT_EQ(region.reference_id, "chr1");
+    EXPECT_EQ(region.begin, 999'999u);
+    EXPECT_EQ(region.end, 2'000'000u);
+
+    region = genomic_region::from_string("chr1:100");
+    EXPECT_EQ(region.reference_id, "chr1");
+    EXPECT_EQ(region.begin, 99u);
+    EXPECT_EQ(region.end, std::numeric_limits<uint64_t>::max());
+
+    region = genomic_region::from_string("chr1:100-");
+    EXPECT_EQ(region.begin, 99u);
+    EXPECT_EQ(region.end, std::numeric_limits<uint64_t>::max());
+
+    region = genomic_region::from_string("chrX");
+    EXPECT_EQ(region.reference_id, "chrX");
+    EXPECT_EQ(region.begin, 0u);
+    EXPECT_EQ(region.end, std::numeric_limits<uint64_t>::max());
+
+    // names that contain ':' are only recognised if the part after it is not a position
+    region = genomic_region::from_string("HLA-A*01:01");
+    EXPECT_EQ(region.reference_id, "HLA-A*01");
+    EXPECT_EQ(region.begin, 0u);
+
+    region = genomic_region::from_string("HLA-A*01:xy");
+    EXPECT_EQ(region.reference_id, "HLA-A*01:xy");
+    EXPECT_EQ(region.begin, 0u);
+}
+
+TEST(genomic_region, invalid)
+{
+    EXPECT_THROW(genomic_region::from_string(""), std::invalid_argument);
+    EXPECT_THROW(genomic_region::from_string(":1-2"), std::invalid_argument);
+    EXPECT_THROW(genomic_region::from_string("chr1:0-10"), std::invalid_argument);
+    EXPECT_THROW(genomic_region::from_string("chr1:20-10"), std::invalid_argument);
+}
+
+#if SEQAN3_HAS_ZLIB
+struct bam_index_f : public ::testing::Test
+{
+    // a record as written to the file
+    struct read_info
+    {
+        std::optional<int32_t> ref_id;
+        int32_t position;
+        int32_t ref_length;
+        std::string id;
+    };
+
+    std::vector<std::string> ref_ids{"chr1", "chr2"};
+    std::vector<size_t> ref_lengths{1'000'000, 500'000};
+    std::vector<read_info> reads{};
+    test::tmp_filename filename{"bam_index_test.bam"};
+
+    bam_index_f()
+    {
+        // chr1 has a read every 37 positions (many BGZF blocks), chr2 a read every 1000 positions, then unplaced reads
+        for (int32_t position = 0; position < 400'000; position += 37)
+            reads.push_back({0, position, (position % 3 == 0) ? 110 : 100, "a" + std::to_string(position)});
+        for (int32_t position = 0; position < 500'000; position += 1000)
+            reads.push_back({1, position, 100, "b" + std::to_string(position)});
+        for (int32_t i = 0; i < 3; ++i)
+            reads.push_back({std::nullopt, -1, 0, "u" + std::to_string(i)});
+
+        write(filename.get_path(), reads);
+    }
+
+    using output_fields = fields<field::seq, field::id, field::ref_id, field::ref_offset, field::cigar, field::flag>;
+
+    // writes the reads as BGZF-compressed BAM file
+    void write(std::filesystem::path const & path, std::vector<read_info> const & records)
+    {
+        alignment_file_output fout{path, ref_ids, ref_lengths, output_fields{}};
+        write_records(fout, records);
+    }
+
+    template <typename file_t>
+    void write_records(file_t & fout, std::vector<read_info> const & records)
+    {
+        dna5_vector const sequence(100, 'A'_dna5);
+        std::vector<cigar> const cigar_100{cigar{100, 'M'_cigar_op}};
+        std::vector<cigar> const cigar_110{cigar{50, 'M'_cigar_op}, cigar{10, 'D'_cigar_op}, cigar{50, 'M'_cigar_op}};
+
+        for (read_info const & read : records)
+        {
+            if (read.ref_id)
+                fout.emplace_back(sequence, read.id, read.ref_id, std::optional<int32_t>{read.position},
+                                  read.ref_length == 110 ? cigar_110 : cigar_100, sam_flag::none);
+            else
+                fout.emplace_back(sequence, read.id, read.ref_id, std::optional<int32_t>{},
+                                  std::vector<cigar>{}, sam_flag::unmapped);
+        }
+    }
+
+    // the ids of the reads that overlap the region, by scanning all reads
+    std::vector<std::string> expected_ids(std::string const & region_string) const
+    {
+        genomic_region const region = genomic_region::from_string(region_string);
+        int32_t const ref_id = region.reference_id == "chr1" ? 0 : 1;
+
+        std::vector<std::string> ids{};
+        for (read_info const & read : reads)
+            if (read.ref_id == ref_id && static_cast<uint64_t>(read.position) < region.end &&
+                static_cast<uint64_t>(read.position + read.ref_length) > region.begin)
+                ids.push_back(read.id);
+        return ids;
+    }
+
+    // the ids of the reads that set_region yields
+    template <typename file_t>
+    std::vector<std::string> queried_ids(file_t & fin, bam_index const & index, std::string const & region) const
+    {
+        fin.set_region(index, region);
+
+        std::vector<std::string> ids{};
+        for (auto & [id] : fin)
+            ids.push_back(id);
+        return ids;
+    }
+
+    bam_index build_index(uint32_t const min_shift = 14, uint32_t const depth = 5) const
+    {
+        std::ifstream bam_stream{filename.get_path(), std::ios::binary};
+        return bam_index{bam_stream, min_shift, depth};
+    }
+
+    std::vector<std::string> const regions{"chr1:1,001-1,300",
+                                           "chr1:150-150",
+                                           "chr1:100,000-250,000",
+                                           "chr1:399,990-1,000,000",
+                                           "chr1:900,000-950,000",
+                                           "chr1",
+                                           "chr2:1-1",
+                                           "chr2:123,456-234,567",
+                                           "chr2"};
+};
+
+TEST_F(bam_index_f, region_queries)
+{
+    bam_index const index = build_index();
+    EXPECT_EQ(index.reference_count(), 2u);
+    EXPECT_EQ(index.unplaced_record_count(), 3u);
+
+    alignment_file_input fin{filename.get_path(), fields<field::id>{}};
+    for (std::string const & region : regions)
+        EXPECT_EQ(queried_ids(fin, index, region), expected_ids(region)) << region;
+
+    // a region can be queried again after a later region
+    EXPECT_EQ(queried_ids(fin, index, regions[0]), expected_ids(regions[0]));
+}
+
+TEST_F(bam_index_f, query_reads_only_the_region)
+{
+    bam_index const index = build_index();
+    std::vector<bam_index_chunk> const chunks = index.query(0, 1000, 1300);
+
+    // the records of the region are at the beginning of the file
+    ASSERT_FALSE(chunks.empty());
+    EXPECT_LT(chunks.back().end, index.query(0, 0, 1'000'000).back().end);
+    EXPECT_LT(chunks.back().end, index.query(1, 0, 500'000).front().begin);
+
+    EXPECT_TRUE(index.query(0, 900'000, 950'000).empty());
+    EXPECT_TRUE(index.query(2, 0, 100).empty());
+}
+
+TEST_F(bam_index_f, bai_round_trip)
+{
+    bam_index const index = build_index();
+
+    std::ostringstream bai_stream{};
+    index.write_bai(bai_stream);
+    EXPECT_EQ(bai_stream.str().substr(0, 4), std::string("BAI\1", 4));
+
+    std::istringstream input{bai_stream.str()};
+    bam_index const read_index = bam_index::read(input);
+    EXPECT_EQ(read_index, index);
+}
+
+TEST_F(bam_index_f, csi_round_trip)
+{
+    bam_index const index = build_index(14, 6);
+    EXPECT_THROW(index.write_bai(std::cout), format_error);
+
+    std::ostringstream csi_stream{};
+    index.write_csi(csi_stream);
+
+    std::istringstream input{csi_stream.str()};
+    bam_index const read_index = bam_index::read(input);
+    EXPECT_EQ(read_index.min_shift(), 14u);
+    EXPECT_EQ(read_index.depth(), 6u);
+    EXPECT_EQ(read_index.unplaced_record_count(), 3u);
+
+    alignment_file_input fin{filename.get_path(), fields<field::id>{}};
+    for (std::string const & region : regions)
+        EXPECT_EQ(queried_ids(fin, read_index, region), expected_ids(region)) << region;
+}
+
+TEST_F(bam_index_f, unknown_reference)
+{
+    bam_index const index = build_index();
+    alignment_file_input fin{filename.get_path(), fields<field::id>{}};
+
+    EXPECT_THROW(fin.set_region(index, "chr3:1-100"), std::out_of_range);
+}
+
+TEST_F(bam_index_f, unsorted)
+{
+    std::vector<read_info> unsorted{{0, 500, 100, "r1"}, {0, 200, 100, "r2"}};
+    test::tmp_filename const unsorted_file{"bam_index_test_unsorted.bam"};
+    write(unsorted_file.get_path(), unsorted);
+
+    std::ifstream bam_stream{unsorted_file.get_path(), std::ios::binary};
+    EXPECT_THROW(bam_index{bam_stream}, format_error);
+}
+
+TEST_F(bam_index_f, uncompressed)
+{
+    std::ostringstream uncompressed{};
+    {
+        alignment_file_output fout{uncompressed, ref_ids, ref_lengths, format_bam{}, output_fields{}};
+        write_records(fout, std::vector<read_info>{reads[0]});
+    }
+    std::string const bam = uncompressed.str();
+
+    std::istringstream bam_stream{bam};
+    EXPECT_THROW(bam_index{bam_stream}, format_error);
+
+    alignment_file_input fin{std::istringstream{bam}, format_bam{}, fields<field::id>{}};
+    EXPECT_THROW(fin.set_region(build_index(), "chr1"), format_error);
+}
+
+TEST(bam_index, invalid_index)
+{
+    std::istringstream stream{std::string{"BAM\1\0\0\0\0", 8}};
+    EXPECT_THROW(bam_index::read(stream), format_error);
+
+    std::istringstream truncated{std::string{"BAI\1\2\0\0\0", 8}};
+    EXPECT_THROW(bam_index::read(truncated), unexpected_end_of_input);
+}
+#endif // SEQAN3_HAS_ZLIB
@@ -0,0 +1,194 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/alignment_file/bam_input.hpp>
+#include <seqan3/io/alignment_file/bam_output.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+struct bam_record_f : public ::testing::Test
+{
+    std::vector<std::string> ref_ids{"ref1", "ref2"};
+    std::vector<size_t> ref_lengths{1000, 2000};
+
+    std::vector<dna5_vector> seqs{"ACGTN"_dna5, "AGGCTGNAGGCTGNA"_dna5, "GGAGTA"_dna5};
+    std::vector<std::vector<phred42>> quals{"!##$&"_phred42, {}, "!!*+,-"_phred42};
+    std::vector<std::string> ids{"read1", "read2", "read3"};
+    std::vector<std::optional<int32_t>> ref_id_values{0, 1, std::nullopt};
+    std::vector<std::optional<int32_t>> ref_offsets{10, 1500, std::nullopt};
+    std::vector<std::vector<cigar>> cigars{{cigar{1, 'S'_cigar_op}, cigar{4, 'M'_cigar_op}},
+                                           {cigar{7, 'M'_cigar_op}, cigar{2, 'D'_cigar_op}, cigar{8, 'M'_cigar_op}},
+                                           {}};
+    std::vector<uint8_t> mapqs{60, 3, 0};
+    std::vector<sam_flag> flags{sam_flag::paired, sam_flag::on_reverse_strand, sam_flag::unmapped};
+    std::vector<std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>> mates
+    {
+        {1, 1200, 300},
+        {std::nullopt, std::nullopt, 0},
+        {std::nullopt, std::nullopt, 0}
+    };
+    std::vector<sam_tag_dictionary> tag_dicts = std::vector<sam_tag_dictionary>(3);
+
+    using output_fields = fields<field::seq, field::qual, field::id, field::ref_id, field::ref_offset, field::cigar,
+                                 field::mapq, field::flag, field::mate, field::tags>;
+
+    bam_record_f()
+    {
+        tag_dicts[0]["NM"_tag] = 2;
+        tag_dicts[0]["zz"_tag] = "str";
+        tag_dicts[1]["bi"_tag] = std::vector<int32_t>{-3, 200, -66000};
+    }
+
+    template <typename file_t>
+    void write_records(file_t & fout)
+    {
+        for (size_t i = 0; i < ids.size(); ++i)
+            fout.emplace_back(seqs[i], quals[i], ids[i], ref_id_values[i], ref_offsets[i], cigars[i], mapqs[i],
+                              flags[i], mates[i], tag_dicts[i]);
+    }
+
+    // an uncompressed BAM file with the records
+    std::string bam_file()
+    {
+        std::ostringstream stream{};
+        {
+            alignment_file_output fout{stream, ref_ids, ref_lengths, format_bam{}, output_fields{}};
+            write_records(fout);
+        }
+        return stream.str();
+    }
+};
+
+TEST_F(bam_record_f, concepts)
+{
+    EXPECT_TRUE(std::ranges::input_range<bam_file_input>);
+    EXPECT_FALSE(std::ranges::forward_range<bam_file_input>);
+    EXPECT_TRUE((std::ranges::random_access_range<decltype(std::declval<bam_record const &>().sequence())>));
+    EXPECT_TRUE((std::ranges::random_access_range<decltype(std::declval<bam_record const &>().base_qualities())>));
+}
+
+TEST_F(bam_record_f, read_fields)
+{
+    bam_file_input fin{std::istringstream{bam_file()}};
+    EXPECT_EQ(fin.header().ref_ids(), (std::deque<std::string>{"ref1", "ref2"}));
+
+    size_t i = 0;
+    for (bam_record & record : fin)
+    {
+        EXPECT_EQ(record.id(), ids[i]);
+        EXPECT_EQ(record.ref_id(), ref_id_values[i]);
+        EXPECT_EQ(record.ref_offset(), ref_offsets[i]);
+        EXPECT_EQ(record.mapq(), mapqs[i]);
+        EXPECT_EQ(record.flag(), flags[i]);
+        EXPECT_EQ(record.mate(), mates[i]);
+        EXPECT_EQ(record.cigar_vector(), cigars[i]);
+        EXPECT_TRUE(std::ranges::equal(record.sequence() | views::to_char, seqs[i] | views::to_char));
+        EXPECT_TRUE(std::ranges::equal(record.base_qualities(), quals[i]));
+        EXPECT_EQ(record.tags(), tag_dicts[i]);
+        ++i;
+    }
+    EXPECT_EQ(i, ids.size());
+}
+
+TEST_F(bam_record_f, same_as_alignment_file_input)
+{
+    std::string const bam = bam_file();
+    bam_file_input fin{std::istringstream{bam}};
+    alignment_file_input decoded{std::istringstream{bam},
+                                 format_bam{},
+                                 fields<field::seq, field::id, field::ref_id, field::ref_offset, field::cigar,
+                                        field::tags>{}};
+
+    auto it = fin.begin();
+    for (auto & [seq, id, ref_id, ref_offset, cigar_vector, tag_dict] : decoded)
+    {
+        ASSERT_TRUE(it != fin.end());
+        EXPECT_EQ((*it).id(), id);
+        EXPECT_EQ((*it).ref_id(), ref_id);
+        EXPECT_EQ((*it).ref_offset(), ref_offset);
+        EXPECT_EQ((*it).cigar_vector(), cigar_vector);
+        EXPECT_EQ((*it).tags(), tag_dict);
+        EXPECT_TRUE(std::ranges::equal((*it).sequence() | views::to_char, seq | views::to_char));
+        ++it;
+    }
+    EXPECT_TRUE(it == fin.end());
+}
+
+TEST_F(bam_record_f, filter_and_write)
+{
+    std::ostringstream filtered{};
+    {
+        bam_file_input fin{std::istringstream{bam_file()}};
+        bam_file_output fout{filtered, fin.header()};
+        fout = fin | std::views::filter([] (bam_record const & record) { return record.mapq() >= 3; });
+    }
+
+    alignment_file_input fin{std::istringstream{filtered.str()}, format_bam{}, fields<field::id, field::tags>{}};
+    std::vector<std::string> written_ids{};
+    for (auto & rec : fin)
+    {
+        written_ids.push_back(get<field::id>(rec));
+        EXPECT_EQ(get<field::tags>(rec), tag_dicts[written_ids.size() - 1]);
+    }
+    EXPECT_EQ(written_ids, (std::vector<std::string>{"read1", "read2"}));
+}
+
+#if SEQAN3_HAS_ZLIB
+TEST_F(bam_record_f, compressed_file)
+{
+    test::tmp_filename const input_file{"bam_record_test.bam"};
+    test::tmp_filename const output_file{"bam_record_test_copy.bam"};
+    {
+        alignment_file_output fout{input_file.get_path(), ref_ids, ref_lengths, output_fields{}};
+        write_records(fout);
+    }
+
+    std::vector<bam_record> records{};
+    {
+        bam_file_input fin{input_file.get_path()};
+        bam_file_output fout{output_file.get_path(), fin.header()};
+        for (bam_record & record : fin)
+        {
+            fout.push_back(record);
+            records.push_back(record);
+        }
+    }
+
+    bam_file_input copy{output_file.get_path()};
+    EXPECT_TRUE(std::ranges::equal(copy, records));
+}
+#endif // SEQAN3_HAS_ZLIB
+
+TEST_F(bam_record_f, invalid_input)
+{
+    std::string const bam = bam_file();
+
+    // the file ends within the last record
+    bam_file_input truncated{std::istringstream{bam.substr(0, bam.size() - 3)}};
+    EXPECT_THROW(std::ranges::distance(truncated), unexpected_end_of_input);
+
+    EXPECT_THROW(bam_file_input{std::istringstream{std::string{"SAM\1"}}}, format_error);
+    EXPECT_THROW(bam_record{std::string("\2\0\0\0ab", 6)}, format_error);
+}
@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
 #include <seqan3/std/concepts>
@@ -159,3 +163,114 @@ TEST(sam_tag_dictionary, get_function_temporary_const)
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CO"_tag>())>));
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CG"_tag>())>));
 }
+
+TEST(sam_tag_dictionary, map_interface)
+{
+    sam_tag_dictionary dict{};
+    EXPECT_TRUE(dict.empty());
+
+    dict["zz"_tag] = 'a';
+    dict["NM"_tag] = 3;
+    dict["CO"_tag] = std::string{"comment"};
+    EXPECT_EQ(dict.size(), 3u);
+
+    // the tags are visited in ascending order
+    std::vector<uint16_t> tags{};
+    for (auto & [tag, value] : dict)
+        tags.push_back(tag);
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"CO"_tag, "NM"_tag, "zz"_tag}));
+
+    EXPECT_EQ(dict.count("NM"_tag), 1u);
+    EXPECT_EQ(dict.count("MD"_tag), 0u);
+    EXPECT_TRUE(dict.contains("CO"_tag));
+    EXPECT_TRUE(dict.find("MD"_tag) == dict.end());
+    EXPECT_EQ(dict.find("NM"_tag)->second, sam_tag_dictionary::variant_type{3});
+    EXPECT_EQ(dict.at("zz"_tag), sam_tag_dictionary::variant_type{'a'});
+    EXPECT_THROW(dict.at("MD"_tag), std::out_of_range);
+    EXPECT_THROW(std::as_const(dict).at("MD"_tag), std::out_of_range);
+
+    // insert does not overwrite
+    auto [it, inserted] = dict.insert({"NM"_tag, 5});
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->second, sam_tag_dictionary::variant_type{3});
+
+    EXPECT_EQ(dict.erase("NM"_tag), 1u);
+    EXPECT_EQ(dict.erase("NM"_tag), 0u);
+    dict.erase(dict.find("CO"_tag));
+    EXPECT_EQ(dict.size(), 1u);
+
+    sam_tag_dictionary other{};
+    other["zz"_tag] = 'a';
+    EXPECT_EQ(dict, other);
+    other["zz"_tag] = 'b';
+    EXPECT_NE(dict, other);
+}
+
+TEST(sam_tag_dictionary, map_modifiers_and_bounds)
+{
+    sam_tag_dictionary dict{};
+
+    EXPECT_TRUE(dict.emplace("NM"_tag, 3).second);
+    EXPECT_FALSE(dict.emplace("NM"_tag, 4).second);
+    EXPECT_EQ(dict.at("NM"_tag), sam_tag_dictionary::variant_type{3});
+
+    // insert_or_assign overwrites
+    EXPECT_FALSE(dict.insert_or_assign("NM"_tag, 5).second);
+    EXPECT_EQ(dict.at("NM"_tag), sam_tag_dictionary::variant_type{5});
+    EXPECT_TRUE(dict.insert_or_assign("AS"_tag, 7).second);
+
+    // hinted insertion with a fitting and a wrong hint
+    auto it = dict.insert(dict.find("NM"_tag), {"MD"_tag, std::string{"10A5"}});
+    EXPECT_EQ(it->first, "MD"_tag);
+    it = dict.emplace_hint(dict.begin(), "zz"_tag, 'a');
+    EXPECT_EQ(it->first, "zz"_tag);
+    it = dict.insert(dict.end(), {"AS"_tag, 8}); // already set
+    EXPECT_EQ(it->second, sam_tag_dictionary::variant_type{7});
+
+    dict.insert({{"CO"_tag, std::string{"comment"}}, {"NM"_tag, 1}});
+    EXPECT_EQ(dict.size(), 5u);
+    EXPECT_EQ(dict.at("NM"_tag), sam_tag_dictionary::variant_type{5});
+
+    // the tags in descending order
+    std::vector<uint16_t> tags{};
+    for (auto rit = dict.rbegin(); rit != dict.rend(); ++rit)
+        tags.push_back(rit->first);
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"zz"_tag, "NM"_tag, "MD"_tag, "CO"_tag, "AS"_tag}));
+
+    EXPECT_EQ(dict.lower_bound("MD"_tag)->first, "MD"_tag);
+    EXPECT_EQ(dict.upper_bound("MD"_tag)->first, "NM"_tag);
+    EXPECT_EQ(std::as_const(dict).lower_bound("MA"_tag)->first, "MD"_tag);
+
+    auto [first, last] = dict.equal_range("CO"_tag);
+    EXPECT_EQ(std::distance(first, last), 1);
+    auto [first2, last2] = std::as_const(dict).equal_range("XX"_tag);
+    EXPECT_TRUE(first2 == last2);
+}
+
+TEST(sam_tag_dictionary, reset_keeps_memory)
+{
+    sam_tag_dictionary dict{};
+    dict.get<"NM"_tag>() = 3;
+    dict.get<"AS"_tag>() = 10;
+    dict.get<"MD"_tag>() = "10A5";
+
+    sam_tag_dictionary::value_type const * const data = &*dict.begin();
+
+    // files reset their record buffers like this before reading the next record
+    dict = {};
+    EXPECT_TRUE(dict.empty());
+
+    dict.get<"NM"_tag>() = 1;
+    dict.get<"AS"_tag>() = 2;
+    EXPECT_EQ(&*dict.begin(), data);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 1);
+
+    // moving a larger dictionary takes over its memory
+    sam_tag_dictionary larger{};
+    for (char c = 'a'; c <= 'z'; ++c)
+        larger[static_cast<uint16_t>('X' * 256 + c)] = int32_t{c};
+
+    dict = std::move(larger);
+    EXPECT_EQ(dict.size(), 26u);
+    EXPECT_EQ(dict.at("Xa"_tag), sam_tag_dictionary::variant_type{int32_t{'a'}});
+}
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/char_operations/predicate.hpp>
+#include <seqan3/io/detail/buffer_scan.hpp>
+#include <seqan3/io/sequence_file/format_fasta.hpp>
+#include <seqan3/io/sequence_file/format_fastq.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+// A stream buffer that only buffers three characters at a time, s.t. every scan crosses many buffer boundaries.
+struct small_buffer : public std::streambuf
+{
+    explicit small_buffer(std::string data) : data{std::move(data)}
+    {
+        setg(this->data.data(), this->data.data(), this->data.data());
+    }
+
+    int_type underflow() override
+    {
+        if (gptr() == data.data() + data.size())
+            return traits_type::eof();
+
+        setg(data.data(), gptr(), std::min(gptr() + 3, data.data() + data.size()));
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::string data;
+};
+
+TEST(buffer_scan, scan_buffer)
+{
+    small_buffer buffer{"AC GT\nACXT>"};
+    detail::fast_istreambuf_iterator<char> it{buffer};
+
+    detail::scan_table const table = detail::make_scan_table(is_char<'>'>, is_space, is_in_alphabet<dna4>);
+    std::vector<dna4> sequence{};
+    auto append = [&sequence] (char const * first, char const * last)
+    {
+        detail::append_converted(sequence, first, last);
+    };
+
+    EXPECT_EQ(detail::scan_buffer(it, table, append), detail::scan_status::invalid);
+    EXPECT_EQ(*it, 'X');
+    EXPECT_TRUE(std::ranges::equal(sequence, "ACGTAC"_dna4));
+
+    ++it;
+    EXPECT_EQ(detail::scan_buffer(it, table, append), detail::scan_status::stop);
+    EXPECT_EQ(*it, '>');
+    EXPECT_TRUE(std::ranges::equal(sequence, "ACGTACT"_dna4));
+
+    ++it;
+    EXPECT_EQ(detail::scan_buffer(it, table, append), detail::scan_status::end_of_input);
+    EXPECT_TRUE(it == std::ranges::default_sentinel);
+}
+
+TEST(buffer_scan, scan_buffer_limit)
+{
+    small_buffer buffer{"ACG\n T\n\nAC"};
+    detail::fast_istreambuf_iterator<char> it{buffer};
+
+    detail::scan_table const table = detail::make_scan_table([] (char) { return false; },
+                                                             is_space,
+                                                             [] (char) { return true; });
+    std::string result{};
+    auto append = [&result] (char const * first, char const * last) { result.append(first, last); };
+
+    // trailing whitespace after the last character is skipped
+    EXPECT_EQ(detail::scan_buffer(it, table, append, 4), detail::scan_status::limit);
+    EXPECT_EQ(result, "ACGT");
+    EXPECT_EQ(*it, 'A');
+}
+
+TEST(buffer_scan, read_line_until)
+{
+    small_buffer buffer{"ID1 comment\nID2\r\nID3"};
+    detail::fast_istreambuf_iterator<char> it{buffer};
+
+    std::string id{};
+    EXPECT_TRUE(detail::read_line_until(it, is_cntrl || is_blank, id));
+    EXPECT_EQ(id, "ID1");
+
+    id.clear();
+    EXPECT_TRUE(detail::read_line_until(it, is_char<'\r'> || is_char<'\n'>, id));
+    EXPECT_EQ(id, "ID2");
+
+    id.clear();
+    EXPECT_FALSE(detail::read_line_until(it, is_char<'\r'> || is_char<'\n'>, id));
+    EXPECT_EQ(id, "ID3");
+}
+
+TEST(buffer_scan, fasta_across_buffer_boundaries)
+{
+    small_buffer buffer{"> ID1 lala\nACGT\nACGT\n>ID2\nTTTT\n"};
+    std::istream stream{&buffer};
+    sequence_file_input fin{stream, format_fasta{}};
+
+    std::vector<std::string> ids{};
+    std::vector<dna5_vector> seqs{};
+    for (auto & record : fin)
+    {
+        ids.push_back(get<field::id>(record));
+        seqs.push_back(get<field::seq>(record));
+    }
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"ID1 lala", "ID2"}));
+    EXPECT_EQ(seqs, (std::vector<dna5_vector>{"ACGTACGT"_dna5, "TTTT"_dna5}));
+}
+
+TEST(buffer_scan, fastq_across_buffer_boundaries)
+{
+    small_buffer buffer{"@ID1\nACGT\nAC\n+\n!!!!\n##\n@ID2\nTT\n+ID2\n$$\n"};
+    std::istream stream{&buffer};
+    sequence_file_input fin{stream, format_fastq{}};
+
+    std::vector<dna5_vector> seqs{};
+    std::vector<std::vector<phred42>> quals{};
+    for (auto & record : fin)
+    {
+        seqs.push_back(get<field::seq>(record));
+        quals.push_back(get<field::qual>(record));
+    }
+
+    EXPECT_EQ(seqs, (std::vector<dna5_vector>{"ACGTAC"_dna5, "TT"_dna5}));
+    EXPECT_EQ(quals, (std::vector<std::vector<phred42>>{"!!!!##"_phred42, "$$"_phred42}));
+}
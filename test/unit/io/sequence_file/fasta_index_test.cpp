@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/std/algorithm>
+
+using namespace seqan3;
+
+struct fasta_index_f : public ::testing::Test
+{
+    std::string input
+    {
+        ">chr1 first chromosome\n"
+        "ACGTACGT\n"
+        "ACGTACGT\n"
+        "ACG\n"
+        ">chr2\r\n"
+        "GGTTA\r\n"
+        "CC\r\n"
+        ">chr3\n"
+        "NNNN"
+    };
+
+    std::vector<fasta_index_entry> expected
+    {
+        {"chr1", 19, 23, 8, 9},
+        {"chr2", 7, 52, 5, 7},
+        {"chr3", 4, 69, 4, 4}
+    };
+};
+
+TEST_F(fasta_index_f, build)
+{
+    std::istringstream stream{input};
+    fasta_index index{stream};
+
+    EXPECT_EQ(index.all(), expected);
+    EXPECT_TRUE(index.contains("chr2"));
+    EXPECT_FALSE(index.contains("chr4"));
+    EXPECT_EQ(index.at("chr2"), expected[1]);
+    EXPECT_THROW(index.at("chr4"), std::out_of_range);
+}
+
+TEST_F(fasta_index_f, fai_round_trip)
+{
+    std::istringstream stream{input};
+    fasta_index index{stream};
+
+    std::stringstream fai{};
+    index.write_fai(fai);
+    EXPECT_EQ(fai.str(), "chr1\t19\t23\t8\t9\nchr2\t7\t52\t5\t7\nchr3\t4\t69\t4\t4\n");
+
+    EXPECT_EQ(fasta_index::read_fai(fai).all(), expected);
+
+    std::istringstream invalid{"chr1\t19\t23\t8\n"};
+    EXPECT_THROW(fasta_index::read_fai(invalid), format_error);
+
+    // no bases per line for a non-empty sequence
+    std::istringstream no_line_bases{"chr1\t19\t23\t0\t0\n"};
+    EXPECT_THROW(fasta_index::read_fai(no_line_bases), format_error);
+
+    // more bases than bytes per line
+    std::istringstream too_few_line_bytes{"chr1\t19\t23\t8\t7\n"};
+    EXPECT_THROW(fasta_index::read_fai(too_few_line_bytes), format_error);
+
+    // an empty sequence has no lines
+    std::istringstream empty_sequence{"chr1\t0\t6\t0\t0\n"};
+    EXPECT_EQ(fasta_index::read_fai(empty_sequence).all().size(), 1u);
+}
+
+TEST_F(fasta_index_f, inconsistent_line_lengths)
+{
+    std::istringstream stream{">chr1\nACGT\nAC\nACGT\n"};
+    EXPECT_THROW(fasta_index{stream}, format_error);
+
+    std::istringstream duplicate{">chr1\nACGT\n>chr1\nACGT\n"};
+    EXPECT_THROW(fasta_index{duplicate}, format_error);
+}
+
+TEST_F(fasta_index_f, read_region)
+{
+    std::istringstream stream{input};
+    fasta_index index{stream};
+
+    std::string region{};
+    index.read_region(stream, "chr1", 6, 12, region);
+    EXPECT_EQ(region, "GTACGT");
+
+    region.clear();
+    index.read_region(stream, "chr1", 16, 19, region);
+    EXPECT_EQ(region, "ACG");
+
+    dna5_vector sequence{};
+    index.read_region(stream, "chr2", 0, 7, sequence);
+    EXPECT_TRUE((std::ranges::equal(sequence, "GGTTACC"_dna5)));
+
+    region.clear();
+    index.read_region(stream, "chr3", 2, 2, region);
+    EXPECT_EQ(region, "");
+
+    EXPECT_THROW(index.read_region(stream, "chr3", 2, 5, region), std::out_of_range);
+    EXPECT_THROW(index.read_region(stream, "chr4", 0, 1, region), std::out_of_range);
+}
+
+TEST_F(fasta_index_f, sequence_file_input_read_region)
+{
+    std::istringstream stream{input};
+    fasta_index index{stream};
+
+    sequence_file_input fin{std::istringstream{input}, format_fasta{}};
+    auto it = fin.begin();
+    EXPECT_EQ(get<field::id>(*it), "chr1 first chromosome");
+
+    EXPECT_TRUE((std::ranges::equal(fin.read_region(index, "chr3"), "NNNN"_dna5)));
+    EXPECT_TRUE((std::ranges::equal(fin.read_region(index, "chr1", 7, 10), "TAC"_dna5)));
+
+    // record-wise reading continues where it was
+    ++it;
+    EXPECT_EQ(get<field::id>(*it), "chr2");
+}
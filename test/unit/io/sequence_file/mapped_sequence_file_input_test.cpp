@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/sequence_file/mapped_input.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+struct mapped_sequence_file_input_f : public ::testing::Test
+{
+    void write(std::string const & content)
+    {
+        std::ofstream{filename.get_path(), std::ios::binary} << content;
+    }
+
+    test::tmp_filename filename{"mapped_sequence_file_input_test.fasta"};
+
+    std::string input
+    {
+        "> TEST 1\n"
+        "ACGT\n"
+        ">Test2\r\n"
+        "AGGCTGN AGG\r\n"
+        "CTGN\r\n"
+        ";Test3\n"
+        "GGAGTATAATATATATATATATAT"
+    };
+
+    std::vector<dna5_vector> seq_comp
+    {
+        "ACGT"_dna5,
+        "AGGCTGNAGGCTGN"_dna5,
+        "GGAGTATAATATATATATATATAT"_dna5
+    };
+
+    std::vector<std::string> id_comp
+    {
+        "TEST 1",
+        "Test2",
+        "Test3"
+    };
+};
+
+TEST_F(mapped_sequence_file_input_f, concepts)
+{
+    using t = mapped_sequence_file_input<>;
+    EXPECT_TRUE((std::ranges::input_range<t>));
+    EXPECT_FALSE((std::ranges::forward_range<t>));
+    EXPECT_TRUE((std::same_as<t::id_type, std::string_view>));
+}
+
+TEST_F(mapped_sequence_file_input_f, record_reading)
+{
+    write(input);
+    mapped_sequence_file_input fin{filename.get_path()};
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        ASSERT_LT(counter, 3u);
+        EXPECT_TRUE((std::ranges::equal(get<field::seq>(rec), seq_comp[counter])));
+        EXPECT_EQ(get<field::id>(rec), id_comp[counter]);
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(mapped_sequence_file_input_f, records_stay_valid)
+{
+    write(input);
+    mapped_sequence_file_input<dna4> fin{filename.get_path()};
+    fin.options.truncate_ids = true;
+
+    std::vector<typename decltype(fin)::record_type> records{};
+    for (auto & rec : fin)
+        records.push_back(rec);
+
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(get<field::id>(records[0]), "TEST");
+    EXPECT_TRUE((std::ranges::equal(get<field::seq>(records[0]), "ACGT"_dna4)));
+    EXPECT_EQ(get<field::id>(records[2]), "Test3");
+    EXPECT_TRUE((std::ranges::equal(get<field::seq>(records[2]), "GGAGTATAATATATATATATATAT"_dna4)));
+}
+
+TEST_F(mapped_sequence_file_input_f, header_characters_within_lines)
+{
+    write(">ID 1 > 2; 3\n"
+          "AC>GT\n"
+          "A;C\n"
+          ">ID2\n"
+          ">ID3\n"
+          "TT\n");
+    mapped_sequence_file_input fin{filename.get_path()};
+
+    std::vector<std::string> ids{};
+    std::vector<dna5_vector> seqs{};
+    for (auto & rec : fin)
+    {
+        ids.emplace_back(get<field::id>(rec));
+        seqs.push_back(get<field::seq>(rec) | views::to<dna5_vector>);
+    }
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"ID 1 > 2; 3", "ID2", "ID3"}));
+    ASSERT_EQ(seqs.size(), 3u);
+    EXPECT_EQ(seqs[0].size(), 8u); // the '>' and ';' are part of the sequence
+    EXPECT_TRUE(seqs[1].empty());
+    EXPECT_EQ(seqs[2], "TT"_dna5);
+}
+
+TEST_F(mapped_sequence_file_input_f, empty_file)
+{
+    write("");
+    mapped_sequence_file_input fin{filename.get_path()};
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(mapped_sequence_file_input_f, errors)
+{
+    EXPECT_THROW(mapped_sequence_file_input{filename.get_path()}, file_open_error);
+
+    write("@read\nACGT\n+\n!!!!\n");
+    EXPECT_THROW(mapped_sequence_file_input{filename.get_path()}, format_error);
+
+    // no ID line before the first sequence
+    write("ACGT\n>ID\nACGT\n");
+    EXPECT_THROW(mapped_sequence_file_input{filename.get_path()}, format_error);
+    write("\n  \nACGT\n");
+    EXPECT_THROW(mapped_sequence_file_input{filename.get_path()}, format_error);
+
+    write(std::string{'\x1f', '\x8b', '\x08', '\x00'});
+    EXPECT_THROW(mapped_sequence_file_input{filename.get_path()}, file_open_error);
+}
@@ -6,6 +6,8 @@
 // -----------------------------------------------------------------------------------------------------
 
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -315,6 +317,100 @@ TEST_F(sequence_file_input_f, file_view)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sequence_file_input_f, read_batches)
+{
+    sequence_file_input fin{std::istringstream{input}, format_fasta{}};
+
+    // small chunks s.t. every record is parsed in its own batch
+    size_t counter = 0;
+    size_t batches = 0;
+    fin.read_batches([&] (auto & batch)
+    {
+        for (auto & rec : batch)
+        {
+            EXPECT_TRUE((std::ranges::equal(get<field::seq>(rec), seq_comp[counter])));
+            EXPECT_TRUE((std::ranges::equal(get<field::id>(rec),  id_comp[counter])));
+            EXPECT_TRUE(empty(get<field::qual>(rec)));
+            ++counter;
+        }
+        ++batches;
+    }, 2, 8);
+
+    EXPECT_EQ(counter, 3u);
+    EXPECT_EQ(batches, 3u);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(sequence_file_input_f, read_batches_after_begin)
+{
+    sequence_file_input fin{std::istringstream{input}, format_fasta{}};
+    auto it = fin.begin();
+    ++it;
+
+    std::vector<std::string> ids{};
+    fin.read_batches([&] (auto & batch)
+    {
+        for (auto & rec : batch)
+            ids.push_back(get<field::id>(rec));
+    }, 4);
+
+    EXPECT_EQ(ids, (std::vector<std::string>{id_comp[1], id_comp[2]}));
+}
+
+TEST_F(sequence_file_input_f, read_batches_fastq)
+{
+    std::string fastq_input{};
+    for (size_t i = 0; i < 100; ++i)
+        fastq_input += "@read" + std::to_string(i) + "\nACGT\n+\n@@!#\n";
+
+    sequence_file_input fin{std::istringstream{fastq_input}, format_fastq{}};
+
+    size_t counter = 0;
+    fin.read_batches([&] (auto & batch)
+    {
+        for (auto & rec : batch)
+        {
+            EXPECT_EQ(get<field::id>(rec), "read" + std::to_string(counter));
+            EXPECT_TRUE((std::ranges::equal(get<field::seq>(rec), "ACGT"_dna5)));
+            EXPECT_TRUE((std::ranges::equal(get<field::qual>(rec), "@@!#"_phred42)));
+            ++counter;
+        }
+    }, 3, 64);
+
+    EXPECT_EQ(counter, 100u);
+}
+
+TEST_F(sequence_file_input_f, read_batches_fastq_multi_line)
+{
+    // sequences and qualities wrapped after three characters; quality lines begin with '@' and '+'
+    std::string fastq_input{};
+    for (size_t i = 0; i < 100; ++i)
+        fastq_input += "@read" + std::to_string(i) + "\nACG\nTAC\nG\n+\n@+!\n+@#\n!\n";
+
+    sequence_file_input fin{std::istringstream{fastq_input}, format_fastq{}};
+
+    size_t counter = 0;
+    fin.read_batches([&] (auto & batch)
+    {
+        for (auto & rec : batch)
+        {
+            EXPECT_EQ(get<field::id>(rec), "read" + std::to_string(counter));
+            EXPECT_TRUE((std::ranges::equal(get<field::seq>(rec), "ACGTACG"_dna5)));
+            EXPECT_TRUE((std::ranges::equal(get<field::qual>(rec), "@+!+@#!"_phred42)));
+            ++counter;
+        }
+    }, 3, 64);
+
+    EXPECT_EQ(counter, 100u);
+}
+
+TEST_F(sequence_file_input_f, read_batches_parse_error)
+{
+    sequence_file_input fin{std::istringstream{std::string{"> ID\nACGT\n> ID2\nAC!GT\n"}}, format_fasta{}};
+
+    EXPECT_THROW(fin.read_batches([] (auto &) {}, 2, 4), parse_error);
+}
+
 TEST_F(sequence_file_input_f, column_reading)
 {
     sequence_file_input fin{std::istringstream{input}, format_fasta{}};
@@ -553,3 +649,43 @@ TEST_F(sequence_file_input_f, read_empty_bz2_file)
     EXPECT_TRUE(fin.begin() == fin.end());
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+std::string input_zstd
+{
+    '\x28','\xB5','\x2F','\xFD','\x00','\x58','\xBD','\x01','\x00','\x04','\x03','\x3E','\x20','\x54','\x45','\x53',
+    '\x54','\x20','\x31','\x0A','\x41','\x43','\x47','\x54','\x0A','\x3E','\x54','\x65','\x73','\x74','\x32','\x0A',
+    '\x41','\x47','\x47','\x43','\x54','\x47','\x4E','\x0A','\x3E','\x20','\x54','\x65','\x73','\x74','\x33','\x0A',
+    '\x47','\x47','\x41','\x47','\x54','\x41','\x54','\x41','\x41','\x54','\x0A','\x01','\x00','\x4F','\x76','\x65'
+};
+
+TEST_F(sequence_file_input_f, decompression_by_filename_zst)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+
+        std::copy(begin(input_zstd), end(input_zstd), std::ostreambuf_iterator<char>{of});
+    }
+
+    sequence_file_input fin{filename.get_path()};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, decompression_by_stream_zst)
+{
+    sequence_file_input fin{std::istringstream{input_zstd}, format_fasta{}};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, read_empty_zst_file)
+{
+    std::string empty_zipped_file{'\x28', '\xB5', '\x2F', '\xFD', '\x20', '\x00', '\x01', '\x00', '\x00'};
+    sequence_file_input fin{std::istringstream{empty_zipped_file}, format_fasta{}};
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+#endif
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <optional>
 #include <sstream>
 
 #include <gtest/gtest.h>
@@ -13,8 +14,15 @@
 #include <range/v3/view/filter.hpp>
 
 #include <seqan3/alphabet/quality/phred42.hpp>
+#ifdef SEQAN3_HAS_ZLIB
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#endif
+#ifdef SEQAN3_HAS_ZSTD
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#endif
 #include <seqan3/io/sequence_file/output.hpp>
 #include <seqan3/range/shortcuts.hpp>
+#include <seqan3/test/bgzf.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 #include <seqan3/std/iterator>
 
@@ -429,11 +437,13 @@ TEST(columns, writing_seq_qual)
 // compression
 // ----------------------------------------------------------------------------
 
-std::string compression_by_filename_impl([[maybe_unused]]test::tmp_filename & filename)
+std::string compression_by_filename_impl([[maybe_unused]]test::tmp_filename & filename,
+                                         std::optional<int> const compression_level = std::nullopt)
 {
     {
         sequence_file_output fout{filename.get_path()};
         fout.options.fasta_letters_per_line = 0;
+        fout.options.compression_level = compression_level;
 
         for (size_t i = 0; i < 3; ++i)
         {
@@ -478,25 +488,11 @@ std::string expected_gz
     '\x93','\x00','\x00','\x00'
 };
 
-std::string expected_bgzf
-{
-    '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x06', '\x00', '\x42', '\x43',
-    '\x02', '\x00', '\x4A', '\x00', '\xB3', '\x53', '\x08', '\x71', '\x0D', '\x0E', '\x51', '\x30', '\xE4', '\x72',
-    '\x74', '\x76', '\x0F', '\xE1', '\xB2', '\x53', '\x08', '\x49', '\x2D', '\x2E', '\x31', '\xE2', '\x72', '\x74',
-    '\x77', '\x77', '\x0E', '\x71', '\xF7', '\xA3', '\x05', '\x05', '\xB5', '\xC3', '\x98', '\xCB', '\xDD', '\xDD',
-    '\xD1', '\x3D', '\xC4', '\x31', '\xC4', '\x11', '\x88', '\x50', '\x20', '\x17', '\x00', '\x27', '\xAD', '\xB4',
-    '\xE9', '\x93', '\x00', '\x00', '\x00', '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00',
-    '\xFF', '\x06', '\x00', '\x42', '\x43', '\x02', '\x00', '\x1B', '\x00', '\x03', '\x00', '\x00', '\x00', '\x00',
-    '\x00', '\x00', '\x00', '\x00', '\x00'
-};
-
 TEST(compression, by_filename_gz)
 {
     test::tmp_filename filename{"sequence_file_output_test.fasta.gz"};
 
-    std::string buffer = compression_by_filename_impl(filename);
-    buffer[9] = '\x00'; // zero out OS byte
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(test::decompress_bgzf(compression_by_filename_impl(filename)), output_comp);
 }
 
 TEST(compression, by_stream_gz)
@@ -517,9 +513,7 @@ TEST(compression, by_filename_bgzf)
 {
     test::tmp_filename filename{"sequence_file_output_test.fasta.bgzf"};
 
-    std::string buffer = compression_by_filename_impl(filename);
-    buffer[9] = '\x00'; // zero out OS byte
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(test::decompress_bgzf(compression_by_filename_impl(filename)), output_comp);
 }
 
 TEST(compression, by_stream_bgzf)
@@ -531,9 +525,23 @@ TEST(compression, by_stream_bgzf)
         compression_by_stream_impl(compout);
     }
 
-    std::string buffer = out.str();
-    buffer[9] = '\x00'; // zero out OS byte
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(test::decompress_bgzf(out.str()), output_comp);
+}
+
+TEST(compression, compression_level)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.gz"};
+
+    std::string stored = compression_by_filename_impl(filename, 0);
+    std::string best = compression_by_filename_impl(filename, 9);
+    EXPECT_GT(stored.size(), output_comp.size());
+    EXPECT_LT(best.size(), stored.size());
+
+    for (std::string const & buffer : {stored, best})
+        EXPECT_EQ(test::decompress_bgzf(buffer), output_comp);
+
+    // without a level, BGZF uses the fastest level
+    EXPECT_EQ(compression_by_filename_impl(filename), compression_by_filename_impl(filename, 1));
 }
 
 #endif
@@ -569,3 +577,37 @@ TEST(compression, by_stream_bz2)
     EXPECT_EQ(out.str(), expected_bz2);
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+TEST(compression, by_filename_zst)
+{
+    test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    // the compressed bytes depend on the version of libzstd
+    for (int compression_level : {1, 19})
+    {
+        std::istringstream in{compression_by_filename_impl(filename, compression_level)};
+        contrib::zstd_istream decompin{in};
+        std::string decompressed{std::istreambuf_iterator<char>{decompin}, std::istreambuf_iterator<char>{}};
+        EXPECT_EQ(decompressed, output_comp);
+    }
+
+    // without a level, zstd uses the default level of libzstd
+    EXPECT_EQ(compression_by_filename_impl(filename), compression_by_filename_impl(filename, ZSTD_CLEVEL_DEFAULT));
+}
+
+TEST(compression, by_stream_zst)
+{
+    std::ostringstream out;
+
+    {
+        contrib::zstd_ostream compout{out};
+        compression_by_stream_impl(compout);
+    }
+
+    std::istringstream in{out.str()};
+    contrib::zstd_istream decompin{in};
+    std::string decompressed{std::istreambuf_iterator<char>{decompin}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(decompressed, output_comp);
+}
+#endif
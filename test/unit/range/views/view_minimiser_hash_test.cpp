@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+#include <seqan3/range/views/to.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace seqan3;
+
+class minimiser_hash_test : public ::testing::Test
+{
+protected:
+    using result_t = std::vector<uint64_t>;
+
+    static inline auto ungapped_view = views::minimiser_hash(ungapped{3}, window_size{6}, seed{0});
+    static inline auto gapped_view = views::minimiser_hash(0b1101_shape, window_size{7}, seed{0});
+
+    std::vector<dna4> text1{"GGCAAGTTCGATACGTAGA"_dna4};
+    std::vector<dna4> const ctext1{"GGCAAGTTCGATACGTAGA"_dna4};
+    std::list<dna4> text2{text1.begin(), text1.end()};
+    std::forward_list<dna4> text3{text1.begin(), text1.end()};
+
+    result_t ungapped1{2, 1, 13, 12, 6, 6};
+    result_t ungapped_reverse_complement1{6, 6, 12, 13, 1, 2};
+    result_t ungapped_forward1{2, 11, 24, 12, 6, 8}; // only the forward strand is hashed for forward ranges
+    result_t gapped1{7, 3, 14, 1, 7};
+};
+
+TEST_F(minimiser_hash_test, concepts)
+{
+    auto v1 = text1 | ungapped_view;
+    EXPECT_TRUE(std::ranges::input_range<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v1)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v1), uint64_t>));
+
+    auto v2 = text3 | ungapped_view;
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v2)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v2)>);
+}
+
+TEST_F(minimiser_hash_test, ungapped)
+{
+    EXPECT_EQ(ungapped1, text1 | ungapped_view | views::to<result_t>);
+    EXPECT_EQ(ungapped1, ctext1 | ungapped_view | views::to<result_t>);
+    EXPECT_EQ(ungapped1, text2 | ungapped_view | views::to<result_t>);
+    EXPECT_EQ(ungapped_forward1, text3 | ungapped_view | views::to<result_t>);
+}
+
+TEST_F(minimiser_hash_test, gapped)
+{
+    EXPECT_EQ(gapped1, text1 | gapped_view | views::to<result_t>);
+    EXPECT_EQ(gapped1, text2 | gapped_view | views::to<result_t>);
+}
+
+TEST_F(minimiser_hash_test, reverse_complement)
+{
+    auto reverse_complement = text1 | views::complement | std::views::reverse;
+    EXPECT_EQ(ungapped_reverse_complement1, reverse_complement | ungapped_view | views::to<result_t>);
+}
+
+TEST_F(minimiser_hash_test, default_seed)
+{
+    // the order of the k-mers changes, 0x8F3F73B5CF1C9ADE is the default seed
+    result_t expected{0x8F3F73B5CF1C9AC1ULL, 0x8F3F73B5CF1C9AC6ULL, 0x8F3F73B5CF1C9AC6ULL,
+                      0x8F3F73B5CF1C9AC5ULL, 0x8F3F73B5CF1C9AC5ULL, 0x8F3F73B5CF1C9AC2ULL};
+
+    EXPECT_EQ(expected, text1 | views::minimiser_hash(ungapped{3}, window_size{6}) | views::to<result_t>);
+}
+
+TEST_F(minimiser_hash_test, short_text)
+{
+    std::vector<dna4> text{"ACGTA"_dna4};
+    EXPECT_TRUE(std::ranges::empty(text | ungapped_view | views::to<result_t>));
+}
+
+TEST_F(minimiser_hash_test, invalid_sizes)
+{
+    EXPECT_THROW(text1 | views::minimiser_hash(ungapped{4}, window_size{3}), std::invalid_argument);
+    EXPECT_THROW(text1 | views::minimiser_hash(ungapped{33}, window_size{40}), std::invalid_argument);
+}
@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <seqan3/range/views/minimiser.hpp>
+#include <seqan3/range/views/take_until.hpp>
+#include <seqan3/range/views/to.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace seqan3;
+
+class minimiser_test : public ::testing::Test
+{
+protected:
+    using result_t = std::vector<size_t>;
+
+    std::vector<size_t> text1{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    std::vector<size_t> const ctext1{text1};
+    std::list<size_t> text2{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    std::forward_list<size_t> text3{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    result_t result1{1, 2, 3};
+
+    std::vector<size_t> text4{5, 5, 5, 5};
+    result_t result4{5, 5, 5};
+};
+
+TEST_F(minimiser_test, concepts)
+{
+    auto v1 = text1 | views::minimiser(4);
+    EXPECT_TRUE(std::ranges::input_range<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v1)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v1)>);
+    EXPECT_TRUE(const_iterable_range<decltype(v1)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v1), size_t>));
+
+    auto v2 = text3 | views::minimiser(4);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v2)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v2)>);
+}
+
+TEST_F(minimiser_test, different_inputs)
+{
+    EXPECT_EQ(result1, text1 | views::minimiser(4) | views::to<result_t>);
+    EXPECT_EQ(result1, ctext1 | views::minimiser(4) | views::to<result_t>);
+    EXPECT_EQ(result1, text2 | views::minimiser(4) | views::to<result_t>);
+    EXPECT_EQ(result1, text3 | views::minimiser(4) | views::to<result_t>);
+}
+
+TEST_F(minimiser_test, window_sizes)
+{
+    // every value is its own window
+    EXPECT_EQ(text1, text1 | views::minimiser(1) | views::to<result_t>);
+    // a single window
+    EXPECT_EQ(result_t{1}, text1 | views::minimiser(11) | views::to<result_t>);
+    // the range is shorter than a window
+    EXPECT_TRUE(std::ranges::empty(text1 | views::minimiser(12) | views::to<result_t>));
+    EXPECT_THROW(text1 | views::minimiser(0), std::invalid_argument);
+}
+
+TEST_F(minimiser_test, ties)
+{
+    // the last of several minimal values is the minimiser
+    EXPECT_EQ(result4, text4 | views::minimiser(2) | views::to<result_t>);
+}
+
+TEST_F(minimiser_test, positions)
+{
+    auto v = text1 | views::minimiser(4);
+    std::vector<size_t> positions{};
+    for (auto it = v.begin(); it != v.end(); ++it)
+        positions.push_back(it.position());
+
+    EXPECT_EQ((std::vector<size_t>{3, 6, 9}), positions);
+}
+
+TEST_F(minimiser_test, two_ranges)
+{
+    std::vector<size_t> second{7, 7, 0, 7, 7, 7, 7, 7, 1, 7, 7};
+    detail::minimiser_view v{text1, second, 4};
+
+    EXPECT_EQ((result_t{0, 1, 2, 1}), v | views::to<result_t>);
+}
+
+TEST_F(minimiser_test, combinability)
+{
+    auto stop_at_nine = views::take_until([] (size_t const x) { return x == 9; });
+    EXPECT_EQ(result_t{1}, text1 | stop_at_nine | views::minimiser(4) | views::to<result_t>);
+    EXPECT_EQ((result_t{2, 1, 1}), text1 | std::views::reverse | views::minimiser(6) | views::to<result_t>);
+}
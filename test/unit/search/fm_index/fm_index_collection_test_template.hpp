@@ -11,6 +11,7 @@
 
 #include <seqan3/search/fm_index/all.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 
 using namespace seqan3;
 
@@ -153,6 +154,56 @@ TYPED_TEST_P(fm_index_collection_test, serialisation)
 
     index_t fm{text};
     test::do_serialisation(fm);
+
+    // with the optional data structures
+    fm_index_construction_options options{};
+    options.kmer_lookup_length = 2;
+    options.document_listing = true;
+
+    index_t fm_options{text, options};
+    test::do_serialisation(fm_options);
+}
+
+TYPED_TEST_P(fm_index_collection_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+    using inner_text_type = value_type_t<text_t>;
+
+    text_t text{inner_text_type(4), inner_text_type(12), inner_text_type(7)};
+    text[1][5] = assign_rank_to(1, value_type_t<inner_text_type>{});
+
+    index_t fm0{text};
+
+    test::tmp_filename tmp{"construction"};
+    std::filesystem::path const tmp_directory = tmp.get_path().parent_path();
+
+    fm_index_construction_options options{};
+    options.construction = fm_index_construction::semi_external;
+    options.tmp_directory = tmp_directory;
+
+    // semi-external construction of the suffix array (no memory budget)
+    index_t fm1{text, options};
+    EXPECT_EQ(fm0, fm1);
+
+    // semi-external construction with a memory budget that suffices to build the suffix array in memory
+    options.ram_budget = 1ULL << 30;
+    options.thread_count = 2;
+    index_t fm2{text, options};
+    EXPECT_EQ(fm0, fm2);
+
+    // in-memory construction with the parallel suffix array construction
+    options.construction = fm_index_construction::in_memory;
+    for (uint32_t thread_count : {2u, 3u, 8u})
+    {
+        options.thread_count = thread_count;
+        index_t fm3{text, options};
+        EXPECT_EQ(fm0, fm3);
+    }
+
+    // no intermediate files are left behind
+    EXPECT_TRUE(std::filesystem::is_empty(tmp_directory));
 }
 
-REGISTER_TYPED_TEST_CASE_P(fm_index_collection_test, ctr, swap, size, serialisation, concept_check, empty_text);
+REGISTER_TYPED_TEST_CASE_P(fm_index_collection_test, ctr, swap, size, serialisation, concept_check, empty_text,
+                           construction_options);
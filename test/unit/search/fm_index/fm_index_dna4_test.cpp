@@ -8,10 +8,27 @@
 #include "fm_index_collection_test_template.hpp"
 #include "fm_index_test_template.hpp"
 
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/std/algorithm>
+
+#include <random>
+
 using t1 = std::pair<fm_index<dna4, text_layout::single>, std::vector<dna4>>;
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, fm_index_test, t1);
 using t2 = std::pair<fm_index<dna4, text_layout::collection>, std::vector<std::vector<dna4>>>;
 INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection, fm_index_collection_test, t2);
+using t3 = std::pair<fm_index<dna4, text_layout::single, sdsl_epr_index_type<dna4, text_layout::single>>,
+                     std::vector<dna4>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, fm_index_test, t3);
+using t4 = std::pair<fm_index<dna4, text_layout::collection, sdsl_epr_index_type<dna4, text_layout::collection>>,
+                     std::vector<std::vector<dna4>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr_collection, fm_index_collection_test, t4);
+using t5 = std::pair<fm_index<dna4, text_layout::single, sdsl_r_index_type<dna4, text_layout::single>>,
+                     std::vector<dna4>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_r_index, fm_index_test, t5);
+using t6 = std::pair<fm_index<dna4, text_layout::collection, sdsl_r_index_type<dna4, text_layout::collection>>,
+                     std::vector<std::vector<dna4>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_r_index_collection, fm_index_collection_test, t6);
 
 TEST(fm_index_test, additional_concepts)
 {
@@ -48,3 +65,150 @@ TEST(fm_index_test, cerealisation_errors)
     }
 #endif
 }
+
+TEST(fm_index_test, sampling)
+{
+    EXPECT_TRUE((std::same_as<sdsl_wt_index_type, sampled_sdsl_wt_index_type<16>>));
+    EXPECT_TRUE((detail::sdsl_index<sampled_sdsl_wt_index_type<64>>));
+    EXPECT_TRUE((detail::sdsl_index<sampled_sdsl_wt_index_type<4, 10000000, sa_sampling::text_order>>));
+
+    std::vector<dna4> text{"ACGTACGTTAGCATGCATGCAACGTACGTAGGTACAGT"_dna4};
+
+    // the sampling has no influence on counting, but on the size of the index
+    fm_index<dna4, text_layout::single, sampled_sdsl_wt_index_type<2>> dense{text};
+    fm_index<dna4, text_layout::single, sampled_sdsl_wt_index_type<32>> sparse{text};
+    EXPECT_EQ(dense.size(), sparse.size());
+
+    auto dense_cur = dense.begin();
+    auto sparse_cur = sparse.begin();
+    EXPECT_TRUE(dense_cur.extend_right("ACGTA"_dna4));
+    EXPECT_TRUE(sparse_cur.extend_right("ACGTA"_dna4));
+    EXPECT_EQ(dense_cur.count(), sparse_cur.count());
+
+    auto dense_hits = dense_cur.locate();
+    auto sparse_hits = sparse_cur.locate();
+    std::ranges::sort(dense_hits);
+    std::ranges::sort(sparse_hits);
+    EXPECT_EQ(dense_hits, (std::vector<uint64_t>{0, 21, 25}));
+    EXPECT_EQ(dense_hits, sparse_hits);
+}
+
+TEST(fm_index_test, epr_index)
+{
+    // spans several blocks of the occurrence table
+    std::mt19937_64 engine{42};
+    std::vector<dna4> text(1000);
+    for (auto & c : text)
+        c.assign_rank(engine() % 4);
+
+    fm_index<dna4, text_layout::single> wt_index{text};
+    fm_index<dna4, text_layout::single, sdsl_epr_index_type<dna4, text_layout::single, 7>> epr_index{text};
+    EXPECT_EQ(wt_index.size(), epr_index.size());
+
+    for (size_t begin = 0; begin + 6 <= text.size(); begin += 37)
+    {
+        auto query = std::vector<dna4>(text.begin() + begin, text.begin() + begin + 6);
+
+        auto wt_cur = wt_index.begin();
+        auto epr_cur = epr_index.begin();
+        EXPECT_TRUE(wt_cur.extend_right(query));
+        EXPECT_TRUE(epr_cur.extend_right(query));
+        EXPECT_EQ(wt_cur.count(), epr_cur.count());
+
+        auto wt_hits = wt_cur.locate();
+        auto epr_hits = epr_cur.locate();
+        std::ranges::sort(wt_hits);
+        std::ranges::sort(epr_hits);
+        EXPECT_EQ(wt_hits, epr_hits);
+    }
+
+    // the text must not contain more characters than the index was configured for
+    std::vector<dna5> dna5_text{"ACGTNACGTN"_dna5};
+    using too_small_t = fm_index<dna5, text_layout::single, sdsl_epr_index_type<dna4, text_layout::single>>;
+    EXPECT_THROW(too_small_t{dna5_text}, std::invalid_argument);
+}
+
+TEST(fm_index_test, r_index)
+{
+    // a collection of similar texts, i.e. a BWT with long runs
+    std::mt19937_64 engine{42};
+    std::vector<dna4> genome(300);
+    for (auto & c : genome)
+        c.assign_rank(engine() % 4);
+
+    std::vector<std::vector<dna4>> genomes(20, genome);
+    for (auto & g : genomes)
+        g[engine() % g.size()].assign_rank(engine() % 4);
+
+    fm_index<dna4, text_layout::collection> wt_index{genomes};
+    fm_index<dna4, text_layout::collection, sdsl_r_index_type<dna4, text_layout::collection>> r_index{genomes};
+    EXPECT_EQ(wt_index.size(), r_index.size());
+
+    for (size_t begin = 0; begin + 8 <= genome.size(); begin += 17)
+    {
+        auto query = std::vector<dna4>(genome.begin() + begin, genome.begin() + begin + 8);
+
+        auto wt_cur = wt_index.begin();
+        auto r_cur = r_index.begin();
+        EXPECT_EQ(wt_cur.extend_right(query), r_cur.extend_right(query));
+        EXPECT_EQ(wt_cur.count(), r_cur.count());
+
+        auto wt_hits = wt_cur.locate();
+        auto r_hits = r_cur.locate();
+        std::ranges::sort(wt_hits);
+        std::ranges::sort(r_hits);
+        EXPECT_EQ(wt_hits, r_hits);
+
+        auto r_lazy_hits = r_cur.lazy_locate() | views::to<std::vector>;
+        std::ranges::sort(r_lazy_hits);
+        EXPECT_EQ(r_lazy_hits, r_hits);
+    }
+
+    // the occurrences of the empty string and of a single character (toehold after zero and one backward search step)
+    for (size_t depth = 0; depth < 2; ++depth)
+    {
+        auto wt_cur = wt_index.begin();
+        auto r_cur = r_index.begin();
+        if (depth == 1)
+        {
+            EXPECT_TRUE(wt_cur.extend_right());
+            EXPECT_TRUE(r_cur.extend_right());
+        }
+
+        auto wt_hits = wt_cur.locate();
+        auto r_hits = r_cur.locate();
+        std::ranges::sort(wt_hits);
+        std::ranges::sort(r_hits);
+        EXPECT_EQ(wt_hits, r_hits);
+    }
+
+    // the text must not contain more characters than the index was configured for
+    std::vector<dna5> dna5_text{"ACGTNACGTN"_dna5};
+    using too_small_t = fm_index<dna5, text_layout::single, sdsl_r_index_type<dna4, text_layout::single>>;
+    EXPECT_THROW(too_small_t{dna5_text}, std::invalid_argument);
+}
+
+TEST(fm_index_test, kmer_lookup_table)
+{
+    std::vector<dna4> text{"ACGTACGTACGGGTTTACGATCGA"_dna4};
+
+    fm_index_construction_options options{};
+    options.kmer_lookup_length = 4;
+
+    fm_index index{text};
+    fm_index index_lookup{text, options};
+    EXPECT_EQ(index_lookup.kmer_lookup_length(), 4u);
+    EXPECT_NE(index, index_lookup);
+
+    test::do_serialisation(index_lookup);
+
+    fm_index<dna4, text_layout::single> index_copy{index_lookup};
+    EXPECT_EQ(index_copy.kmer_lookup_length(), 4u);
+    auto it = index_copy.begin();
+    EXPECT_TRUE(it.extend_right("ACGTA"_dna4));
+    EXPECT_EQ(it.count(), 2u);
+
+    // the table must not contain more than 2^32 k-mers
+    options.kmer_lookup_length = 17;
+    EXPECT_THROW((fm_index{text, options}), std::invalid_argument);
+}
@@ -7,10 +7,12 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
 #include <type_traits>
 
 #include <seqan3/search/fm_index/all.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 
 using namespace seqan3;
 
@@ -118,4 +120,88 @@ TYPED_TEST_P(fm_index_test, serialisation)
     test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_CASE_P(fm_index_test, ctr, swap, size, concept_check, empty_text, serialisation);
+TYPED_TEST_P(fm_index_test, serialisation_version)
+{
+#if SEQAN3_WITH_CEREAL
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+
+    text_t text(10);
+    index_t fm{text};
+
+    std::string archive{};
+    {
+        std::ostringstream stream{};
+        cereal::BinaryOutputArchive oarchive{stream};
+        oarchive(fm);
+        archive = stream.str();
+    }
+
+    auto load = [] (std::string const & archive)
+    {
+        std::istringstream stream{archive};
+        cereal::BinaryInputArchive iarchive{stream};
+        index_t in_fm{};
+        iarchive(in_fm);
+    };
+
+    // the archive starts with the tag (8 bytes) and the version (4 bytes) of the format
+    std::string other_tag{archive};
+    other_tag[0] = static_cast<char>(other_tag[0] + 1);
+    EXPECT_THROW(load(other_tag), std::logic_error);
+
+    std::string other_version{archive};
+    other_version[8] = static_cast<char>(other_version[8] + 1);
+    EXPECT_THROW(load(other_version), std::logic_error);
+
+    // the layout of SeqAn 3.0.0 has neither the tag and the version nor the flags of the optional data structures
+    // (1 byte each) at the end
+    std::string layout_3_0_0{archive.substr(12, archive.size() - 14)};
+    EXPECT_THROW(load(layout_3_0_0), std::logic_error);
+
+    EXPECT_NO_THROW(load(archive));
+#endif // SEQAN3_WITH_CEREAL
+}
+
+TYPED_TEST_P(fm_index_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+
+    text_t text(10);
+    text[3] = text[7] = assign_rank_to(1, value_type_t<text_t>{});
+
+    index_t fm0{text};
+
+    test::tmp_filename tmp{"construction"};
+    std::filesystem::path const tmp_directory = tmp.get_path().parent_path();
+
+    fm_index_construction_options options{};
+    options.construction = fm_index_construction::semi_external;
+    options.tmp_directory = tmp_directory;
+
+    // semi-external construction of the suffix array (no memory budget)
+    index_t fm1{text, options};
+    EXPECT_EQ(fm0, fm1);
+
+    // semi-external construction with a memory budget that suffices to build the suffix array in memory
+    options.ram_budget = 1ULL << 30;
+    options.thread_count = 2;
+    index_t fm2{text, options};
+    EXPECT_EQ(fm0, fm2);
+
+    // in-memory construction with the parallel suffix array construction
+    options.construction = fm_index_construction::in_memory;
+    for (uint32_t thread_count : {2u, 3u, 8u})
+    {
+        options.thread_count = thread_count;
+        index_t fm3{text, options};
+        EXPECT_EQ(fm0, fm3);
+    }
+
+    // no intermediate files are left behind
+    EXPECT_TRUE(std::filesystem::is_empty(tmp_directory));
+}
+
+REGISTER_TYPED_TEST_CASE_P(fm_index_test, ctr, swap, size, concept_check, empty_text, serialisation,
+                           serialisation_version, construction_options);
@@ -9,3 +9,44 @@
 
 using it_t1 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection>>;
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, bi_fm_index_cursor_collection_test, it_t1);
+
+using it_t2 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection,
+                                             sdsl_epr_index_type<dna4, text_layout::collection>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, bi_fm_index_cursor_collection_test, it_t2);
+
+using it_t3 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection,
+                                             sdsl_r_index_type<dna4, text_layout::collection>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_r_index, bi_fm_index_cursor_collection_test, it_t3);
+
+TEST(bi_fm_index_cursor_collection_test, kmer_lookup_table)
+{
+    std::vector<std::vector<dna4>> text(3);
+    random_text(text[0], 100);
+    random_text(text[1], 2);
+    random_text(text[2], 200);
+
+    fm_index_construction_options options{};
+    options.kmer_lookup_length = 4;
+
+    bi_fm_index index{text};
+    bi_fm_index index_lookup{text, options};
+
+    for (auto const & query : all_strings(6))
+    {
+        auto it = index.begin();
+        auto it_lookup = index_lookup.begin();
+
+        bool const found = it.extend_right(query);
+        ASSERT_EQ(it_lookup.extend_right(query), found);
+        if (!found)
+            continue;
+
+        EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+
+        it = index.begin();
+        it_lookup = index_lookup.begin();
+        ASSERT_TRUE(it.extend_left(query));
+        ASSERT_TRUE(it_lookup.extend_left(query));
+        EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+    }
+}
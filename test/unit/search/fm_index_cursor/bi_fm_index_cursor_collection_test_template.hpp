@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <functional>
 #include <type_traits>
 
 #include "../helper.hpp"
@@ -236,5 +237,35 @@ TYPED_TEST_P(bi_fm_index_cursor_collection_test, to_rev_cursor)
     }
 }
 
+TYPED_TEST_P(bi_fm_index_cursor_collection_test, document_counts)
+{
+    std::vector<std::vector<dna4>> text{"ACGTACGT"_dna4, "TGCGATACGA"_dna4, ""_dna4, "CGCG"_dna4};
+
+    fm_index_construction_options options{};
+    options.document_listing = true;
+
+    typename TypeParam::index_type bi_fm{text};
+    typename TypeParam::index_type bi_fm_documents{text, options};
+
+    for (auto & index : {std::cref(bi_fm), std::cref(bi_fm_documents)})
+    {
+        // the root contains every character once, but neither the sentinel nor the delimiters
+        TypeParam it = index.get().begin();
+        EXPECT_EQ(it.documents(), (std::vector<uint64_t>{0, 1, 3}));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 8}, {1, 10}, {3, 4}}));
+
+        EXPECT_TRUE(it.extend_right("CG"_dna4));
+        EXPECT_EQ(it.documents(), (std::vector<uint64_t>{0, 1, 3}));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 2}, {1, 2}, {3, 2}}));
+
+        EXPECT_TRUE(it.extend_left("A"_dna4)); // "ACG"
+        EXPECT_EQ(it.documents(), (std::vector<uint64_t>{0, 1}));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 2}, {1, 1}}));
+
+        EXPECT_TRUE(it.extend_left("T"_dna4)); // "TACG"
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 1}, {1, 1}}));
+    }
+}
+
 REGISTER_TYPED_TEST_CASE_P(bi_fm_index_cursor_collection_test, begin, extend, extend_char, extend_range,
-                           extend_and_cycle, extend_range_and_cycle, to_fwd_cursor, to_rev_cursor);
+                           extend_and_cycle, extend_range_and_cycle, to_fwd_cursor, to_rev_cursor, document_counts);
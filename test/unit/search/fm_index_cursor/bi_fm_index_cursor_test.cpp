@@ -9,3 +9,100 @@
 
 using it_t1 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single>>;
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, bi_fm_index_cursor_test, it_t1);
+
+using it_t2 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single,
+                                             sdsl_epr_index_type<dna4, text_layout::single>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, bi_fm_index_cursor_test, it_t2);
+
+using it_t3 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single,
+                                             sdsl_r_index_type<dna4, text_layout::single>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_r_index, bi_fm_index_cursor_test, it_t3);
+
+TEST(bi_fm_index_cursor_test, kmer_lookup_table)
+{
+    std::vector<dna4> text;
+    random_text(text, 300);
+
+    fm_index_construction_options options{};
+    options.kmer_lookup_length = 3;
+
+    bi_fm_index index{text};
+    bi_fm_index index_lookup{text, options};
+    EXPECT_EQ(index_lookup.kmer_lookup_length(), 3u);
+
+    for (auto const & query : all_strings(5))
+    {
+        // extend_right() and cycle_back()
+        auto it = index.begin();
+        auto it_lookup = index_lookup.begin();
+
+        bool const found = it.extend_right(query);
+        ASSERT_EQ(it_lookup.extend_right(query), found);
+        if (!found)
+            continue;
+
+        EXPECT_EQ(it_lookup.query_length(), it.query_length());
+        EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+
+        // the reverse interval has been set
+        if (it.extend_left("A"_dna4))
+        {
+            ASSERT_TRUE(it_lookup.extend_left("A"_dna4));
+            EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+        }
+        else
+        {
+            EXPECT_FALSE(it_lookup.extend_left("A"_dna4));
+        }
+
+        it = index.begin();
+        it_lookup = index_lookup.begin();
+        it.extend_right(query);
+        it_lookup.extend_right(query);
+
+        if (!query.empty())
+        {
+            EXPECT_EQ(it_lookup.last_rank(), it.last_rank());
+            while (it.cycle_back())
+            {
+                ASSERT_TRUE(it_lookup.cycle_back());
+                EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+            }
+            EXPECT_FALSE(it_lookup.cycle_back());
+        }
+
+        // extend_left() and cycle_front()
+        it = index.begin();
+        it_lookup = index_lookup.begin();
+
+        ASSERT_TRUE(it.extend_left(query));
+        ASSERT_TRUE(it_lookup.extend_left(query));
+        EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+
+        if (it.extend_right("C"_dna4))
+        {
+            ASSERT_TRUE(it_lookup.extend_right("C"_dna4));
+            EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+        }
+        else
+        {
+            EXPECT_FALSE(it_lookup.extend_right("C"_dna4));
+        }
+
+        it = index.begin();
+        it_lookup = index_lookup.begin();
+        it.extend_left(query);
+        it_lookup.extend_left(query);
+
+        if (!query.empty())
+        {
+            EXPECT_EQ(it_lookup.last_rank(), it.last_rank());
+            while (it.cycle_front())
+            {
+                ASSERT_TRUE(it_lookup.cycle_front());
+                EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+            }
+            EXPECT_FALSE(it_lookup.cycle_front());
+        }
+    }
+}
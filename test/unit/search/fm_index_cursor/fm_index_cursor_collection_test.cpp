@@ -18,3 +18,26 @@ INSTANTIATE_TYPED_TEST_CASE_P(bi_default_traits, fm_index_cursor_collection_test
 
 using it_t4 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection, sdsl_byte_index_type>>;
 INSTANTIATE_TYPED_TEST_CASE_P(bi_byte_alphabet_traits, fm_index_cursor_collection_test, it_t4);
+
+using sparse_sampling_t = sampled_sdsl_wt_index_type<64>;
+using it_t5 = fm_index_cursor<fm_index<dna4, text_layout::collection, sparse_sampling_t>>;
+INSTANTIATE_TYPED_TEST_CASE_P(sparse_sa_sampling, fm_index_cursor_collection_test, it_t5);
+
+using text_order_sampling_t = sampled_sdsl_wt_index_type<2, 10000000, sa_sampling::text_order>;
+using it_t6 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection, text_order_sampling_t>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_text_order_sa_sampling, fm_index_cursor_collection_test, it_t6);
+
+using it_t7 = fm_index_cursor<fm_index<dna4, text_layout::collection,
+                                       sdsl_epr_index_type<dna4, text_layout::collection>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(epr_traits, fm_index_cursor_collection_test, it_t7);
+
+using it_t8 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection,
+                                             sdsl_epr_index_type<dna4, text_layout::collection, 3>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_epr_traits, fm_index_cursor_collection_test, it_t8);
+
+using it_t9 = fm_index_cursor<fm_index<dna4, text_layout::collection, sdsl_r_index_type<dna4, text_layout::collection>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(r_index_traits, fm_index_cursor_collection_test, it_t9);
+
+using it_t10 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::collection,
+                                              sdsl_r_index_type<dna4, text_layout::collection>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_r_index_traits, fm_index_cursor_collection_test, it_t10);
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <functional>
 #include <type_traits>
 
 #include "../helper.hpp"
@@ -328,6 +329,64 @@ TYPED_TEST_P(fm_index_cursor_collection_test, lazy_locate)
     EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
 }
 
+TYPED_TEST_P(fm_index_cursor_collection_test, locate_cursors)
+{
+    std::vector<std::vector<dna4>> text(3);
+    for (auto & t : text)
+        random_text(t, 300);
+    typename TypeParam::index_type fm{text};
+
+    // the occurrences of all strings up to length 2 exceed a single batch
+    std::vector<TypeParam> cursors;
+    for (auto const & query : all_strings(2))
+    {
+        TypeParam it = TypeParam(fm);
+        if (it.extend_right(query))
+            cursors.push_back(it);
+    }
+
+    auto const occurrences = TypeParam::locate(cursors);
+    ASSERT_EQ(occurrences.size(), cursors.size());
+    for (size_t i = 0; i < cursors.size(); ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(occurrences[i], cursors[i].lazy_locate()));
+        EXPECT_EQ(occurrences[i], cursors[i].locate());
+    }
+}
+
+TYPED_TEST_P(fm_index_cursor_collection_test, document_counts)
+{
+    std::vector<std::vector<dna4>> text{"ACGTACGT"_dna4, "TGCGATACGA"_dna4, ""_dna4, "CGCG"_dna4};
+
+    fm_index_construction_options options{};
+    options.document_listing = true;
+
+    typename TypeParam::index_type fm{text};
+    typename TypeParam::index_type fm_documents{text, options};
+
+    for (auto & index : {std::cref(fm), std::cref(fm_documents)})
+    {
+        // the root contains every character once, but neither the sentinel nor the delimiters
+        TypeParam it = TypeParam(index.get());
+        EXPECT_EQ(it.documents(), (std::vector<uint64_t>{0, 1, 3}));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 8}, {1, 10}, {3, 4}}));
+
+        EXPECT_TRUE(it.extend_right("ACG"_dna4));
+        EXPECT_EQ(it.documents(), (std::vector<uint64_t>{0, 1}));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 2}, {1, 1}}));
+
+        it = TypeParam(index.get());
+        EXPECT_TRUE(it.extend_right("CG"_dna4));
+        EXPECT_EQ(it.documents(), (std::vector<uint64_t>{0, 1, 3}));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{0, 2}, {1, 2}, {3, 2}}));
+
+        EXPECT_TRUE(it.extend_right("C"_dna4));
+        EXPECT_EQ(it.document_counts(), (std::vector<std::pair<uint64_t, uint64_t>>{{3, 1}}));
+    }
+
+    EXPECT_NE(fm, fm_documents);
+}
+
 TYPED_TEST_P(fm_index_cursor_collection_test, concept_check)
 {
     EXPECT_TRUE(fm_index_cursor_specialisation<TypeParam>);
@@ -336,4 +395,4 @@ TYPED_TEST_P(fm_index_cursor_collection_test, concept_check)
 REGISTER_TYPED_TEST_CASE_P(fm_index_cursor_collection_test, ctr, begin, extend_right_range,
                            extend_right_range_empty_text, extend_right_char, extend_right_range_and_cycle,
                            extend_right_char_and_cycle, extend_right_and_cycle, query, last_rank, incomplete_alphabet,
-                           lazy_locate, concept_check);
+                           lazy_locate, locate_cursors, document_counts, concept_check);
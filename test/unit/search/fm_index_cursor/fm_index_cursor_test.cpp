@@ -18,3 +18,73 @@ INSTANTIATE_TYPED_TEST_CASE_P(bi_default_traits, fm_index_cursor_test, it_t3);
 
 using it_t4 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single, sdsl_byte_index_type>>;
 INSTANTIATE_TYPED_TEST_CASE_P(bi_byte_alphabet_traits, fm_index_cursor_test, it_t4);
+
+using sparse_sampling_t = sampled_sdsl_wt_index_type<64>;
+using it_t5 = fm_index_cursor<fm_index<dna4, text_layout::single, sparse_sampling_t>>;
+INSTANTIATE_TYPED_TEST_CASE_P(sparse_sa_sampling, fm_index_cursor_test, it_t5);
+
+using text_order_sampling_t = sampled_sdsl_wt_index_type<2, 10000000, sa_sampling::text_order>;
+using it_t6 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single, text_order_sampling_t>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_text_order_sa_sampling, fm_index_cursor_test, it_t6);
+
+using it_t7 = fm_index_cursor<fm_index<dna4, text_layout::single, sdsl_epr_index_type<dna4, text_layout::single>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(epr_traits, fm_index_cursor_test, it_t7);
+
+using it_t8 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single,
+                                             sdsl_epr_index_type<dna4, text_layout::single, 3>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_epr_traits, fm_index_cursor_test, it_t8);
+
+using it_t9 = fm_index_cursor<fm_index<dna4, text_layout::single, sdsl_r_index_type<dna4, text_layout::single>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(r_index_traits, fm_index_cursor_test, it_t9);
+
+using it_t10 = bi_fm_index_cursor<bi_fm_index<dna4, text_layout::single,
+                                              sdsl_r_index_type<dna4, text_layout::single>>>;
+INSTANTIATE_TYPED_TEST_CASE_P(bi_r_index_traits, fm_index_cursor_test, it_t10);
+
+template <typename index_t>
+void test_kmer_lookup_table()
+{
+    std::vector<dna4> text;
+    random_text(text, 300);
+
+    fm_index_construction_options options{};
+    options.kmer_lookup_length = 3;
+
+    index_t index{text};
+    index_t index_lookup{text, options};
+    EXPECT_EQ(index.kmer_lookup_length(), 0u);
+    EXPECT_EQ(index_lookup.kmer_lookup_length(), 3u);
+
+    for (auto const & query : all_strings(5))
+    {
+        auto it = index.begin();
+        auto it_lookup = index_lookup.begin();
+
+        bool const found = it.extend_right(query);
+        ASSERT_EQ(it_lookup.extend_right(query), found);
+        if (!found)
+            continue;
+
+        EXPECT_EQ(it_lookup.query_length(), it.query_length());
+        EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+
+        // the parent node and the last character have been set
+        if (!query.empty())
+        {
+            EXPECT_EQ(it_lookup.last_rank(), it.last_rank());
+            while (it.cycle_back())
+            {
+                ASSERT_TRUE(it_lookup.cycle_back());
+                EXPECT_EQ(it_lookup.last_rank(), it.last_rank());
+                EXPECT_EQ(uniquify(it_lookup.locate()), uniquify(it.locate()));
+            }
+            EXPECT_FALSE(it_lookup.cycle_back());
+        }
+    }
+}
+
+TEST(fm_index_cursor_test, kmer_lookup_table)
+{
+    test_kmer_lookup_table<fm_index<dna4, text_layout::single>>();
+    test_kmer_lookup_table<fm_index<dna4, text_layout::single, sdsl_epr_index_type<dna4, text_layout::single>>>();
+}
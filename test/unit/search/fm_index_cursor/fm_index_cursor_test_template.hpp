@@ -297,6 +297,32 @@ TYPED_TEST_P(fm_index_cursor_test, lazy_locate)
     EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
 }
 
+TYPED_TEST_P(fm_index_cursor_test, locate_cursors)
+{
+    std::vector<dna4> text;
+    random_text(text, 1000);
+    typename TypeParam::index_type fm{text};
+
+    // the occurrences of all strings up to length 2 exceed a single batch
+    std::vector<TypeParam> cursors;
+    for (auto const & query : all_strings(2))
+    {
+        TypeParam it = TypeParam(fm);
+        if (it.extend_right(query))
+            cursors.push_back(it);
+    }
+
+    auto const occurrences = TypeParam::locate(cursors);
+    ASSERT_EQ(occurrences.size(), cursors.size());
+    for (size_t i = 0; i < cursors.size(); ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(occurrences[i], cursors[i].lazy_locate()));
+        EXPECT_EQ(occurrences[i], cursors[i].locate());
+    }
+
+    EXPECT_TRUE(TypeParam::locate(std::vector<TypeParam>{}).empty());
+}
+
 TYPED_TEST_P(fm_index_cursor_test, concept_check)
 {
     EXPECT_TRUE(fm_index_cursor_specialisation<TypeParam>);
@@ -304,4 +330,4 @@ TYPED_TEST_P(fm_index_cursor_test, concept_check)
 
 REGISTER_TYPED_TEST_CASE_P(fm_index_cursor_test, ctr, begin, extend_right_range, extend_right_char,
                            extend_right_range_and_cycle, extend_right_char_and_cycle, extend_right_and_cycle, query,
-                           last_rank, incomplete_alphabet, lazy_locate, concept_check);
+                           last_rank, incomplete_alphabet, lazy_locate, locate_cursors, concept_check);
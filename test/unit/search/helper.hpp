@@ -54,4 +54,23 @@ void random_text(std::vector<dna4> & text, uint64_t const length)
         assign_rank_to(std::rand() % alphabet_size, text[i]);
 }
 
+// All strings over dna4 up to the given length, including the empty string.
+std::vector<std::vector<dna4>> all_strings(size_t const max_length)
+{
+    std::vector<std::vector<dna4>> strings(1);
+    for (size_t i = 0; i < strings.size(); ++i)
+    {
+        if (strings[i].size() == max_length)
+            continue;
+
+        for (uint8_t rank = 0; rank < 4; ++rank)
+        {
+            std::vector<dna4> extended{strings[i]};
+            extended.push_back(assign_rank_to(rank, dna4{}));
+            strings.push_back(std::move(extended));
+        }
+    }
+    return strings;
+}
+
 } // namespace std
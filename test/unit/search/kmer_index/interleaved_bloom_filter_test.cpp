@@ -0,0 +1,163 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <sstream>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/search/kmer_index/interleaved_bloom_filter.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/test/cereal.hpp>
+
+#include "../helper.hpp"
+
+using namespace seqan3;
+
+TEST(interleaved_bloom_filter_test, construction)
+{
+    interleaved_bloom_filter ibf{bin_count{70}, bin_size{1000}, hash_function_count{3}};
+
+    EXPECT_EQ(ibf.bin_count(), 70u);
+    EXPECT_EQ(ibf.bin_size(), 1024u); // rounded up to a power of two
+    EXPECT_EQ(ibf.hash_function_count(), 3u);
+    EXPECT_EQ(ibf.bit_size(), 1024u * 128u); // two words per row
+
+    EXPECT_THROW((interleaved_bloom_filter{bin_count{0}, bin_size{1000}}), std::invalid_argument);
+    EXPECT_THROW((interleaved_bloom_filter{bin_count{1}, bin_size{0}}), std::invalid_argument);
+    EXPECT_THROW((interleaved_bloom_filter{bin_count{1}, bin_size{1}, hash_function_count{0}}),
+                 std::invalid_argument);
+    EXPECT_THROW((interleaved_bloom_filter{bin_count{1}, bin_size{1}, hash_function_count{6}}),
+                 std::invalid_argument);
+}
+
+TEST(interleaved_bloom_filter_test, emplace_and_bulk_contains)
+{
+    interleaved_bloom_filter ibf{bin_count{130}, bin_size{1 << 16}};
+
+    for (size_t bin = 0; bin < 130; ++bin)
+        ibf.emplace(bin * 1000, bin_index{bin});
+
+    // no false negatives
+    for (size_t bin = 0; bin < 130; ++bin)
+        EXPECT_TRUE(ibf.bulk_contains(bin * 1000)[bin]);
+
+    // few false positives for a filter this sparse
+    size_t false_positives{0};
+    for (size_t value = 1; value < 1000; ++value)
+        for (bool const contained : ibf.bulk_contains(value))
+            false_positives += contained;
+    EXPECT_LT(false_positives, 10u);
+
+    auto counts = ibf.bulk_count(std::vector<uint64_t>{0, 0, 5000, 129000});
+    EXPECT_GE(counts[0], 2u);
+    EXPECT_GE(counts[5], 1u);
+    EXPECT_GE(counts[129], 1u);
+}
+
+#if SEQAN3_WITH_CEREAL
+TEST(interleaved_bloom_filter_test, hash_functions_of_zero)
+{
+    // the set bits of the serialised filter, i.e. of the bins and of the parameters
+    auto set_bits = [] (interleaved_bloom_filter const & ibf)
+    {
+        std::ostringstream stream{};
+        {
+            cereal::BinaryOutputArchive archive{stream};
+            archive(ibf);
+        }
+
+        size_t bits{0};
+        for (unsigned char const byte : stream.str())
+            bits += std::bitset<8>{byte}.count();
+        return bits;
+    };
+
+    // each hash function sets a bit of a different row, also for the value 0
+    for (size_t h = 1; h <= 5; ++h)
+    {
+        interleaved_bloom_filter ibf{bin_count{1}, bin_size{1 << 16}, hash_function_count{h}};
+        size_t const empty_bits = set_bits(ibf);
+
+        ibf.emplace(0, bin_index{0});
+        EXPECT_EQ(set_bits(ibf) - empty_bits, h);
+    }
+}
+#endif
+
+TEST(interleaved_bloom_filter_test, kmer_lemma_threshold)
+{
+    EXPECT_EQ(kmer_lemma_threshold(100, shape{ungapped{20}}, 0), 81u);
+    EXPECT_EQ(kmer_lemma_threshold(100, shape{ungapped{20}}, 2), 41u);
+    EXPECT_EQ(kmer_lemma_threshold(100, shape{ungapped{20}}, 5), 0u);
+    EXPECT_EQ(kmer_lemma_threshold(10, shape{ungapped{20}}, 0), 0u);
+    EXPECT_EQ(kmer_lemma_threshold(100, shape{0b10111_shape}, 1), 91u); // the span of a gapped shape counts
+}
+
+TEST(interleaved_bloom_filter_test, select_bins)
+{
+    std::vector<std::vector<dna4>> genomes(100);
+    for (auto & genome : genomes)
+        random_text(genome, 2000);
+
+    shape const s{ungapped{15}};
+    interleaved_bloom_filter ibf{genomes, s, bin_size{1 << 15}};
+
+    for (size_t bin = 0; bin < genomes.size(); bin += 7)
+    {
+        std::vector<dna4> read{genomes[bin].begin() + 500, genomes[bin].begin() + 600};
+        std::vector<size_t> selected = ibf.select_bins(read, s, 0);
+        EXPECT_TRUE(std::ranges::find(selected, bin) != selected.end());
+        EXPECT_LT(selected.size(), 5u);
+
+        // two substitutions
+        read[10] = dna4{}.assign_rank((read[10].to_rank() + 1) % 4);
+        read[80] = dna4{}.assign_rank((read[80].to_rank() + 1) % 4);
+        selected = ibf.select_bins(read, s, 2);
+        EXPECT_TRUE(std::ranges::find(selected, bin) != selected.end());
+    }
+
+    // the threshold is 0, every bin may contain the read
+    std::vector<dna4> short_read{genomes[0].begin(), genomes[0].begin() + 20};
+    EXPECT_EQ(ibf.select_bins(short_read, s, 1).size(), genomes.size());
+}
+
+TEST(interleaved_bloom_filter_test, collection_bins)
+{
+    std::vector<std::vector<std::vector<dna4>>> bins{{"ACGTACGTAC"_dna4, "TT"_dna4}, {"GGGGCCCCGG"_dna4}};
+    interleaved_bloom_filter ibf{bins, shape{ungapped{4}}, bin_size{1024}};
+
+    EXPECT_EQ(ibf.bin_count(), 2u);
+
+    std::vector<dna4> query{"ACGTAC"_dna4};
+    auto counts = ibf.bulk_count(query | views::kmer_hash(shape{ungapped{4}}));
+    EXPECT_EQ(counts[0], 3u);
+}
+
+TEST(interleaved_bloom_filter_test, parallel_construction)
+{
+    std::vector<std::vector<dna4>> genomes(200);
+    for (auto & genome : genomes)
+        random_text(genome, 300);
+
+    interleaved_bloom_filter ibf1{genomes, shape{ungapped{12}}, bin_size{4096}, hash_function_count{2}};
+    interleaved_bloom_filter ibf4{genomes, shape{ungapped{12}}, bin_size{4096}, hash_function_count{2}, 4};
+
+    EXPECT_EQ(ibf1, ibf4);
+}
+
+TEST(interleaved_bloom_filter_test, serialisation)
+{
+    std::vector<std::vector<dna4>> genomes(3);
+    for (auto & genome : genomes)
+        random_text(genome, 100);
+
+    interleaved_bloom_filter ibf{genomes, shape{ungapped{8}}, bin_size{512}, hash_function_count{3}};
+    test::do_serialisation(ibf);
+}
@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/test/cereal.hpp>
+
+#include "../helper.hpp"
+
+using namespace seqan3;
+
+// all positions of the k-mer in the text that agree on the positions set in the shape
+template <typename text_t, typename kmer_t>
+std::vector<uint64_t> naive_locate(text_t const & text, kmer_t const & kmer, shape const & s)
+{
+    std::vector<uint64_t> hits;
+    for (uint64_t i = 0; i + s.size() <= text.size(); ++i)
+    {
+        bool match{true};
+        for (size_t j = 0; j < s.size(); ++j)
+            match &= !s[j] || text[i + j] == kmer[j];
+        if (match)
+            hits.push_back(i);
+    }
+    return hits;
+}
+
+template <typename hit_t>
+std::vector<hit_t> sorted(std::vector<hit_t> hits)
+{
+    std::ranges::sort(hits);
+    return hits;
+}
+
+TEST(kmer_index_test, single_text)
+{
+    std::vector<dna4> text{"ACGTACGTTTACGAACGT"_dna4};
+    kmer_index index{text, shape{ungapped{4}}};
+
+    EXPECT_EQ(index.size(), text.size() - 3);
+    EXPECT_FALSE(index.empty());
+    EXPECT_EQ(index.kmer_shape(), shape{ungapped{4}});
+
+    EXPECT_EQ(index.count("ACGT"_dna4), 3u);
+    EXPECT_EQ(sorted(index.locate("ACGT"_dna4)), (std::vector<uint64_t>{0, 4, 14}));
+    EXPECT_EQ(index.count("GGGG"_dna4), 0u);
+    EXPECT_TRUE(index.locate("GGGG"_dna4).empty());
+}
+
+TEST(kmer_index_test, text_shorter_than_shape)
+{
+    std::vector<dna4> text{"ACG"_dna4};
+    kmer_index index{text, shape{ungapped{4}}};
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.count("ACGT"_dna4), 0u);
+}
+
+TEST(kmer_index_test, random_text)
+{
+    std::vector<dna4> text;
+    random_text(text, 10000);
+
+    // direct addressing for short k-mers, hashing for long ones
+    for (shape const & s : {shape{ungapped{3}}, shape{0b1101_shape}, shape{ungapped{12}}, shape{0b110010111_shape}})
+    {
+        kmer_index index{text, s};
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            std::vector<dna4> kmer{text.begin() + i * 50, text.begin() + i * 50 + s.size()};
+            EXPECT_EQ(sorted(index.locate(kmer)), naive_locate(text, kmer, s));
+            EXPECT_EQ(index.count(kmer), naive_locate(text, kmer, s).size());
+        }
+    }
+}
+
+TEST(kmer_index_test, collection)
+{
+    std::vector<std::vector<dna4>> texts{"ACGTACGT"_dna4, ""_dna4, "AC"_dna4, "TTACGTAA"_dna4};
+    kmer_index index{texts, shape{bin_literal{0b1011}}};
+
+    using hit_t = std::pair<uint64_t, uint64_t>;
+    EXPECT_EQ(index.size(), 10u);
+    EXPECT_EQ(sorted(index.locate("ACGT"_dna4)), (std::vector<hit_t>{{0, 0}, {0, 4}, {3, 2}}));
+    EXPECT_EQ(sorted(index.locate("ACTT"_dna4)), (std::vector<hit_t>{{0, 0}, {0, 4}, {3, 2}}));
+    EXPECT_EQ(index.count("CGTA"_dna4), 2u); // k-mers spanning two texts are not indexed
+}
+
+TEST(kmer_index_test, parallel_construction)
+{
+    std::vector<std::vector<dna4>> texts(3);
+    random_text(texts[0], 5000);
+    random_text(texts[1], 3);
+    random_text(texts[2], 7000);
+
+    for (shape const & s : {shape{ungapped{5}}, shape{ungapped{20}}})
+    {
+        kmer_index index1{texts, s};
+        kmer_index index4{texts, s, 4};
+        kmer_index index64{texts, s, 64};
+
+        EXPECT_EQ(index1, index4);
+        EXPECT_EQ(index1, index64);
+    }
+}
+
+TEST(kmer_index_test, invalid_arguments)
+{
+    std::vector<dna4> text{"ACGTACGT"_dna4};
+    EXPECT_THROW((kmer_index{text, shape{ungapped{33}}}), std::invalid_argument);
+
+    kmer_index index{text, shape{ungapped{4}}};
+    EXPECT_THROW(index.count("ACG"_dna4), std::invalid_argument);
+    EXPECT_THROW(index.locate("ACGTA"_dna4), std::invalid_argument);
+}
+
+TEST(kmer_index_test, search)
+{
+    std::vector<dna4> text{"ACGTACGTTTACGAACGT"_dna4};
+    kmer_index index{text, shape{ungapped{4}}};
+
+    EXPECT_EQ(sorted(search("TTTA"_dna4, index)), (std::vector<uint64_t>{7}));
+
+    std::vector<std::vector<dna4>> queries{"TTTA"_dna4, "GGGG"_dna4, "CGAA"_dna4};
+    auto hits = search(queries, index);
+    ASSERT_EQ(hits.size(), 3u);
+    EXPECT_EQ(hits[0], (std::vector<uint64_t>{7}));
+    EXPECT_TRUE(hits[1].empty());
+    EXPECT_EQ(hits[2], (std::vector<uint64_t>{11}));
+}
+
+TEST(kmer_index_test, serialisation)
+{
+    std::vector<dna4> text;
+    random_text(text, 1000);
+    kmer_index index{text, shape{0b10111_shape}};
+    test::do_serialisation(index);
+
+    std::vector<std::vector<dna4>> texts(2);
+    random_text(texts[0], 100);
+    random_text(texts[1], 200);
+    kmer_index collection_index{texts, shape{ungapped{16}}};
+    test::do_serialisation(collection_index);
+}
@@ -0,0 +1,124 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/search/kmer_index/minimiser_index.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/test/cereal.hpp>
+
+#include "../helper.hpp"
+
+using namespace seqan3;
+
+using hit_t = std::pair<uint64_t, uint64_t>;
+
+TEST(minimiser_index_test, collection)
+{
+    std::vector<std::vector<dna4>> texts{"ACGGCGACGTTTAGACGTTACGAT"_dna4,
+                                         "TTGACCATTAGGCAGGATCCGTAA"_dna4,
+                                         "GGATCCGTAACGTCTAAACGTCGCCGT"_dna4};
+    minimiser_index index{texts, ungapped{4}, window_size{8}};
+
+    EXPECT_EQ(index.size(), 20u);
+    EXPECT_FALSE(index.empty());
+    EXPECT_EQ(index.kmer_shape(), shape{ungapped{4}});
+    EXPECT_EQ(index.window_size().get(), 8u);
+
+    std::vector<dna4> read{"GACGTTTAGACG"_dna4};
+    using seed_t = std::pair<uint64_t, hit_t>;
+    EXPECT_EQ(index.locate(read), (std::vector<seed_t>{{4, {0, 9}}, {4, {2, 14}}, {6, {0, 11}}, {6, {2, 12}}}));
+    EXPECT_EQ(index.count(read), 4u);
+    EXPECT_EQ(index.containment(read), (std::vector<double>{1.0, 0.0, 1.0}));
+
+    // canonical k-mers: the reverse complement finds the same occurrences
+    auto reverse_complement = read | views::complement | std::views::reverse | views::to<std::vector<dna4>>;
+    EXPECT_EQ(index.locate(reverse_complement),
+              (std::vector<seed_t>{{2, {0, 11}}, {2, {2, 12}}, {4, {0, 9}}, {4, {2, 14}}}));
+    EXPECT_EQ(index.containment(reverse_complement), (std::vector<double>{1.0, 0.0, 1.0}));
+
+    EXPECT_EQ(index.containment("AGGATCCGTAACG"_dna4), (std::vector<double>{0.5, 0.5, 1.0}));
+
+    // queries shorter than a window have no minimisers
+    EXPECT_TRUE(index.locate("ACGGCGA"_dna4).empty());
+    EXPECT_EQ(index.count("ACGGCGA"_dna4), 0u);
+    EXPECT_EQ(index.containment("ACGGCGA"_dna4), (std::vector<double>{0.0, 0.0, 0.0}));
+}
+
+TEST(minimiser_index_test, random_text)
+{
+    std::vector<dna4> text;
+    random_text(text, 10000);
+
+    for (shape const & s : {shape{ungapped{5}}, shape{0b11011_shape}, shape{ungapped{15}}})
+    {
+        minimiser_index index{text, s, window_size{24}};
+
+        // only a fraction of the k-mers are stored
+        EXPECT_LT(index.size(), (text.size() - s.size() + 1) / 4);
+
+        // each minimiser of a substring of the text occurs at the same position in the text
+        for (uint64_t offset = 0; offset < 9900; offset += 99)
+        {
+            std::vector<dna4> query{text.begin() + offset, text.begin() + offset + 40};
+            auto seeds = index.locate(query);
+            ASSERT_FALSE(seeds.empty());
+
+            for (auto const & [query_position, hit] : seeds)
+            {
+                EXPECT_TRUE(std::ranges::any_of(seeds, [&, p = query_position] (auto const & seed)
+                {
+                    return seed.first == p && seed.second == offset + p;
+                }));
+            }
+
+            EXPECT_EQ(index.containment(query), 1.0);
+        }
+    }
+}
+
+TEST(minimiser_index_test, parallel_construction)
+{
+    std::vector<std::vector<dna4>> texts(5);
+    random_text(texts[0], 5000);
+    random_text(texts[1], 3);
+    random_text(texts[2], 7000);
+    random_text(texts[3], 100);
+    random_text(texts[4], 2000);
+
+    minimiser_index index1{texts, ungapped{12}, window_size{20}};
+    minimiser_index index4{texts, ungapped{12}, window_size{20}, seed{0x8F3F73B5CF1C9ADEULL}, 4};
+    minimiser_index index64{texts, ungapped{12}, window_size{20}, seed{0x8F3F73B5CF1C9ADEULL}, 64};
+
+    EXPECT_EQ(index1, index4);
+    EXPECT_EQ(index1, index64);
+}
+
+TEST(minimiser_index_test, invalid_arguments)
+{
+    std::vector<dna4> text{"ACGTACGT"_dna4};
+    EXPECT_THROW((minimiser_index{text, ungapped{33}, window_size{40}}), std::invalid_argument);
+    EXPECT_THROW((minimiser_index{text, ungapped{5}, window_size{4}}), std::invalid_argument);
+    EXPECT_THROW((minimiser_index{text, shape{}, window_size{4}}), std::invalid_argument);
+}
+
+TEST(minimiser_index_test, serialisation)
+{
+    std::vector<dna4> text;
+    random_text(text, 1000);
+    minimiser_index index{text, 0b10111_shape, window_size{10}};
+    test::do_serialisation(index);
+
+    std::vector<std::vector<dna4>> texts(2);
+    random_text(texts[0], 100);
+    random_text(texts[1], 200);
+    minimiser_index collection_index{texts, ungapped{16}, window_size{30}, seed{42}};
+    test::do_serialisation(collection_index);
+}
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/search/fm_index/all.hpp>
 
 #include <gtest/gtest.h>
@@ -31,3 +32,21 @@ TYPED_TEST(sdsl_index_test, concepts)
 {
     EXPECT_TRUE(seqan3::detail::sdsl_index<sdsl_index<TypeParam>>);
 }
+
+TEST(sdsl_index_test, epr_index)
+{
+    using epr_collection_index_t = seqan3::sdsl_epr_index_type<seqan3::dna4, seqan3::text_layout::collection>;
+
+    EXPECT_TRUE((seqan3::detail::sdsl_index<seqan3::detail::epr_index<4>>));
+    EXPECT_TRUE(seqan3::detail::sdsl_index<epr_collection_index_t>);
+}
+
+TEST(sdsl_index_test, r_index)
+{
+    using r_collection_index_t = seqan3::sdsl_r_index_type<seqan3::dna4, seqan3::text_layout::collection>;
+
+    EXPECT_TRUE((seqan3::detail::sdsl_index<seqan3::detail::r_index<4>>));
+    EXPECT_TRUE(seqan3::detail::sdsl_index<r_collection_index_t>);
+    EXPECT_TRUE(seqan3::detail::suffix_array_interval_index<r_collection_index_t>);
+    EXPECT_FALSE(seqan3::detail::suffix_array_interval_index<seqan3::default_sdsl_index_type>);
+}
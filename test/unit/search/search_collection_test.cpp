@@ -147,6 +147,25 @@ TYPED_TEST(search_test, multiple_queries)
                                                                           {{0, 0}, {0, 4}, {1, 0}, {1, 4}}}));
 }
 
+TYPED_TEST(search_test, both_strands)
+{
+    using result_t = std::pair<typename TypeParam::size_type, typename TypeParam::size_type>;
+    using hits_result_t = std::vector<std::pair<result_t, search_strand>>;
+
+    std::vector<std::vector<dna4>> text{"ACGTTTGC"_dna4, "AAAACCG"_dna4};
+    TypeParam index{text};
+    configuration const cfg = strand{both_strands};
+
+    // the reverse complement of "TTTG" is "CAAA"
+    EXPECT_EQ(search("TTTG"_dna4, index, cfg), (hits_result_t{{{0, 3}, search_strand::forward}}));
+    EXPECT_EQ(search("TTTT"_dna4, index, cfg), (hits_result_t{{{1, 0}, search_strand::reverse_complement}}));
+
+    std::vector<std::vector<dna4>> queries{"GTTT"_dna4, "CGGT"_dna4};
+    EXPECT_EQ(search(queries, index, cfg), (std::vector<hits_result_t>{{{{0, 2}, search_strand::forward},
+                                                                         {{1, 1}, search_strand::reverse_complement}},
+                                                                        {{{1, 3}, search_strand::reverse_complement}}}));
+}
+
 TYPED_TEST(search_string_test, error_free_string)
 {
     using result_t = std::pair<typename TypeParam::size_type, typename TypeParam::size_type>;
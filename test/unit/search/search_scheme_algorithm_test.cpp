@@ -314,4 +314,51 @@ TEST(search_scheme_test, search_scheme_edit)
     test_search_scheme_edit(detail::optimum_search_scheme<0, 3>, seed, SEQAN3_SEARCH_TEST_ITERATIONS);
 }
 
+TEST(search_scheme_test, optimised_search_scheme_edit)
+{
+    time_t seed = std::time(nullptr);
+    std::srand(seed);
+
+    dna4_vector text, query;
+    random_text(text, 1000);
+    bi_fm_index index(text);
+
+    for (uint8_t max_error = 4; max_error <= 5; ++max_error)
+    {
+        for (uint64_t query_length = 3; query_length < 14; ++query_length)
+        {
+            auto const scheme = detail::optimised_search_scheme(0, max_error, query_length, 4, text.size());
+            auto const & [search_scheme, blocks_length] = *scheme;
+            auto const block_info = detail::search_scheme_block_info(search_scheme, blocks_length);
+
+            for (uint64_t i = 0; i < SEQAN3_SEARCH_TEST_ITERATIONS / 10 + 1; ++i)
+            {
+                random_text(query, query_length);
+
+                uint8_t const substitution = std::rand() % (max_error + 1);
+                uint8_t const insertion    = std::rand() % (max_error + 1);
+                uint8_t const deletion     = std::rand() % (max_error + 1);
+                detail::search_param error_left{max_error, substitution, insertion, deletion};
+
+                std::vector<uint64_t> hits_trivial, hits_ss;
+
+                detail::search_ss<false>(index, query, error_left, search_scheme, block_info,
+                                         [&hits_ss] (auto const & it)
+                {
+                    auto const & hits_tmp = it.locate();
+                    hits_ss.insert(hits_ss.end(), hits_tmp.begin(), hits_tmp.end());
+                });
+
+                detail::search_trivial<false>(index, query, error_left, [&hits_trivial] (auto const & it)
+                {
+                    auto const & hits_tmp = it.locate();
+                    hits_trivial.insert(hits_trivial.end(), hits_tmp.begin(), hits_tmp.end());
+                });
+
+                EXPECT_EQ(uniquify(hits_ss), uniquify(hits_trivial)) << "Seed: " << seed;
+            }
+        }
+    }
+}
+
 #undef SEQAN3_SEARCH_TEST_ITERATIONS
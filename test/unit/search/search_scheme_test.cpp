@@ -6,11 +6,13 @@
 // -----------------------------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <numeric>
 #include <type_traits>
 
 #include "helper_search_scheme.hpp"
 
 #include <seqan3/search/algorithm/detail/search_scheme_algorithm.hpp>
+#include <seqan3/std/algorithm>
 
 #include <gtest/gtest.h>
 
@@ -112,6 +114,76 @@ TEST(search_scheme_test, error_distribution_coverage_computed_search_schemes)
     EXPECT_EQ(actual, expected);
 }
 
+TEST(search_scheme_test, error_distribution_coverage_prefix_bounded_search_schemes)
+{
+    std::vector<std::vector<uint8_t> > expected, actual;
+
+    for (uint8_t max_error = 0; max_error <= 6; ++max_error)
+    {
+        for (uint8_t min_error = 0; min_error <= max_error; min_error += 2)
+        {
+            for (uint8_t blocks = max_error + 1; blocks <= max_error + 3; ++blocks)
+            {
+                auto const ss{detail::prefix_bounded_search_scheme(min_error, max_error, blocks)};
+                EXPECT_EQ(ss.size(), blocks);
+
+                // every error distribution has to be covered at least once
+                search_scheme_error_distribution(actual, ss);
+                search_scheme_error_distribution(expected, trivial_search_scheme(min_error, max_error, blocks));
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+                actual.erase(std::unique(actual.begin(), actual.end()), actual.end());
+                EXPECT_EQ(actual, expected);
+            }
+        }
+    }
+}
+
+TEST(search_scheme_test, prefix_bounded_search_scheme_max_blocks)
+{
+    auto const ss{detail::prefix_bounded_search_scheme(0, 254, 255)};
+    ASSERT_EQ(ss.size(), 255u);
+
+    std::vector<uint8_t> blocks(255);
+    std::iota(blocks.begin(), blocks.end(), 1);
+
+    for (size_t first = 1; first <= 255; ++first)
+    {
+        std::vector<uint8_t> pi{ss[first - 1].pi};
+        EXPECT_EQ(pi.front(), first);
+        EXPECT_EQ(ss[first - 1].u.back(), 254);
+        std::sort(pi.begin(), pi.end());
+        EXPECT_EQ(pi, blocks);
+    }
+}
+
+TEST(search_scheme_test, optimised_search_scheme)
+{
+    for (uint8_t max_error = 4; max_error <= 8; ++max_error)
+    {
+        for (size_t query_length : {1ul, 5ul, 10ul, 50ul, 150ul, 1000ul})
+        {
+            auto const scheme = detail::optimised_search_scheme(0, max_error, query_length, 4, 1ul << 30);
+            auto const & [ss, blocks_length] = *scheme;
+
+            ASSERT_FALSE(ss.empty());
+            EXPECT_EQ(ss.front().blocks(), blocks_length.size());
+            EXPECT_EQ(std::accumulate(blocks_length.begin(), blocks_length.end(), 0ul), query_length);
+            EXPECT_TRUE(std::ranges::all_of(blocks_length, [] (size_t const length) { return length > 0; }));
+
+            // queries that cannot be split into more blocks than errors are searched by trivial backtracking
+            if (query_length <= max_error)
+                EXPECT_EQ(ss.size(), 1u);
+            else
+                EXPECT_LE(detail::search_scheme_cost(ss, blocks_length, 4, 1ul << 30),
+                          detail::search_scheme_cost(detail::compute_ss(0, max_error), {query_length}, 4, 1ul << 30));
+
+            // the result is cached
+            EXPECT_EQ(detail::optimised_search_scheme(0, max_error, query_length, 4, 1ul << 30), scheme);
+        }
+    }
+}
+
 template <uint8_t min_error, uint8_t max_error, bool precomputed_scheme>
 bool check_disjoint_search_scheme()
 {
@@ -35,7 +35,9 @@ public:
 };
 
 using fm_index_types        = ::testing::Types<fm_index<dna4, text_layout::single>,
-                                               bi_fm_index<dna4, text_layout::single>>;
+                                               bi_fm_index<dna4, text_layout::single>,
+                                               bi_fm_index<dna4, text_layout::single,
+                                                           sdsl_epr_index_type<dna4, text_layout::single>>>;
 using fm_index_string_types = ::testing::Types<fm_index<char, text_layout::single>,
                                                bi_fm_index<char, text_layout::single>>;
 
@@ -122,6 +124,49 @@ TYPED_TEST(search_test, multiple_queries)
     EXPECT_EQ(uniquify(search(queries, this->index, cfg)), (hits_result_t{{}, {0}, {0, 4}})); // 0, 1 and 2 hits
 }
 
+TYPED_TEST(search_test, batched_queries)
+{
+    using hits_result_t = std::vector<std::vector<typename TypeParam::size_type>>;
+
+    std::srand(42);
+    std::vector<dna4> text;
+    random_text(text, 1000);
+    TypeParam index{text};
+
+    // more queries than fit into one batch, some of them do not occur in the text
+    std::vector<std::vector<dna4>> queries;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        size_t const begin = std::rand() % 990;
+        queries.emplace_back(text.begin() + begin, text.begin() + begin + 4 + i % 7);
+        if (i % 5 == 0)
+            queries.back().push_back('A'_dna4);
+    }
+
+    hits_result_t expected;
+    for (auto & query : queries)
+        expected.push_back(uniquify(search(query, index)));
+
+    EXPECT_EQ(uniquify(search(queries, index)), expected);
+    EXPECT_EQ(uniquify(search(queries, index, mode{all_best})), expected);
+
+    // small batches are refilled
+    hits_result_t hits(queries.size());
+    detail::search_batch_exact<3>(index, queries, [&] (size_t const query_id, auto const & cursor)
+    {
+        hits[query_id] = uniquify(cursor.locate());
+    });
+    EXPECT_EQ(uniquify(hits), expected);
+
+    // the cursors are seeded from the k-mer lookup table
+    fm_index_construction_options options{};
+    options.kmer_lookup_length = 5;
+    TypeParam index_lookup{text, options};
+
+    EXPECT_EQ(uniquify(search(queries, index_lookup)), expected);
+    EXPECT_EQ(search(queries, index_lookup, max_error{total{1}}), search(queries, index, max_error{total{1}}));
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     configuration const cfg = max_error{total{0}, substitution{1}};
@@ -420,6 +465,155 @@ TYPED_TEST(search_test, search_strategy_strata)
     // }
 }
 
+TYPED_TEST(search_test, both_strands)
+{
+    using hits_result_t = std::vector<std::pair<typename TypeParam::size_type, search_strand>>;
+    using query_t = std::vector<dna4>;
+
+    std::vector<dna4> text{"ACGTTTGCAAAACCG"_dna4};
+    TypeParam index{text};
+    configuration const cfg = strand{both_strands};
+
+    // the reverse complement of "TTTG" is "CAAA"
+    EXPECT_EQ(search("TTTG"_dna4, index, cfg), (hits_result_t{{3, search_strand::forward},
+                                                               {7, search_strand::reverse_complement}}));
+    EXPECT_EQ(search("CAAA"_dna4, index, cfg), (hits_result_t{{7, search_strand::forward},
+                                                               {3, search_strand::reverse_complement}}));
+    EXPECT_EQ(search("GGGG"_dna4, index, cfg), (hits_result_t{}));
+
+    // "ACGT" is its own reverse complement
+    EXPECT_EQ(search("ACGT"_dna4, index, cfg), (hits_result_t{{0, search_strand::forward},
+                                                               {0, search_strand::reverse_complement}}));
+
+    // "TTTT" only occurs with an error, its reverse complement "AAAA" without errors
+    EXPECT_EQ(search("TTTT"_dna4, index, cfg | max_error{total{1}} | mode{all_best}),
+              (hits_result_t{{8, search_strand::reverse_complement}}));
+    EXPECT_EQ(search("TTTT"_dna4, index, cfg | max_error{total{1}} | mode{best}),
+              (hits_result_t{{8, search_strand::reverse_complement}}));
+
+    // same hits as searching the reverse complements separately
+    std::srand(42);
+    std::vector<dna4> random;
+    random_text(random, 1000);
+    TypeParam random_index{random};
+
+    std::vector<query_t> queries;
+    std::vector<query_t> queries_rc;
+    for (size_t i = 0; i < 50; ++i)
+    {
+        size_t const begin = std::rand() % 990;
+        query_t substring(random.begin() + begin, random.begin() + begin + 4 + i % 7);
+        auto substring_rc = substring | std::views::reverse | views::complement;
+
+        // every other query occurs on the reverse complement strand
+        if (i % 2 == 0)
+        {
+            queries.push_back(substring);
+            queries_rc.emplace_back(substring_rc.begin(), substring_rc.end());
+        }
+        else
+        {
+            queries.emplace_back(substring_rc.begin(), substring_rc.end());
+            queries_rc.push_back(substring);
+        }
+    }
+
+    for (uint8_t errors = 0; errors < 2; ++errors)
+    {
+        configuration const error_cfg = max_error{total{errors}};
+
+        std::vector<hits_result_t> expected;
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            expected.emplace_back();
+            for (auto position : search(queries[i], random_index, error_cfg))
+                expected.back().emplace_back(position, search_strand::forward);
+            for (auto position : search(queries_rc[i], random_index, error_cfg))
+                expected.back().emplace_back(position, search_strand::reverse_complement);
+
+            EXPECT_EQ(search(queries[i], random_index, error_cfg | cfg), expected.back());
+        }
+
+        EXPECT_EQ(search(queries, random_index, error_cfg | cfg), expected);
+    }
+
+    // cursors are tagged as well
+    auto cursors = search("TTTG"_dna4, index, cfg | output{index_cursor});
+    ASSERT_EQ(cursors.size(), 2u);
+    EXPECT_EQ(cursors[0].first.locate(), (std::vector<typename TypeParam::size_type>{3}));
+    EXPECT_EQ(cursors[0].second, search_strand::forward);
+    EXPECT_EQ(cursors[1].first.locate(), (std::vector<typename TypeParam::size_type>{7}));
+    EXPECT_EQ(cursors[1].second, search_strand::reverse_complement);
+}
+
+TYPED_TEST(search_test, alignment_output)
+{
+    using hit_t = search_alignment<typename TypeParam::size_type>;
+    using hits_result_t = std::vector<hit_t>;
+
+    auto transcript = [] (std::string const & ops)
+    {
+        std::vector<cigar> result;
+        for (size_t i = 0; i < ops.size(); i += 2)
+            result.push_back(cigar{static_cast<uint32_t>(ops[i] - '0'), cigar_op{}.assign_char(ops[i + 1])});
+        return result;
+    };
+
+    configuration const cfg = output{alignment};
+
+    // exact match
+    EXPECT_EQ(search("ACGT"_dna4, this->index, cfg), (hits_result_t{{0, 0, transcript("4=")},
+                                                                      {4, 0, transcript("4=")},
+                                                                      {8, 0, transcript("4=")}}));
+    EXPECT_EQ(search("ACGG"_dna4, this->index, cfg), (hits_result_t{}));
+
+    // mismatch
+    EXPECT_EQ(search("CGTC"_dna4, this->index, cfg | max_error{total{1}, substitution{1}}),
+              (hits_result_t{{1, 1, transcript("3=1X")}, {5, 1, transcript("3=1X")}}));
+
+    // insertion (T)
+    EXPECT_EQ(search("ACTGT"_dna4, this->index, cfg | max_error{total{1}, insertion{1}}),
+              (hits_result_t{{0, 1, transcript("2=1I2=")},
+                             {4, 1, transcript("2=1I2=")},
+                             {8, 1, transcript("2=1I2=")}}));
+
+    // deletion (C)
+    EXPECT_EQ(search("AGTA"_dna4, this->index, cfg | max_error{total{1}, deletion{1}}),
+              (hits_result_t{{0, 1, transcript("1=1D3=")}, {4, 1, transcript("1=1D3=")}}));
+
+    // a position is reported once with the fewest errors, e.g. 0 is also reached with "3=1I"
+    EXPECT_EQ(search("ACGT"_dna4, this->index, cfg | max_error{total{1}, insertion{1}}),
+              (hits_result_t{{0, 0, transcript("4=")},
+                             {1, 1, transcript("1I3=")},
+                             {4, 0, transcript("4=")},
+                             {5, 1, transcript("1I3=")},
+                             {8, 0, transcript("4=")},
+                             {9, 1, transcript("1I3=")}}));
+
+
+    // best mode reports a single hit
+    hits_result_t hits = search("ACGT"_dna4, this->index, cfg | max_error{total{1}} | mode{best});
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].errors, 0u);
+    EXPECT_EQ(hits[0].transcript, transcript("4="));
+
+    // multiple queries
+    std::vector<std::vector<dna4>> queries{"ACGT"_dna4, "CGTC"_dna4};
+    EXPECT_EQ(search(queries, this->index, cfg | max_error{total{1}, substitution{1}}),
+              (std::vector<hits_result_t>{{{0, 0, transcript("4=")},
+                                           {4, 0, transcript("4=")},
+                                           {8, 0, transcript("4=")}},
+                                          {{1, 1, transcript("3=1X")}, {5, 1, transcript("3=1X")}}}));
+
+    // both strands, the reverse complement of "TTTG" is "CAAA"
+    std::vector<dna4> text{"ACGTTTGCAAAACCG"_dna4};
+    TypeParam index{text};
+    EXPECT_EQ(search("TTTG"_dna4, index, cfg | strand{both_strands}),
+              (std::vector<std::pair<hit_t, search_strand>>{{{3, 0, transcript("4=")}, search_strand::forward},
+                                                            {{7, 0, transcript("4=")},
+                                                             search_strand::reverse_complement}}));
+}
+
 TYPED_TEST(search_string_test, error_free_string)
 {
     using hits_result_t = std::vector<typename TypeParam::size_type>;